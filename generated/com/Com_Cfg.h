@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+
+#include "can_id_table.hpp"
+#include "com.hpp"
+#include "com_rx.hpp"
+
+// Minimal "generated" COM configuration for this mock AUTOSAR-style
+// workspace; mirrors the Com containers in config/arxml/Ecu_Config.arxml.
+
+namespace AutosarMusicPlayer::Com_Cfg {
+
+inline constexpr std::uint32_t kCanBitrate = 500000U;
+
+/**
+ * @brief Transmitted PDUs, in ARXML order; the index is the PduId
+ */
+inline constexpr std::array<Bsw::Com::PduConfig, 2U> kTxPdus{{
+    // name                  CAN id  dlc  mode                            cycle    min delay
+    {"MusicPlayer_Status", 0x3A0U, 5U, Bsw::Com::TransmitMode::Mixed, 500000U, 20000U},
+    {"MusicPlayer_Position", 0x3A1U, 4U, Bsw::Com::TransmitMode::Cyclic, 100000U, 0U},
+}};
+
+inline constexpr Bsw::Com::PduId kPduMusicPlayerStatus = 0U;
+inline constexpr Bsw::Com::PduId kPduMusicPlayerPosition = 1U;
+
+/**
+ * @brief Transmitted signals; the index is the SignalId
+ */
+inline constexpr std::array<Bsw::Com::SignalConfig, 3U> kTxSignals{{
+    // name             PDU                      start  length  triggering
+    {"CurrentSongId", kPduMusicPlayerStatus, 0U, 32U, true},
+    {"PlaybackState", kPduMusicPlayerStatus, 32U, 8U, true},  // Rte_PlaybackStateType
+    {"ElapsedTimeMs", kPduMusicPlayerPosition, 0U, 32U, false},
+}};
+
+inline constexpr Bsw::Com::SignalId kSigCurrentSongId = 0U;
+inline constexpr Bsw::Com::SignalId kSigPlaybackState = 1U;
+inline constexpr Bsw::Com::SignalId kSigElapsedTimeMs = 2U;
+
+/**
+ * @brief Received PDUs; the index is the RX PduId
+ */
+inline constexpr std::array<Bsw::Com::RxPduConfig, 2U> kRxPdus{{
+    // name                   CAN id  dlc
+    {"SteeringWheel_Buttons", 0x1A0U, 1U},
+    {"Ignition_Status", 0x0C0U, 1U},
+}};
+
+inline constexpr Bsw::Com::PduId kRxPduSteeringWheelButtons = 0U;
+inline constexpr Bsw::Com::PduId kRxPduIgnitionStatus = 1U;
+
+/**
+ * @brief Received signals; the index is the RX SignalId
+ */
+inline constexpr std::array<Bsw::Com::SignalConfig, 2U> kRxSignals{{
+    // name         PDU                         start  length
+    {"MediaButton", kRxPduSteeringWheelButtons, 0U, 4U, false}, // SteeringWheelButton, repeated while held
+    {"IgnitionOn", kRxPduIgnitionStatus, 0U, 1U, false},
+}};
+
+inline constexpr Bsw::Com::SignalId kSigMediaButton = 0U;
+inline constexpr Bsw::Com::SignalId kSigIgnitionOn = 1U;
+
+/**
+ * @brief Values of MediaButton
+ */
+enum class SteeringWheelButton : std::uint8_t {
+    None = 0U,
+    Play = 1U,
+    Pause = 2U,
+    Stop = 3U,
+};
+
+inline constexpr Bsw::Com::CanIdTable kRxIdTable = Bsw::Com::CanIdTable::Build(kRxPdus);
+static_assert(kRxIdTable.Size() == kRxPdus.size(), "RX PDUs must have distinct CAN ids");
+
+} // namespace AutosarMusicPlayer::Com_Cfg
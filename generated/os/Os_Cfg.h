@@ -0,0 +1,28 @@
+#pragma once
+
+#include <array>
+
+#include "scheduler.hpp"
+
+// Minimal "generated" OS configuration for this mock AUTOSAR-style
+// workspace; mirrors the OsTask containers in config/arxml/Ecu_Config.arxml.
+
+namespace AutosarMusicPlayer::Os_Cfg {
+
+/**
+ * @brief Task table, in ARXML order; the index is the TaskId
+ */
+inline constexpr std::array<Bsw::Os::TaskConfig, 4U> kTasks{{
+    // name            period  deadline  core
+    {"Task_Event_Hmi", 0U, 5000U, 0U},       // HMI events: PlaylistEventDispatcher::Pump
+    {"Task_1ms", 1000U, 0U, 0U},             // Communication
+    {"Task_10ms", 10000U, 0U, 0U},           // Playback control
+    {"Task_100ms", 100000U, 0U, 1U},         // Media source scanning
+}};
+
+inline constexpr Bsw::Os::TaskId kTaskEventHmi = 0U;
+inline constexpr Bsw::Os::TaskId kTask1ms = 1U;
+inline constexpr Bsw::Os::TaskId kTask10ms = 2U;
+inline constexpr Bsw::Os::TaskId kTask100ms = 3U;
+
+} // namespace AutosarMusicPlayer::Os_Cfg
@@ -9,7 +9,68 @@ public:
     virtual ~IRteMusicPlayerApp() = default;
 
     virtual void NotifySongChanged(Rte_SongIdType newSongId) = 0;
-    virtual void NotifyPlaybackStateChanged(const char* stateName) = 0;
+
+    /**
+     * @brief Sent once with the initial state (sequence 0), then only when
+     *        the state actually changes, with the sequence incremented each time
+     */
+    virtual void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) = 0;
+};
+
+// --- Port bindings ---
+//
+// SW-Cs are templates on the port type they send through. Both ports have
+// the same two member functions as IRteMusicPlayerApp, const-callable.
+
+/**
+ * @brief Runtime binding through IRteMusicPlayerApp
+ *
+ * An unconnected port (nullptr) drops the calls. This is what the unit tests
+ * use, with the mocks in test/mocks/rte_mocks.
+ */
+class VirtualRtePort {
+public:
+    // Implicit, so SW-Cs can still be constructed from a plain interface pointer.
+    VirtualRtePort(IRteMusicPlayerApp* rte) noexcept : rte_(rte) {}
+
+    void NotifySongChanged(Rte_SongIdType newSongId) const {
+        if (rte_ != nullptr) {
+            rte_->NotifySongChanged(newSongId);
+        }
+    }
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) const {
+        if (rte_ != nullptr) {
+            rte_->NotifyPlaybackStateChanged(state, sequence);
+        }
+    }
+
+private:
+    IRteMusicPlayerApp* rte_;
+};
+
+/**
+ * @brief Compile-time binding to the concrete RTE @p Impl
+ *
+ * Always connected, so there is no null check, and the calls are direct:
+ * they inline when @p Impl's functions are visible and not virtual (or
+ * @p Impl is final).
+ */
+template <typename Impl>
+class StaticRtePort {
+public:
+    explicit StaticRtePort(Impl& rte) noexcept : rte_(&rte) {}
+
+    void NotifySongChanged(Rte_SongIdType newSongId) const {
+        rte_->NotifySongChanged(newSongId);
+    }
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) const {
+        rte_->NotifyPlaybackStateChanged(state, sequence);
+    }
+
+private:
+    Impl* rte_;
 };
 
 } // namespace AutosarMusicPlayer::Rte
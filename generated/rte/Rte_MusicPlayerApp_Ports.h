@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Rte_MusicPlayerApp.h"
+#include "Rte_Type.h"
+#include "mpsc_queue.hpp"
+#include "seqlock.hpp"
+
+namespace AutosarMusicPlayer::Rte {
+
+/**
+ * @brief Sender/receiver ports of the MusicPlayerApp SW-C, as configured in
+ *        config/arxml/MusicPlayer_ASW.arxml
+ *
+ * Last-is-best data elements are kept in a Common::Seqlock: Write is
+ * wait-free and Read lock-free, both constant time with no locks, so
+ * runnables on other cores read the latest value without calling into the
+ * sender. Queued data elements go through a bounded lock-free queue; any
+ * runnable may send, one receives.
+ *
+ * This is also the IRteMusicPlayerApp the SW-Cs notify, so their
+ * notifications land in the ports. Being final, it can be bound with
+ * StaticRtePort to have those calls inlined.
+ */
+class MusicPlayerAppRte final : public IRteMusicPlayerApp {
+public:
+    static constexpr std::size_t kPlaybackEventsQueueLength = 16U;
+
+    // --- PpCurrentSong.SongId: last-is-best, init 0 ---
+
+    Std_ReturnType Write_PpCurrentSong_SongId(Rte_SongIdType data) noexcept {
+        currentSong_.Store(data);
+        return RTE_E_OK;
+    }
+
+    /**
+     * @return RTE_E_NEVER_RECEIVED, with the init value, before the first write
+     */
+    Std_ReturnType Read_PpCurrentSong_SongId(Rte_SongIdType* data) const noexcept {
+        if (!currentSong_.Load(*data)) {
+            *data = 0U;
+            return RTE_E_NEVER_RECEIVED;
+        }
+        return RTE_E_OK;
+    }
+
+    // --- PpPlaybackStatus.Status: last-is-best, init {Stopped, 0} ---
+
+    Std_ReturnType Write_PpPlaybackStatus_Status(const Rte_PlaybackStatusType& data) noexcept {
+        playbackStatus_.Store(data);
+        return RTE_E_OK;
+    }
+
+    /**
+     * @return RTE_E_NEVER_RECEIVED, with the init value, before the first write
+     */
+    Std_ReturnType Read_PpPlaybackStatus_Status(Rte_PlaybackStatusType* data) const noexcept {
+        if (!playbackStatus_.Load(*data)) {
+            *data = Rte_PlaybackStatusType{Rte_PlaybackStateType::Stopped, 0U};
+            return RTE_E_NEVER_RECEIVED;
+        }
+        return RTE_E_OK;
+    }
+
+    // --- PpPlaybackEvents.Status: queued, length kPlaybackEventsQueueLength ---
+
+    /**
+     * @return RTE_E_LIMIT if the queue is full; the event is dropped and the
+     *         receiver sees a gap in the sequence numbers
+     */
+    Std_ReturnType Send_PpPlaybackEvents_Status(const Rte_PlaybackStatusType& data) noexcept {
+        return playbackEvents_.TryPush(data) ? RTE_E_OK : RTE_E_LIMIT;
+    }
+
+    /**
+     * @brief Oldest queued event. Receiving runnable only.
+     * @return RTE_E_NO_DATA if the queue is empty
+     */
+    Std_ReturnType Receive_PpPlaybackEvents_Status(Rte_PlaybackStatusType* data) noexcept {
+        return playbackEvents_.TryPop(*data) ? RTE_E_OK : RTE_E_NO_DATA;
+    }
+
+    // --- IRteMusicPlayerApp ---
+
+    void NotifySongChanged(Rte_SongIdType newSongId) override {
+        (void)Write_PpCurrentSong_SongId(newSongId);
+    }
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) override {
+        const Rte_PlaybackStatusType status{state, sequence};
+        (void)Write_PpPlaybackStatus_Status(status);
+        (void)Send_PpPlaybackEvents_Status(status);
+    }
+
+private:
+    Common::Seqlock<Rte_SongIdType> currentSong_;
+    Common::Seqlock<Rte_PlaybackStatusType> playbackStatus_;
+    Common::MpscQueue<Rte_PlaybackStatusType, kPlaybackEventsQueueLength> playbackEvents_;
+};
+
+} // namespace AutosarMusicPlayer::Rte
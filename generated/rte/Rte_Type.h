@@ -5,3 +5,48 @@
 // Minimal "generated" types for this mock AUTOSAR-style workspace.
 
 using Rte_SongIdType = std::uint32_t;
+
+/**
+ * @brief Playback state as carried over the RTE (one byte)
+ */
+enum class Rte_PlaybackStateType : std::uint8_t {
+    Stopped = 0U,
+    Playing = 1U,
+    Paused = 2U,
+};
+
+/**
+ * @brief Per-sender notification counter; increments by one per event and
+ *        wraps, so receivers can detect missed or duplicate events
+ */
+using Rte_SequenceCounterType = std::uint32_t;
+
+/**
+ * @brief Playback state with the sequence number it was announced with
+ */
+struct Rte_PlaybackStatusType {
+    Rte_PlaybackStateType state;
+    Rte_SequenceCounterType sequence;
+};
+
+/**
+ * @brief Return type of the Rte_Read/Write/Send/Receive calls
+ */
+using Std_ReturnType = std::uint8_t;
+
+constexpr Std_ReturnType RTE_E_OK = 0U;
+constexpr Std_ReturnType RTE_E_LIMIT = 130U;          ///< Queued port full; the data was discarded
+constexpr Std_ReturnType RTE_E_NO_DATA = 131U;        ///< Queued port empty
+constexpr Std_ReturnType RTE_E_NEVER_RECEIVED = 133U; ///< Nothing written yet; the init value was returned
+
+/**
+ * @brief Display name of a playback state, for logs only
+ */
+constexpr const char* Rte_PlaybackStateName(Rte_PlaybackStateType state) noexcept {
+    switch (state) {
+    case Rte_PlaybackStateType::Stopped: return "Stopped";
+    case Rte_PlaybackStateType::Playing: return "Playing";
+    case Rte_PlaybackStateType::Paused: return "Paused";
+    default: return "Unknown";
+    }
+}
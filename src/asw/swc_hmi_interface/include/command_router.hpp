@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "app_error_codes.hpp"
+#include "perfect_hash.hpp"
+#include "playback_manager.hpp"
+#include "playlist.hpp"
+
+namespace AutosarMusicPlayer::Asw::Hmi {
+
+enum class Command : std::uint8_t {
+    Play,
+    Pause,
+    Stop,
+    Next,
+    Previous,
+    Select, ///< select <song id>
+};
+
+struct CommandSpec {
+    std::string_view name;
+    Command command;
+    bool takesSongId;
+};
+
+/**
+ * @brief Textual commands accepted from the HMI and the diagnostic console
+ */
+inline constexpr std::array<CommandSpec, 6U> kCommands{{
+    {"play", Command::Play, false},
+    {"pause", Command::Pause, false},
+    {"stop", Command::Stop, false},
+    {"next", Command::Next, false},
+    {"previous", Command::Previous, false},
+    {"select", Command::Select, true},
+}};
+
+namespace Detail {
+
+template <std::size_t N>
+constexpr std::array<std::string_view, N> CommandNames(const std::array<CommandSpec, N>& commands) noexcept {
+    std::array<std::string_view, N> names{};
+    for (std::size_t i = 0U; i < N; ++i) {
+        names[i] = commands[i].name;
+    }
+    return names;
+}
+
+} // namespace Detail
+
+inline constexpr Common::PerfectHash<kCommands.size()> kCommandHash{Detail::CommandNames(kCommands)};
+static_assert(kCommandHash.IsPerfect(), "Command names must be distinct");
+
+/**
+ * @brief Outcome of a command script
+ */
+struct ScriptResult {
+    std::size_t executed{0U}; ///< Commands run, failed ones included
+    std::size_t failed{0U};
+    std::size_t firstFailedEntry{0U}; ///< 1-based, counting lines and ;-separated commands; 0 if none failed
+    Common::AppError firstError{Common::AppError::Ok};
+};
+
+/**
+ * @brief Parses textual commands and applies them to the playback manager
+ *        and the playlist
+ *
+ * A command is a name and at most one argument separated by blanks, e.g.
+ * "select 42". Names are looked up in kCommandHash, arguments parsed with
+ * std::from_chars; nothing is allocated or copied, the line is only viewed.
+ *
+ * @tparam Manager BasicPlaybackManager with any RTE binding
+ * @tparam PlaylistT Playlist or StaticPlaylist
+ */
+template <typename Manager, typename PlaylistT>
+class BasicCommandRouter {
+public:
+    BasicCommandRouter(Manager& manager, PlaylistT& playlist) : manager_(manager), playlist_(playlist) {}
+
+    /**
+     * @brief Run one command
+     * @return NotFound for an unknown command, InvalidArgument for a missing,
+     *         malformed or unexpected argument, else the operation's result
+     */
+    Common::AppError Execute(std::string_view line) {
+        line = Trim(line);
+        std::size_t nameLength = 0U;
+        while (nameLength < line.size() && !IsBlank(line[nameLength])) {
+            ++nameLength;
+        }
+        const std::string_view name = line.substr(0U, nameLength);
+        const std::string_view argument = Trim(line.substr(nameLength));
+
+        const std::size_t index = kCommandHash.Find(name);
+        if (index == kCommandHash.kNotFound) {
+            return Common::AppError::NotFound;
+        }
+
+        const CommandSpec& spec = kCommands[index];
+        Common::SongId songId = 0U;
+        if (spec.takesSongId) {
+            const char* end = argument.data() + argument.size();
+            const auto parsed = std::from_chars(argument.data(), end, songId);
+            if (argument.empty() || parsed.ec != std::errc{} || parsed.ptr != end) {
+                return Common::AppError::InvalidArgument;
+            }
+        } else if (!argument.empty()) {
+            return Common::AppError::InvalidArgument;
+        }
+
+        switch (spec.command) {
+        case Command::Play: return manager_.Play();
+        case Command::Pause: return manager_.Pause();
+        case Command::Stop: return manager_.Stop();
+        case Command::Next: return playlist_.Next();
+        case Command::Previous: return playlist_.Previous();
+        case Command::Select: return playlist_.SetCurrentSong(songId);
+        default: return Common::AppError::InternalError;
+        }
+    }
+
+    /**
+     * @brief Run the commands of @p script, separated by newlines or ';'
+     *
+     * Blank lines and lines starting with '#' are skipped. Every command is
+     * run even after a failure. The playlist is updated as one transaction,
+     * so its observers see one notification for the whole script.
+     */
+    ScriptResult ExecuteScript(std::string_view script) {
+        const typename PlaylistT::UpdateScope scope(playlist_);
+        ScriptResult result;
+        std::size_t entry = 0U;
+        while (!script.empty()) {
+            std::size_t end = 0U;
+            while (end < script.size() && script[end] != '\n' && script[end] != ';') {
+                ++end;
+            }
+            const std::string_view line = Trim(script.substr(0U, end));
+            script.remove_prefix(end < script.size() ? end + 1U : end);
+            ++entry;
+
+            if (line.empty() || line.front() == '#') {
+                continue;
+            }
+            ++result.executed;
+            const Common::AppError error = Execute(line);
+            if (error != Common::AppError::Ok) {
+                ++result.failed;
+                if (result.firstFailedEntry == 0U) {
+                    result.firstFailedEntry = entry;
+                    result.firstError = error;
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    // Hand-written rather than find_first_not_of(" \t\r"), which searches
+    // the set once per character.
+    static constexpr bool IsBlank(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    static constexpr std::string_view Trim(std::string_view text) noexcept {
+        while (!text.empty() && IsBlank(text.front())) {
+            text.remove_prefix(1U);
+        }
+        while (!text.empty() && IsBlank(text.back())) {
+            text.remove_suffix(1U);
+        }
+        return text;
+    }
+
+    Manager& manager_;
+    PlaylistT& playlist_;
+};
+
+using CommandRouter = BasicCommandRouter<Playback::PlaybackManager, Asw::Playlist::Playlist>;
+
+extern template class BasicCommandRouter<Playback::PlaybackManager, Asw::Playlist::Playlist>;
+extern template class BasicCommandRouter<Playback::PlaybackManager, Asw::Playlist::StaticPlaylist>;
+
+} // namespace AutosarMusicPlayer::Asw::Hmi
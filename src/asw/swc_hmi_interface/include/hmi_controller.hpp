@@ -2,20 +2,72 @@
 
 #include "Rte_MusicPlayerApp.h"
 #include "playlist.hpp"
+#include "playlist_event_dispatcher.hpp"
 
 namespace AutosarMusicPlayer::Asw::Hmi {
 
-class HmiController final : public Asw::Playlist::IPlaylistObserver {
+/**
+ * @brief HMI controller SW-C
+ *
+ * @tparam RtePort Rte::VirtualRtePort (runtime binding, nullable) or
+ *         Rte::StaticRtePort<Impl> (compile-time binding, direct calls)
+ */
+template <typename RtePort>
+class BasicHmiController final : public Asw::Playlist::IPlaylistObserver {
 public:
-    HmiController(Asw::Playlist::Playlist& playlist, Rte::IRteMusicPlayerApp* rte);
-    ~HmiController() override;
+    BasicHmiController(Asw::Playlist::Playlist& playlist, RtePort rte) : playlist_(&playlist), rte_(rte) {
+        attached_ = playlist_->RegisterObserver(this) == Common::AppError::Ok;
+    }
 
-    void OnPlaylistChanged() override;
-    void OnSongChanged(Common::SongId newSongId) override;
+    /**
+     * @brief Receive playlist events through @p dispatcher instead, so the
+     *        mutating thread does not wait for the HMI
+     */
+    BasicHmiController(Asw::Playlist::PlaylistEventDispatcher& dispatcher, RtePort rte)
+        : dispatcher_(&dispatcher), rte_(rte) {
+        attached_ = dispatcher_->RegisterObserver(this) == Common::AppError::Ok;
+    }
+
+    ~BasicHmiController() override {
+        if (playlist_ != nullptr) {
+            playlist_->UnregisterObserver(this);
+        }
+        if (dispatcher_ != nullptr) {
+            dispatcher_->UnregisterObserver(this);
+        }
+    }
+
+    BasicHmiController(const BasicHmiController&) = delete;
+    BasicHmiController& operator=(const BasicHmiController&) = delete;
+    BasicHmiController(BasicHmiController&&) = delete;
+    BasicHmiController& operator=(BasicHmiController&&) = delete;
+
+    /**
+     * @brief False if the playlist's (or dispatcher's) observer table was
+     *        full; the controller then never sees a song change
+     */
+    [[nodiscard]] bool IsAttached() const noexcept {
+        return attached_;
+    }
+
+    void OnPlaylistChanged() override {
+        // Display updates come from HmiViewModel, which needs the range events.
+    }
+
+    void OnSongChanged(Common::SongId newSongId) override {
+        const Rte_SongIdType rteSongId = newSongId;
+        rte_.NotifySongChanged(rteSongId);
+    }
 
 private:
-    Asw::Playlist::Playlist& playlist_;
-    Rte::IRteMusicPlayerApp* rte_;
+    Asw::Playlist::Playlist* playlist_{nullptr};
+    Asw::Playlist::PlaylistEventDispatcher* dispatcher_{nullptr};
+    RtePort rte_;
+    bool attached_{false};
 };
 
+using HmiController = BasicHmiController<Rte::VirtualRtePort>;
+
+extern template class BasicHmiController<Rte::VirtualRtePort>;
+
 } // namespace AutosarMusicPlayer::Asw::Hmi
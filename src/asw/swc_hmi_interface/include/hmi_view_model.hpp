@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Rte_Type.h"
+#include "app_error_codes.hpp"
+#include "app_types.hpp"
+#include "hmi_observer.hpp"
+#include "playlist.hpp"
+
+namespace AutosarMusicPlayer::Asw::Hmi {
+
+/**
+ * @brief One visible playlist row that changed since the last frame
+ */
+struct HmiRow {
+    std::size_t position{0U};                     ///< Playlist position
+    std::optional<Asw::Playlist::SongView> song;  ///< Empty: the row is blank now (past the end)
+    bool isCurrent{false};
+};
+
+/**
+ * @brief Consolidated display update for one tick
+ *
+ * SongViews point into the playlist and are valid until its next mutation.
+ */
+struct HmiFrame {
+    std::uint64_t sequence{0U};
+    std::size_t playlistSize{0U};
+    std::optional<std::size_t> currentPosition;
+    Rte_PlaybackStateType playbackState{Rte_PlaybackStateType::Stopped};
+    bool statusChanged{false};  ///< Size, current song or playback state may differ from the last frame
+    std::vector<HmiRow> rows;   ///< Changed visible rows, top to bottom
+};
+
+class IHmiDisplay {
+public:
+    virtual ~IHmiDisplay() = default;
+    virtual void OnFrame(const HmiFrame& frame) = 0;
+};
+
+/**
+ * @brief HMI view model: playlist and playback events in, at most one frame
+ *        per display tick out
+ *
+ * Events only mark which visible rows are dirty (a bit per row of the
+ * window) and which status fields changed, so a storm of events costs a
+ * few bit operations each. Tick(), called from the display runnable (for
+ * example at 60 Hz), turns whatever accumulated into a single HmiFrame with
+ * just the changed rows of the visible window, and tells the IHmiObservers
+ * once if the displayed song changed. A tick with nothing dirty emits
+ * nothing.
+ *
+ * Everything, Tick() included, runs on the playlist's thread.
+ *
+ * @tparam PlaylistT Playlist or StaticPlaylist
+ */
+template <typename PlaylistT>
+class BasicHmiViewModel final : public Asw::Playlist::IPlaylistObserver {
+public:
+    static constexpr std::size_t kMaxVisibleRows = 64U;
+
+    /**
+     * @param visibleRows Height of the window, at most kMaxVisibleRows
+     */
+    BasicHmiViewModel(PlaylistT& playlist, IHmiDisplay& display, std::size_t visibleRows);
+    ~BasicHmiViewModel() override;
+
+    BasicHmiViewModel(const BasicHmiViewModel&) = delete;
+    BasicHmiViewModel& operator=(const BasicHmiViewModel&) = delete;
+    BasicHmiViewModel(BasicHmiViewModel&&) = delete;
+    BasicHmiViewModel& operator=(BasicHmiViewModel&&) = delete;
+
+    /**
+     * @brief False if the playlist's observer table was full
+     */
+    [[nodiscard]] bool IsAttached() const noexcept {
+        return attached_;
+    }
+
+    Common::AppError RegisterObserver(IHmiObserver* observer);
+    void UnregisterObserver(IHmiObserver* observer);
+
+    /**
+     * @brief Scroll: show the rows from playlist position @p top; redraws the window
+     */
+    void ScrollTo(std::size_t top);
+
+    /**
+     * @brief Playback state as received from the RTE
+     */
+    void SetPlaybackState(Rte_PlaybackStateType state);
+
+    /**
+     * @brief Emit the accumulated changes as one frame
+     * @return Whether a frame was emitted
+     */
+    bool Tick();
+
+    [[nodiscard]] std::size_t Top() const noexcept {
+        return top_;
+    }
+
+    [[nodiscard]] std::uint64_t FramesEmitted() const noexcept {
+        return frame_.sequence;
+    }
+
+    [[nodiscard]] std::uint64_t RowsEmitted() const noexcept {
+        return rowsEmitted_;
+    }
+
+    [[nodiscard]] std::uint64_t EventsReceived() const noexcept {
+        return eventsReceived_;
+    }
+
+    void OnPlaylistChanged() override;
+    void OnSongChanged(Common::SongId newSongId) override;
+    void OnSongsInserted(std::size_t first, std::size_t count) override;
+    void OnSongsRemoved(std::size_t first, std::size_t count) override;
+    void OnSongsUpdated(std::size_t first, std::size_t count) override;
+
+private:
+    static constexpr std::size_t kToEnd = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Mark playlist positions [first, last) dirty where visible
+     */
+    void MarkRows(std::size_t first, std::size_t last) noexcept;
+
+    PlaylistT& playlist_;
+    IHmiDisplay& display_;
+    std::vector<IHmiObserver*> observers_;
+    bool attached_{false};
+
+    std::size_t top_{0U};
+    std::size_t visibleRows_;
+    std::uint64_t dirtyRows_{0U}; ///< Bit i: row top_ + i
+    bool statusDirty_{true};
+
+    // As shown by the last frame.
+    std::optional<std::size_t> shownCurrent_;
+    std::optional<Common::SongId> shownSongId_;
+    Rte_PlaybackStateType playbackState_{Rte_PlaybackStateType::Stopped};
+
+    HmiFrame frame_;
+    std::uint64_t rowsEmitted_{0U};
+    std::uint64_t eventsReceived_{0U};
+};
+
+using HmiViewModel = BasicHmiViewModel<Asw::Playlist::Playlist>;
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <typename PlaylistT>
+BasicHmiViewModel<PlaylistT>::BasicHmiViewModel(PlaylistT& playlist, IHmiDisplay& display, std::size_t visibleRows)
+    : playlist_(playlist), display_(display), visibleRows_(std::min(visibleRows, kMaxVisibleRows)) {
+    MarkRows(0U, kToEnd);
+    attached_ = playlist_.RegisterObserver(this) == Common::AppError::Ok;
+}
+
+template <typename PlaylistT>
+BasicHmiViewModel<PlaylistT>::~BasicHmiViewModel() {
+    if (attached_) {
+        playlist_.UnregisterObserver(this);
+    }
+}
+
+template <typename PlaylistT>
+Common::AppError BasicHmiViewModel<PlaylistT>::RegisterObserver(IHmiObserver* observer) {
+    if (observer == nullptr) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (std::find(observers_.begin(), observers_.end(), observer) == observers_.end()) {
+        observers_.push_back(observer);
+    }
+    return Common::AppError::Ok;
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::UnregisterObserver(IHmiObserver* observer) {
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::ScrollTo(std::size_t top) {
+    if (top != top_) {
+        top_ = top;
+        MarkRows(0U, kToEnd);
+    }
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::SetPlaybackState(Rte_PlaybackStateType state) {
+    ++eventsReceived_;
+    if (state != playbackState_) {
+        playbackState_ = state;
+        statusDirty_ = true;
+    }
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::OnPlaylistChanged() {
+    ++eventsReceived_;
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::OnSongChanged(Common::SongId /*newSongId*/) {
+    // The rows involved are worked out once, at the tick.
+    ++eventsReceived_;
+    statusDirty_ = true;
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::OnSongsInserted(std::size_t first, std::size_t /*count*/) {
+    // Everything from the insertion point moves down.
+    ++eventsReceived_;
+    statusDirty_ = true;
+    MarkRows(first, kToEnd);
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::OnSongsRemoved(std::size_t first, std::size_t /*count*/) {
+    ++eventsReceived_;
+    statusDirty_ = true;
+    MarkRows(first, kToEnd);
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::OnSongsUpdated(std::size_t first, std::size_t count) {
+    ++eventsReceived_;
+    MarkRows(first, first + count);
+}
+
+template <typename PlaylistT>
+void BasicHmiViewModel<PlaylistT>::MarkRows(std::size_t first, std::size_t last) noexcept {
+    const std::size_t begin = std::max(first, top_);
+    const std::size_t end = std::min(last, top_ + visibleRows_);
+    if (begin >= end) {
+        return;
+    }
+
+    const std::size_t width = end - begin;
+    const std::uint64_t bits = width >= 64U ? ~std::uint64_t{0U} : (std::uint64_t{1U} << width) - 1U;
+    dirtyRows_ |= bits << (begin - top_);
+}
+
+template <typename PlaylistT>
+bool BasicHmiViewModel<PlaylistT>::Tick() {
+    // Only status events can move the current song; row updates cannot.
+    std::optional<std::size_t> current = shownCurrent_;
+    std::optional<Common::SongId> songId = shownSongId_;
+    if (statusDirty_) {
+        current = playlist_.CurrentPosition();
+        const auto song = playlist_.GetCurrentSong();
+        songId = song.has_value() ? std::optional<Common::SongId>(song->id) : std::nullopt;
+        if (current != shownCurrent_) {
+            // Both rows change their highlight; MarkRows ignores invisible ones.
+            if (shownCurrent_.has_value()) {
+                MarkRows(*shownCurrent_, *shownCurrent_ + 1U);
+            }
+            if (current.has_value()) {
+                MarkRows(*current, *current + 1U);
+            }
+        }
+    }
+
+    if (dirtyRows_ == 0U && !statusDirty_) {
+        return false;
+    }
+
+    const bool songChanged = songId != shownSongId_;
+    frame_.playlistSize = playlist_.Size();
+    frame_.currentPosition = current;
+    frame_.playbackState = playbackState_;
+    frame_.statusChanged = statusDirty_;
+    frame_.rows.clear();
+    for (std::size_t row = 0U; row < visibleRows_; ++row) {
+        if (((dirtyRows_ >> row) & 1U) != 0U) {
+            const std::size_t position = top_ + row;
+            frame_.rows.push_back(HmiRow{position, playlist_.At(position), current == position});
+        }
+    }
+
+    dirtyRows_ = 0U;
+    statusDirty_ = false;
+    shownCurrent_ = current;
+    shownSongId_ = songId;
+    ++frame_.sequence;
+    rowsEmitted_ += frame_.rows.size();
+    display_.OnFrame(frame_);
+
+    if (songChanged && songId.has_value()) {
+        for (auto* observer : observers_) {
+            observer->OnDisplayedSongChanged(*songId);
+        }
+    }
+    return true;
+}
+
+extern template class BasicHmiViewModel<Asw::Playlist::Playlist>;
+extern template class BasicHmiViewModel<Asw::Playlist::StaticPlaylist>;
+
+} // namespace AutosarMusicPlayer::Asw::Hmi
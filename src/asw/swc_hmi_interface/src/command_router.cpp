@@ -0,0 +1,8 @@
+#include "command_router.hpp"
+
+namespace AutosarMusicPlayer::Asw::Hmi {
+
+template class BasicCommandRouter<Playback::PlaybackManager, Asw::Playlist::Playlist>;
+template class BasicCommandRouter<Playback::PlaybackManager, Asw::Playlist::StaticPlaylist>;
+
+} // namespace AutosarMusicPlayer::Asw::Hmi
@@ -2,23 +2,6 @@
 
 namespace AutosarMusicPlayer::Asw::Hmi {
 
-HmiController::HmiController(Asw::Playlist::Playlist& playlist, Rte::IRteMusicPlayerApp* rte)
-    : playlist_(playlist), rte_(rte) {
-    playlist_.RegisterObserver(this);
-}
-
-HmiController::~HmiController() {
-    playlist_.UnregisterObserver(this);
-}
-
-void HmiController::OnPlaylistChanged() {
-    // In a real system this would update UI state.
-}
-
-void HmiController::OnSongChanged(Common::SongId newSongId) {
-    if (rte_ != nullptr) {
-        rte_->NotifySongChanged(static_cast<Rte_SongIdType>(newSongId));
-    }
-}
+template class BasicHmiController<Rte::VirtualRtePort>;
 
 } // namespace AutosarMusicPlayer::Asw::Hmi
@@ -0,0 +1,8 @@
+#include "hmi_view_model.hpp"
+
+namespace AutosarMusicPlayer::Asw::Hmi {
+
+template class BasicHmiViewModel<Asw::Playlist::Playlist>;
+template class BasicHmiViewModel<Asw::Playlist::StaticPlaylist>;
+
+} // namespace AutosarMusicPlayer::Asw::Hmi
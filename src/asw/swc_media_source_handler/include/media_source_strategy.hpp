@@ -5,10 +5,9 @@
 
 #include "app_error_codes.hpp"
 #include "app_types.hpp"
+#include "playlist_fwd.hpp"
+#include "track_list.hpp"
 
-namespace AutosarMusicPlayer::Asw::Playlist {
-class Playlist;
-}
 
 namespace AutosarMusicPlayer::Asw::MediaSource {
 
@@ -20,7 +19,13 @@ public:
     virtual Common::AppError Activate() = 0;
     virtual Common::AppError Deactivate() = 0;
 
-    virtual Common::AppError GetAvailableTracks(std::vector<Common::SongInfo>& outTracks) = 0;
+    /**
+     * @brief Fill @p outTracks with the source's tracks, in playback order
+     *
+     * @p outTracks is cleared first. Titles are copied into its arena once
+     * and passed on by view from there.
+     */
+    virtual Common::AppError GetAvailableTracks(Common::TrackList& outTracks) = 0;
 };
 
 class MediaSourceHandler {
@@ -31,10 +36,25 @@ public:
 
     [[nodiscard]] const char* ActiveSourceName() const;
 
+    /**
+     * @brief Bring @p playlist in line with the active source's tracks
+     *
+     * Scratch storage follows the playlist's storage policy, so refreshing a
+     * StaticPlaylist allocates nothing once tracks_ has seen the library.
+     * What the strategy itself allocates while scanning is up to it
+     * (UsbSource lists files into a std::vector).
+     */
     [[nodiscard]] Common::AppError RefreshPlaylist(Asw::Playlist::Playlist& playlist);
+    [[nodiscard]] Common::AppError RefreshPlaylist(Asw::Playlist::StaticPlaylist& playlist);
 
 private:
+    [[nodiscard]] Common::AppError FetchTracks();
+
     std::unique_ptr<IMediaSourceStrategy> strategy_;
+
+    // Reused across refreshes so the entry and title storage is only
+    // allocated for the first (or a larger) library.
+    Common::TrackList tracks_;
 };
 
 } // namespace AutosarMusicPlayer::Asw::MediaSource
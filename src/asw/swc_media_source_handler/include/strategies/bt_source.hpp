@@ -1,7 +1,5 @@
 #pragma once
 
-#include <vector>
-
 #include "app_error_codes.hpp"
 #include "app_types.hpp"
 #include "media_source_strategy.hpp"
@@ -15,10 +13,9 @@ public:
     Common::AppError Activate() override { return Common::AppError::Ok; }
     Common::AppError Deactivate() override { return Common::AppError::Ok; }
 
-    Common::AppError GetAvailableTracks(std::vector<Common::SongInfo>& outTracks) override {
-        outTracks = {
-            {1U, "BT Stream", 0U},
-        };
+    Common::AppError GetAvailableTracks(Common::TrackList& outTracks) override {
+        outTracks.Clear();
+        outTracks.Add(1U, "BT Stream", 0U);
         return Common::AppError::Ok;
     }
 };
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <vector>
-
 #include "app_error_codes.hpp"
 #include "app_types.hpp"
 #include "media_source_strategy.hpp"
@@ -18,7 +16,7 @@ public:
     Common::AppError Activate() override { return storage_.Mount(); }
     Common::AppError Deactivate() override { return storage_.Unmount(); }
 
-    Common::AppError GetAvailableTracks(std::vector<Common::SongInfo>& outTracks) override;
+    Common::AppError GetAvailableTracks(Common::TrackList& outTracks) override;
 
 private:
     Bsw::Cdd::UsbMassStorage& storage_;
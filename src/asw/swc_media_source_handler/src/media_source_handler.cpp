@@ -3,10 +3,198 @@
 #include "playlist.hpp"
 #include "strategies/usb_source.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace AutosarMusicPlayer::Asw::MediaSource {
 
+namespace {
+
+// Scratch storage of a refresh, sized by the playlist's storage policy: a
+// StaticPlaylist is refreshed without touching the heap.
+template <typename PlaylistT>
+struct SyncScratch {
+    using Policy = typename PlaylistT::StoragePolicy;
+
+    template <typename T>
+    using Vector = typename Policy::template Vector<T, Policy::kCapacity>;
+
+    using SourceIndex = Asw::Playlist::BasicSongIndex<Policy>;
+};
+
+// Marks the longest run of entries whose source positions are increasing.
+// Those songs are already in the right relative order and stay put; every
+// other retained song has to move. Entries equal to kInvalidSlot (songs no
+// longer provided by the source) are never kept.
+template <typename PlaylistT, typename Values, typename Flags>
+void LongestIncreasingSubsequence(const Values& values, Flags& keep) {
+    using Scratch = SyncScratch<PlaylistT>;
+    constexpr std::uint32_t kNone = Scratch::SourceIndex::kInvalidSlot;
+
+    typename Scratch::template Vector<std::uint32_t> tails;
+    typename Scratch::template Vector<std::uint32_t> prev;
+    prev.resize(values.size(), kNone);
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        if (values[i] == kNone) {
+            continue;
+        }
+        const auto it = std::lower_bound(tails.begin(), tails.end(), values[i],
+                                         [&values](std::uint32_t idx, std::uint32_t v) { return values[idx] < v; });
+        if (it != tails.begin()) {
+            prev[i] = *(it - 1);
+        }
+        if (it == tails.end()) {
+            tails.push_back(static_cast<std::uint32_t>(i));
+        } else {
+            *it = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    keep.assign(values.size(), false);
+    for (std::uint32_t i = tails.empty() ? kNone : tails.back(); i != kNone; i = prev[i]) {
+        keep[i] = true;
+    }
+}
+
+template <typename SourceIndex>
+Common::AppError BuildSourceIndex(const Common::TrackList& tracks, SourceIndex& outIndex) {
+    outIndex.Reserve(tracks.Size());
+    for (std::size_t i = 0U; i < tracks.Size(); ++i) {
+        if (tracks[i].id == 0U || outIndex.Contains(tracks[i].id)) {
+            return Common::AppError::InvalidArgument;
+        }
+        outIndex.Insert(tracks[i].id, static_cast<std::uint32_t>(i));
+    }
+    return Common::AppError::Ok;
+}
+
+// Removes every song whose keep flag is false, one range per contiguous run,
+// back to front so earlier positions stay valid.
+template <typename PlaylistT, typename Flags>
+Common::AppError RemoveUnkept(PlaylistT& playlist, const Flags& keep) {
+    std::size_t pos = keep.size();
+    while (pos > 0U) {
+        if (keep[pos - 1U]) {
+            --pos;
+            continue;
+        }
+        const std::size_t end = pos;
+        while (pos > 0U && !keep[pos - 1U]) {
+            --pos;
+        }
+        const auto res = playlist.RemoveRange(pos, end - pos);
+        if (res != Common::AppError::Ok) {
+            return res;
+        }
+    }
+    return Common::AppError::Ok;
+}
+
+// Compares against the title as the playlist would store it, so titles cut
+// by a fixed-capacity policy do not count as changed on every rescan.
+template <typename PlaylistT>
+bool SameMetadata(const Asw::Playlist::SongView& song, const Common::TrackEntry& track) {
+    return song.durationSeconds == track.durationSeconds &&
+           song.title == PlaylistT::StoragePolicy::StoredTitle(track.title);
+}
+
+// Length of the run of tracks starting at @p first for which @p inRun holds.
+template <typename Pred>
+std::size_t RunLength(const Common::TrackList& tracks, std::size_t first, Pred inRun) {
+    std::size_t end = first;
+    while (end < tracks.Size() && inRun(end)) {
+        ++end;
+    }
+    return end - first;
+}
+
+// Walks the source list against the (now ordered) kept songs: runs of new
+// tracks are inserted in place, runs of kept songs with changed metadata are
+// updated in place.
+template <typename PlaylistT, typename Flags>
+Common::AppError InsertAndUpdate(PlaylistT& playlist, const Common::TrackList& tracks, const Flags& keptInSource) {
+    std::size_t pos = 0U;
+    std::size_t i = 0U;
+    while (i < tracks.Size()) {
+        auto res = Common::AppError::Ok;
+        if (!keptInSource[i]) {
+            const std::size_t count = RunLength(tracks, i, [&](std::size_t k) { return !keptInSource[k]; });
+            res = playlist.InsertSongs(pos, tracks.Data() + i, count);
+            pos += count;
+            i += count;
+        } else if (!SameMetadata<PlaylistT>(*playlist.At(pos), tracks[i])) {
+            const std::size_t first = pos;
+            const std::size_t firstTrack = i;
+            const std::size_t count = RunLength(tracks, i, [&](std::size_t k) {
+                return keptInSource[k] &&
+                       !SameMetadata<PlaylistT>(*playlist.At(first + (k - firstTrack)), tracks[k]);
+            });
+            res = playlist.UpdateSongs(pos, tracks.Data() + i, count);
+            pos += count;
+            i += count;
+        } else {
+            ++pos;
+            ++i;
+        }
+        if (res != Common::AppError::Ok) {
+            return res;
+        }
+    }
+    return Common::AppError::Ok;
+}
+
+// Brings the playlist in line with the source track list using the smallest
+// set of range removals, insertions and in-place updates, so observers get
+// range events instead of a full reset. The current song is kept if the
+// source still provides it.
+template <typename PlaylistT>
+Common::AppError SyncPlaylist(PlaylistT& playlist, const Common::TrackList& tracks) {
+    if (tracks.Size() > playlist.MaxSize()) {
+        return Common::AppError::Busy;
+    }
+
+    using Scratch = SyncScratch<PlaylistT>;
+
+    typename Scratch::SourceIndex sourcePos;
+    const auto indexRes = BuildSourceIndex(tracks, sourcePos);
+    if (indexRes != Common::AppError::Ok) {
+        return indexRes;
+    }
+
+    typename Scratch::template Vector<std::uint32_t> sourceOfExisting;
+    playlist.ForEachSong([&](const Asw::Playlist::SongView& song) {
+        sourceOfExisting.push_back(sourcePos.Find(song.id));
+    });
+
+    typename Scratch::template Vector<bool> keep;
+    LongestIncreasingSubsequence<PlaylistT>(sourceOfExisting, keep);
+    typename Scratch::template Vector<bool> keptInSource;
+    keptInSource.assign(tracks.Size(), false);
+    for (std::size_t pos = 0U; pos < keep.size(); ++pos) {
+        if (keep[pos]) {
+            keptInSource[sourceOfExisting[pos]] = true;
+        }
+    }
+
+    const auto current = playlist.GetCurrentSong();
+    const Common::SongId currentId = current.has_value() ? current->id : 0U;
+
+    const typename PlaylistT::UpdateScope scope(playlist);
+
+    auto res = RemoveUnkept(playlist, keep);
+    if (res == Common::AppError::Ok) {
+        res = InsertAndUpdate(playlist, tracks, keptInSource);
+    }
+    if (res == Common::AppError::Ok && playlist.Contains(currentId)) {
+        res = playlist.SetCurrentSong(currentId);
+    }
+    return res;
+}
+
+} // namespace
+
 void MediaSourceHandler::SetStrategy(std::unique_ptr<IMediaSourceStrategy> strategy) {
     if (strategy_ != nullptr) {
         (void)strategy_->Deactivate();
@@ -24,45 +212,44 @@ const char* MediaSourceHandler::ActiveSourceName() const {
 }
 
 Common::AppError MediaSourceHandler::RefreshPlaylist(Asw::Playlist::Playlist& playlist) {
-    if (strategy_ == nullptr) {
-        return Common::AppError::NotReady;
+    const auto res = FetchTracks();
+    if (res != Common::AppError::Ok) {
+        return res;
     }
 
-    std::vector<Common::SongInfo> tracks;
-    const auto res = strategy_->GetAvailableTracks(tracks);
+    return SyncPlaylist(playlist, tracks_);
+}
+
+Common::AppError MediaSourceHandler::RefreshPlaylist(Asw::Playlist::StaticPlaylist& playlist) {
+    const auto res = FetchTracks();
     if (res != Common::AppError::Ok) {
         return res;
     }
 
-    (void)playlist.Clear();
+    return SyncPlaylist(playlist, tracks_);
+}
 
-    for (auto& track : tracks) {
-        const auto addRes = playlist.AddSong(std::move(track));
-        if (addRes != Common::AppError::Ok) {
-            return addRes;
-        }
+Common::AppError MediaSourceHandler::FetchTracks() {
+    if (strategy_ == nullptr) {
+        return Common::AppError::NotReady;
     }
 
-    return Common::AppError::Ok;
+    return strategy_->GetAvailableTracks(tracks_);
 }
 
-Common::AppError UsbSource::GetAvailableTracks(std::vector<Common::SongInfo>& outTracks) {
+Common::AppError UsbSource::GetAvailableTracks(Common::TrackList& outTracks) {
     std::vector<Bsw::Cdd::UsbMassStorage::FileEntry> files;
     const auto res = storage_.ListMusicFiles(files);
     if (res != Common::AppError::Ok) {
         return res;
     }
 
-    outTracks.clear();
-    outTracks.reserve(files.size());
+    outTracks.Clear();
+    outTracks.Reserve(files.size());
 
     Common::SongId nextId = 1U;
     for (const auto& f : files) {
-        Common::SongInfo info;
-        info.id = nextId++;
-        info.title = f.name;
-        info.durationSeconds = 180U;
-        outTracks.push_back(std::move(info));
+        outTracks.Add(nextId++, f.name, 180U);
     }
 
     return Common::AppError::Ok;
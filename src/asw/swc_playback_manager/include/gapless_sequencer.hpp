@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app_error_codes.hpp"
+#include "app_types.hpp"
+#include "gapless_pcm_source.hpp"
+#include "pcm_types.hpp"
+#include "playlist.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playback {
+
+/**
+ * @brief Opens the decoder of a song, e.g. a WavReader on its file
+ */
+class ITrackOpener {
+public:
+    virtual ~ITrackOpener() = default;
+
+    /**
+     * @param[out] source Valid until passed to Close()
+     */
+    virtual Common::AppError Open(Common::SongId song, Bsw::Audio::IPcmSource*& source) = 0;
+    virtual void Close(Bsw::Audio::IPcmSource& source) = 0;
+};
+
+/**
+ * @brief Gapless playback of the playlist in its playback order
+ *
+ * Begin() opens the playlist's current song and the one PeekNext() names,
+ * and chains them in a GaplessPcmSource that feeds the PcmStreamEngine.
+ * The engine then runs through every track change: MainFunction(), called
+ * cyclically, notices when the stream has moved on, advances the playlist
+ * to the song now playing, closes the finished track and opens and queues
+ * the following one. A track is thus queued (and pre-rolled by the decoder
+ * thread) a whole track ahead, so the cycle time only has to be shorter
+ * than the shortest track.
+ *
+ * The playback state machine is not involved: Play/Pause/Stop act on the
+ * engine as before, and a track change no longer costs a Stop/Start. A
+ * manual skip is Stop, Begin(), Play.
+ *
+ * @tparam PlaylistT Playlist or StaticPlaylist
+ */
+template <typename PlaylistT>
+class BasicGaplessSequencer {
+public:
+    BasicGaplessSequencer(PlaylistT& playlist, ITrackOpener& opener, Bsw::Audio::GaplessPcmSource& stream)
+        : playlist_(playlist), opener_(opener), stream_(stream) {}
+
+    ~BasicGaplessSequencer();
+
+    BasicGaplessSequencer(const BasicGaplessSequencer&) = delete;
+    BasicGaplessSequencer& operator=(const BasicGaplessSequencer&) = delete;
+    BasicGaplessSequencer(BasicGaplessSequencer&&) = delete;
+    BasicGaplessSequencer& operator=(BasicGaplessSequencer&&) = delete;
+
+    /**
+     * @brief Start the chain at the current song; only while the engine is
+     *        stopped
+     * @return NotFound without a current song, else the opener's error
+     */
+    Common::AppError Begin();
+
+    /**
+     * @brief Close every track; only while the engine is stopped
+     */
+    void End();
+
+    void MainFunction();
+
+    /**
+     * @brief Song the decoder is on (0 before Begin())
+     */
+    [[nodiscard]] Common::SongId DecodingSong() const noexcept {
+        return playingId_;
+    }
+
+    [[nodiscard]] Common::SongId QueuedSong() const noexcept {
+        return queuedId_;
+    }
+
+    /**
+     * @brief Songs that could not be opened; playback ends before them
+     */
+    [[nodiscard]] std::uint64_t OpenFailures() const noexcept {
+        return openFailures_;
+    }
+
+private:
+    void QueueFollowing();
+
+    PlaylistT& playlist_;
+    ITrackOpener& opener_;
+    Bsw::Audio::GaplessPcmSource& stream_;
+
+    Bsw::Audio::IPcmSource* playing_{nullptr};
+    Bsw::Audio::IPcmSource* queued_{nullptr};
+    Common::SongId playingId_{0U};
+    Common::SongId queuedId_{0U};
+    std::uint64_t seenTransitions_{0U};
+    std::uint64_t openFailures_{0U};
+};
+
+using GaplessSequencer = BasicGaplessSequencer<Asw::Playlist::Playlist>;
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <typename PlaylistT>
+BasicGaplessSequencer<PlaylistT>::~BasicGaplessSequencer() {
+    End();
+}
+
+template <typename PlaylistT>
+Common::AppError BasicGaplessSequencer<PlaylistT>::Begin() {
+    End();
+    const auto current = playlist_.GetCurrentSong();
+    if (!current) {
+        return Common::AppError::NotFound;
+    }
+
+    Bsw::Audio::IPcmSource* source = nullptr;
+    const Common::AppError result = opener_.Open(current->id, source);
+    if (result != Common::AppError::Ok) {
+        return result;
+    }
+    playing_ = source;
+    playingId_ = current->id;
+    stream_.Begin(*source);
+    seenTransitions_ = stream_.Transitions();
+    QueueFollowing();
+    return Common::AppError::Ok;
+}
+
+template <typename PlaylistT>
+void BasicGaplessSequencer<PlaylistT>::End() {
+    stream_.End();
+    for (Bsw::Audio::IPcmSource** track : {&queued_, &playing_}) {
+        if (*track != nullptr) {
+            opener_.Close(**track);
+            *track = nullptr;
+        }
+    }
+    playingId_ = 0U;
+    queuedId_ = 0U;
+}
+
+template <typename PlaylistT>
+void BasicGaplessSequencer<PlaylistT>::MainFunction() {
+    // One track is queued at a time, so the stream moves on at most once
+    // between two calls.
+    const std::uint64_t transitions = stream_.Transitions();
+    if (transitions == seenTransitions_ || queued_ == nullptr) {
+        return;
+    }
+    seenTransitions_ = transitions;
+
+    opener_.Close(*playing_);
+    playing_ = queued_;
+    playingId_ = queuedId_;
+    queued_ = nullptr;
+    queuedId_ = 0U;
+
+    // Next() keeps a shuffle order's position; if the playlist was edited
+    // meanwhile, fall back to selecting the song that is actually playing.
+    const auto current = playlist_.Next() == Common::AppError::Ok ? playlist_.GetCurrentSong() : std::nullopt;
+    if (!current || current->id != playingId_) {
+        (void)playlist_.SetCurrentSong(playingId_);
+    }
+    QueueFollowing();
+}
+
+template <typename PlaylistT>
+void BasicGaplessSequencer<PlaylistT>::QueueFollowing() {
+    // PeekNext() names the song Next() would pick; a song that cannot be
+    // opened is not skipped over here, the chain just ends after this one.
+    const auto next = playlist_.PeekNext();
+    if (!next) {
+        return;
+    }
+    Bsw::Audio::IPcmSource* source = nullptr;
+    if (opener_.Open(next->id, source) != Common::AppError::Ok) {
+        ++openFailures_;
+        return;
+    }
+    if (stream_.QueueNext(*source) != Common::AppError::Ok) {
+        opener_.Close(*source);
+        return;
+    }
+    queued_ = source;
+    queuedId_ = next->id;
+}
+
+extern template class BasicGaplessSequencer<Asw::Playlist::Playlist>;
+extern template class BasicGaplessSequencer<Asw::Playlist::StaticPlaylist>;
+
+} // namespace AutosarMusicPlayer::Asw::Playback
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Com_Cfg.h"
+#include "com_rx.hpp"
+#include "playback_manager.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playback {
+
+/**
+ * @brief Turns received CAN signals into playback commands
+ *
+ * Steering-wheel button frames repeat while a button is held, so a command
+ * is issued on the press only (the value changing to a button). Switching
+ * the ignition off stops playback. Runs on the task calling
+ * ComRx::MainFunctionRx().
+ *
+ * @tparam Manager BasicPlaybackManager with any RTE binding
+ */
+template <typename Manager>
+class BasicPlaybackCommandReceiver final : public Bsw::Com::IComRxListener {
+public:
+    explicit BasicPlaybackCommandReceiver(Manager& manager) : manager_(manager) {}
+
+    void OnSignalReceived(Bsw::Com::SignalId signal, std::uint32_t value) override {
+        if (signal == Com_Cfg::kSigMediaButton) {
+            OnMediaButton(value);
+        } else if (signal == Com_Cfg::kSigIgnitionOn) {
+            const bool on = value != 0U;
+            if (ignitionOn_ && !on) {
+                Issue(manager_.Stop());
+            }
+            ignitionOn_ = on;
+        }
+    }
+
+    /**
+     * @brief Commands issued so far, and how many the state machine refused
+     */
+    [[nodiscard]] std::uint64_t CommandsIssued() const noexcept {
+        return commandsIssued_;
+    }
+
+    [[nodiscard]] std::uint64_t CommandsRejected() const noexcept {
+        return commandsRejected_;
+    }
+
+private:
+    void OnMediaButton(std::uint32_t value) {
+        if (value == lastButton_) {
+            return;
+        }
+        lastButton_ = value;
+
+        switch (static_cast<Com_Cfg::SteeringWheelButton>(value)) {
+        case Com_Cfg::SteeringWheelButton::Play: Issue(manager_.Play()); break;
+        case Com_Cfg::SteeringWheelButton::Pause: Issue(manager_.Pause()); break;
+        case Com_Cfg::SteeringWheelButton::Stop: Issue(manager_.Stop()); break;
+        default: break;
+        }
+    }
+
+    void Issue(Common::AppError result) noexcept {
+        ++commandsIssued_;
+        if (result != Common::AppError::Ok) {
+            ++commandsRejected_;
+        }
+    }
+
+    Manager& manager_;
+    std::uint32_t lastButton_{0U};
+    bool ignitionOn_{false};
+    std::uint64_t commandsIssued_{0U};
+    std::uint64_t commandsRejected_{0U};
+};
+
+using PlaybackCommandReceiver = BasicPlaybackCommandReceiver<PlaybackManager>;
+
+extern template class BasicPlaybackCommandReceiver<PlaybackManager>;
+
+} // namespace AutosarMusicPlayer::Asw::Playback
@@ -1,30 +1,52 @@
 #pragma once
 
-#include <memory>
-
 #include "Rte_MusicPlayerApp.h"
 #include "audio_codec.hpp"
 #include "app_error_codes.hpp"
+#include "playback_state_machine.hpp"
 
 namespace AutosarMusicPlayer::Asw::Playback {
 
-class PlaybackStateMachine;
-
-class PlaybackManager {
+/**
+ * @brief Playback manager SW-C
+ *
+ * @tparam RtePort RTE binding, see BasicPlaybackStateMachine
+ */
+template <typename RtePort>
+class BasicPlaybackManager {
 public:
-    PlaybackManager(Bsw::Hal::IAudioCodec& codec, Rte::IRteMusicPlayerApp* rte);
-    ~PlaybackManager();
+    BasicPlaybackManager(Bsw::Hal::IAudioCodec& codec, RtePort rte) : sm_(codec, rte) {}
+
+    [[nodiscard]] Common::AppError Play() {
+        return sm_.Play();
+    }
+
+    [[nodiscard]] Common::AppError Pause() {
+        return sm_.Pause();
+    }
 
-    [[nodiscard]] Common::AppError Play();
-    [[nodiscard]] Common::AppError Pause();
-    [[nodiscard]] Common::AppError Stop();
+    [[nodiscard]] Common::AppError Stop() {
+        return sm_.Stop();
+    }
 
-    [[nodiscard]] const char* StateName() const;
+    [[nodiscard]] const char* StateName() const {
+        return sm_.StateName();
+    }
+
+    [[nodiscard]] Rte_PlaybackStateType State() const {
+        return sm_.State();
+    }
+
+    [[nodiscard]] Rte_SequenceCounterType Sequence() const noexcept {
+        return sm_.Sequence();
+    }
 
 private:
-    Bsw::Hal::IAudioCodec& codec_;
-    Rte::IRteMusicPlayerApp* rte_;
-    std::unique_ptr<PlaybackStateMachine> sm_;
+    BasicPlaybackStateMachine<RtePort> sm_;
 };
 
+using PlaybackManager = BasicPlaybackManager<Rte::VirtualRtePort>;
+
+extern template class BasicPlaybackManager<Rte::VirtualRtePort>;
+
 } // namespace AutosarMusicPlayer::Asw::Playback
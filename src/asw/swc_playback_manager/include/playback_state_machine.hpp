@@ -5,30 +5,110 @@
 #include "Rte_MusicPlayerApp.h"
 #include "audio_codec.hpp"
 #include "app_error_codes.hpp"
+#include "states/playback_state.hpp"
 
 namespace AutosarMusicPlayer::Asw::Playback {
 
-class PlaybackState;
-
-class PlaybackStateMachine {
+/**
+ * @brief Codec and current state: what the states act on
+ *
+ * Independent of the RTE binding, so the states are compiled only once.
+ */
+class PlaybackStateContext {
 public:
-    PlaybackStateMachine(Bsw::Hal::IAudioCodec& codec, Rte::IRteMusicPlayerApp* rte);
+    PlaybackStateContext(const PlaybackStateContext&) = delete;
+    PlaybackStateContext& operator=(const PlaybackStateContext&) = delete;
+    PlaybackStateContext(PlaybackStateContext&&) = delete;
+    PlaybackStateContext& operator=(PlaybackStateContext&&) = delete;
 
-    [[nodiscard]] Common::AppError Play();
-    [[nodiscard]] Common::AppError Pause();
-    [[nodiscard]] Common::AppError Stop();
+    [[nodiscard]] const char* StateName() const {
+        return state_->Name();
+    }
 
-    [[nodiscard]] const char* StateName() const;
+    [[nodiscard]] Rte_PlaybackStateType State() const {
+        return state_->Id();
+    }
 
     void TransitionTo(std::unique_ptr<PlaybackState> next);
 
     [[nodiscard]] Bsw::Hal::IAudioCodec& Codec();
-    [[nodiscard]] Rte::IRteMusicPlayerApp* RteIf();
+
+protected:
+    using Command = Common::AppError (PlaybackState::*)(PlaybackStateContext&);
+
+    explicit PlaybackStateContext(Bsw::Hal::IAudioCodec& codec);
+    ~PlaybackStateContext();
+
+    /**
+     * @brief Run @p command on the current state
+     * @param[out] changed Whether the state is a different one afterwards
+     */
+    Common::AppError Execute(Command command, bool& changed);
 
 private:
     Bsw::Hal::IAudioCodec& codec_;
-    Rte::IRteMusicPlayerApp* rte_;
     std::unique_ptr<PlaybackState> state_;
 };
 
+/**
+ * @brief Playback state machine sending its state through @p RtePort
+ *
+ * @tparam RtePort Rte::VirtualRtePort (runtime binding, nullable) or
+ *         Rte::StaticRtePort<Impl> (compile-time binding, direct calls)
+ */
+template <typename RtePort>
+class BasicPlaybackStateMachine final : public PlaybackStateContext {
+public:
+    BasicPlaybackStateMachine(Bsw::Hal::IAudioCodec& codec, RtePort rte)
+        : PlaybackStateContext(codec), rte_(rte) {
+        NotifyState();
+    }
+
+    [[nodiscard]] Common::AppError Play() {
+        return Run(&PlaybackState::Play);
+    }
+
+    [[nodiscard]] Common::AppError Pause() {
+        return Run(&PlaybackState::Pause);
+    }
+
+    [[nodiscard]] Common::AppError Stop() {
+        return Run(&PlaybackState::Stop);
+    }
+
+    /**
+     * @brief Number of state transitions so far; the sequence number of the
+     *        last RTE notification
+     */
+    [[nodiscard]] Rte_SequenceCounterType Sequence() const noexcept {
+        return sequence_;
+    }
+
+private:
+    /**
+     * @brief Run @p command and notify the RTE if, and only if, the state
+     *        changed
+     */
+    Common::AppError Run(Command command) {
+        bool changed = false;
+        const auto res = Execute(command, changed);
+        if (changed) {
+            ++sequence_;
+            NotifyState();
+        }
+        return res;
+    }
+
+    void NotifyState() {
+        rte_.NotifyPlaybackStateChanged(State(), sequence_);
+    }
+
+    RtePort rte_;
+    Rte_SequenceCounterType sequence_{0U};
+};
+
+using PlaybackStateMachine = BasicPlaybackStateMachine<Rte::VirtualRtePort>;
+
+extern template class BasicPlaybackStateMachine<Rte::VirtualRtePort>;
+
 } // namespace AutosarMusicPlayer::Asw::Playback
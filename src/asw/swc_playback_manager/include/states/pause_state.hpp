@@ -7,10 +7,11 @@ namespace AutosarMusicPlayer::Asw::Playback {
 class PauseState final : public PlaybackState {
 public:
     const char* Name() const override { return "Paused"; }
+    Rte_PlaybackStateType Id() const override { return Rte_PlaybackStateType::Paused; }
 
-    Common::AppError Play(PlaybackStateMachine& sm) override;
-    Common::AppError Pause(PlaybackStateMachine& sm) override;
-    Common::AppError Stop(PlaybackStateMachine& sm) override;
+    Common::AppError Play(PlaybackStateContext& sm) override;
+    Common::AppError Pause(PlaybackStateContext& sm) override;
+    Common::AppError Stop(PlaybackStateContext& sm) override;
 };
 
 } // namespace AutosarMusicPlayer::Asw::Playback
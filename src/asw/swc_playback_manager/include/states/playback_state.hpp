@@ -1,20 +1,22 @@
 #pragma once
 
+#include "Rte_Type.h"
 #include "app_error_codes.hpp"
 
 namespace AutosarMusicPlayer::Asw::Playback {
 
-class PlaybackStateMachine;
+class PlaybackStateContext;
 
 class PlaybackState {
 public:
     virtual ~PlaybackState() = default;
 
     virtual const char* Name() const = 0;
+    virtual Rte_PlaybackStateType Id() const = 0;
 
-    virtual Common::AppError Play(PlaybackStateMachine& sm) = 0;
-    virtual Common::AppError Pause(PlaybackStateMachine& sm) = 0;
-    virtual Common::AppError Stop(PlaybackStateMachine& sm) = 0;
+    virtual Common::AppError Play(PlaybackStateContext& sm) = 0;
+    virtual Common::AppError Pause(PlaybackStateContext& sm) = 0;
+    virtual Common::AppError Stop(PlaybackStateContext& sm) = 0;
 };
 
 } // namespace AutosarMusicPlayer::Asw::Playback
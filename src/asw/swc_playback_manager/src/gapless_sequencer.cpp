@@ -0,0 +1,8 @@
+#include "gapless_sequencer.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playback {
+
+template class BasicGaplessSequencer<Asw::Playlist::Playlist>;
+template class BasicGaplessSequencer<Asw::Playlist::StaticPlaylist>;
+
+} // namespace AutosarMusicPlayer::Asw::Playback
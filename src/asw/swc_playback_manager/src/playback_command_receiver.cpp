@@ -0,0 +1,7 @@
+#include "playback_command_receiver.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playback {
+
+template class BasicPlaybackCommandReceiver<PlaybackManager>;
+
+} // namespace AutosarMusicPlayer::Asw::Playback
@@ -6,56 +6,33 @@
 
 namespace AutosarMusicPlayer::Asw::Playback {
 
-PlaybackStateMachine::PlaybackStateMachine(Bsw::Hal::IAudioCodec& codec, Rte::IRteMusicPlayerApp* rte)
-    : codec_(codec), rte_(rte), state_(std::make_unique<StopState>()) {
-    if (rte_ != nullptr) {
-        rte_->NotifyPlaybackStateChanged(state_->Name());
-    }
-}
+PlaybackStateContext::PlaybackStateContext(Bsw::Hal::IAudioCodec& codec)
+    : codec_(codec), state_(std::make_unique<StopState>()) {}
 
-Common::AppError PlaybackStateMachine::Play() {
-    const auto res = state_->Play(*this);
-    if (rte_ != nullptr) {
-        rte_->NotifyPlaybackStateChanged(state_->Name());
-    }
-    return res;
-}
+PlaybackStateContext::~PlaybackStateContext() = default;
 
-Common::AppError PlaybackStateMachine::Pause() {
-    const auto res = state_->Pause(*this);
-    if (rte_ != nullptr) {
-        rte_->NotifyPlaybackStateChanged(state_->Name());
-    }
+Common::AppError PlaybackStateContext::Execute(Command command, bool& changed) {
+    // No-op commands (Play while playing) and failed codec calls leave the
+    // state as it was.
+    const Rte_PlaybackStateType before = state_->Id();
+    const auto res = (state_.get()->*command)(*this);
+    changed = state_->Id() != before;
     return res;
 }
 
-Common::AppError PlaybackStateMachine::Stop() {
-    const auto res = state_->Stop(*this);
-    if (rte_ != nullptr) {
-        rte_->NotifyPlaybackStateChanged(state_->Name());
-    }
-    return res;
-}
-
-const char* PlaybackStateMachine::StateName() const {
-    return state_->Name();
-}
-
-void PlaybackStateMachine::TransitionTo(std::unique_ptr<PlaybackState> next) {
+void PlaybackStateContext::TransitionTo(std::unique_ptr<PlaybackState> next) {
     state_ = std::move(next);
 }
 
-Bsw::Hal::IAudioCodec& PlaybackStateMachine::Codec() {
+Bsw::Hal::IAudioCodec& PlaybackStateContext::Codec() {
     return codec_;
 }
 
-Rte::IRteMusicPlayerApp* PlaybackStateMachine::RteIf() {
-    return rte_;
-}
+template class BasicPlaybackStateMachine<Rte::VirtualRtePort>;
 
 // --- State implementations ---
 
-Common::AppError StopState::Play(PlaybackStateMachine& sm) {
+Common::AppError StopState::Play(PlaybackStateContext& sm) {
     const auto res = sm.Codec().Start();
     if (res == Common::AppError::Ok) {
         sm.TransitionTo(std::make_unique<PlayState>());
@@ -63,19 +40,19 @@ Common::AppError StopState::Play(PlaybackStateMachine& sm) {
     return res;
 }
 
-Common::AppError StopState::Pause(PlaybackStateMachine&) {
+Common::AppError StopState::Pause(PlaybackStateContext&) {
     return Common::AppError::InvalidArgument;
 }
 
-Common::AppError StopState::Stop(PlaybackStateMachine&) {
+Common::AppError StopState::Stop(PlaybackStateContext&) {
     return Common::AppError::Ok;
 }
 
-Common::AppError PlayState::Play(PlaybackStateMachine&) {
+Common::AppError PlayState::Play(PlaybackStateContext&) {
     return Common::AppError::Ok;
 }
 
-Common::AppError PlayState::Pause(PlaybackStateMachine& sm) {
+Common::AppError PlayState::Pause(PlaybackStateContext& sm) {
     const auto res = sm.Codec().Pause();
     if (res == Common::AppError::Ok) {
         sm.TransitionTo(std::make_unique<PauseState>());
@@ -83,7 +60,7 @@ Common::AppError PlayState::Pause(PlaybackStateMachine& sm) {
     return res;
 }
 
-Common::AppError PlayState::Stop(PlaybackStateMachine& sm) {
+Common::AppError PlayState::Stop(PlaybackStateContext& sm) {
     const auto res = sm.Codec().Stop();
     if (res == Common::AppError::Ok) {
         sm.TransitionTo(std::make_unique<StopState>());
@@ -91,7 +68,7 @@ Common::AppError PlayState::Stop(PlaybackStateMachine& sm) {
     return res;
 }
 
-Common::AppError PauseState::Play(PlaybackStateMachine& sm) {
+Common::AppError PauseState::Play(PlaybackStateContext& sm) {
     const auto res = sm.Codec().Start();
     if (res == Common::AppError::Ok) {
         sm.TransitionTo(std::make_unique<PlayState>());
@@ -99,11 +76,11 @@ Common::AppError PauseState::Play(PlaybackStateMachine& sm) {
     return res;
 }
 
-Common::AppError PauseState::Pause(PlaybackStateMachine&) {
+Common::AppError PauseState::Pause(PlaybackStateContext&) {
     return Common::AppError::Ok;
 }
 
-Common::AppError PauseState::Stop(PlaybackStateMachine& sm) {
+Common::AppError PauseState::Stop(PlaybackStateContext& sm) {
     const auto res = sm.Codec().Stop();
     if (res == Common::AppError::Ok) {
         sm.TransitionTo(std::make_unique<StopState>());
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "playlist_storage_policy.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Storage slots in playlist order, with removal that does not shift
+ *
+ * Slots sit in a flat array in playlist order. Removing a song leaves a
+ * tombstone in its entry instead of moving the entries behind it; a Fenwick
+ * tree over the array counts the live entries, which maps a position to its
+ * slot and a slot to its position in O(log n). While there are no
+ * tombstones both lookups are plain array reads.
+ *
+ * The two ends of each run of tombstones hold the index of the other end,
+ * so Next/Previous step over a run in O(1), as in BasicShuffleOrder.
+ *
+ * Tombstones are compacted away once they outnumber the live entries, so a
+ * removal is O(log n) amortized, and before an insertion in the middle,
+ * which moves entries anyway.
+ *
+ * @tparam Policy Storage policy (see playlist_storage_policy.hpp)
+ */
+template <typename Policy>
+class BasicPlayOrder {
+public:
+    static constexpr std::uint32_t kNone = 0xFFFFFFFFU;
+
+    void Reserve(std::size_t count) {
+        entries_.reserve(count);
+        tree_.reserve(count);
+        positions_.reserve(count);
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return entries_.size() - tombstones_;
+    }
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return Size() == 0U;
+    }
+
+    /**
+     * @brief Slot at @p position; @pre position < Size()
+     */
+    [[nodiscard]] std::uint32_t At(std::size_t position) const noexcept {
+        return entries_[EntryAt(position)];
+    }
+
+    /**
+     * @brief Position of @p slot; @pre slot is in the order
+     */
+    [[nodiscard]] std::size_t PositionOf(std::uint32_t slot) const noexcept {
+        const std::size_t entry = positions_[slot];
+        return tombstones_ == 0U ? entry : LiveBefore(entry);
+    }
+
+    /**
+     * @brief Slot after @p slot, or kNone at the end of the order
+     */
+    [[nodiscard]] std::uint32_t Next(std::uint32_t slot) const noexcept {
+        return LiveFrom(static_cast<std::size_t>(positions_[slot]) + 1U);
+    }
+
+    /**
+     * @brief Slot before @p slot, or kNone at the start of the order
+     */
+    [[nodiscard]] std::uint32_t Previous(std::uint32_t slot) const noexcept {
+        return LiveUpTo(positions_[slot]);
+    }
+
+    [[nodiscard]] std::uint32_t First() const noexcept {
+        return LiveFrom(0U);
+    }
+
+    [[nodiscard]] std::uint32_t Last() const noexcept {
+        return LiveUpTo(entries_.size());
+    }
+
+    /**
+     * @pre @p slot is not in the order and slot < Policy::kCapacity
+     */
+    void PushBack(std::uint32_t slot);
+
+    /**
+     * @brief Undo the last PushBack; @pre no removal since
+     */
+    void PopBack();
+
+    /**
+     * @brief Move the last @p count slots in front of @p position
+     */
+    void MoveTailTo(std::size_t position, std::size_t count);
+
+    /**
+     * @brief Remove @p count slots starting at @p position
+     */
+    void Erase(std::size_t position, std::size_t count);
+
+    void Clear() noexcept;
+
+    /**
+     * @brief Visit the slots at positions [position, position + count)
+     */
+    template <typename Fn>
+    void ForEachInRange(std::size_t position, std::size_t count, Fn&& fn) const {
+        for (std::size_t entry = EntryAt(position); count > 0U; ++entry) {
+            if (IsTombstone(entries_[entry])) {
+                entry = OtherEnd(entries_[entry]);
+            } else {
+                fn(entries_[entry]);
+                --count;
+            }
+        }
+    }
+
+    template <typename Fn>
+    void ForEach(Fn&& fn) const {
+        for (const std::uint32_t slot : entries_) {
+            if (!IsTombstone(slot)) {
+                fn(slot);
+            }
+        }
+    }
+
+private:
+    template <typename T>
+    using Array = typename Policy::template Vector<T, Policy::kCapacity>;
+
+    // A tombstone at either end of a run holds the entry index of the
+    // other end; inside a run the index is stale.
+    static constexpr std::uint32_t kTombstone = 0x80000000U;
+
+    static constexpr bool IsTombstone(std::uint32_t value) noexcept {
+        return (value & kTombstone) != 0U;
+    }
+
+    static constexpr std::size_t OtherEnd(std::uint32_t value) noexcept {
+        return value & ~kTombstone;
+    }
+
+    static constexpr std::size_t LowBit(std::size_t value) noexcept {
+        return value & (~value + 1U);
+    }
+
+    // First live slot at or after @p entry, or kNone.
+    [[nodiscard]] std::uint32_t LiveFrom(std::size_t entry) const noexcept;
+
+    // Last live slot before @p entry, or kNone.
+    [[nodiscard]] std::uint32_t LiveUpTo(std::size_t entry) const noexcept;
+
+    // Number of live entries in [0, entry).
+    [[nodiscard]] std::size_t LiveBefore(std::size_t entry) const noexcept;
+
+    // Entry holding the live slot at @p position.
+    [[nodiscard]] std::size_t EntryAt(std::size_t position) const noexcept;
+
+    void Bury(std::size_t entry) noexcept;
+    void Compact();
+
+    Array<std::uint32_t> entries_;   ///< Slot or tombstone, in playlist order
+    Array<std::uint32_t> tree_;      ///< Fenwick tree of live entry counts
+    Array<std::uint32_t> positions_; ///< Entry index, by slot
+    std::size_t tombstones_{0U};
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::PushBack(std::uint32_t slot) {
+    // Inline storage has room for kCapacity entries, tombstones included.
+    if (!Policy::kGrowable && entries_.size() == Policy::kCapacity) {
+        Compact();
+    }
+
+    if (slot >= positions_.size()) {
+        positions_.resize(static_cast<std::size_t>(slot) + 1U);
+    }
+    positions_[slot] = static_cast<std::uint32_t>(entries_.size());
+
+    // The new node covers entries (k - LowBit(k), k]; add up the nodes below it.
+    const std::size_t k = entries_.size() + 1U;
+    std::uint32_t count = 1U;
+    for (std::size_t child = k - 1U; child > k - LowBit(k); child -= LowBit(child)) {
+        count += tree_[child - 1U];
+    }
+    entries_.push_back(slot);
+    tree_.push_back(count);
+}
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::PopBack() {
+    entries_.pop_back();
+    tree_.pop_back();
+}
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::MoveTailTo(std::size_t position, std::size_t count) {
+    if (position + count == Size()) {
+        return;
+    }
+
+    if (tombstones_ != 0U) {
+        Compact();
+    }
+
+    // Every entry is live, so the tree (all ones) is unaffected.
+    std::rotate(entries_.begin() + static_cast<std::ptrdiff_t>(position),
+                entries_.end() - static_cast<std::ptrdiff_t>(count), entries_.end());
+    for (std::size_t entry = position; entry < entries_.size(); ++entry) {
+        positions_[entries_[entry]] = static_cast<std::uint32_t>(entry);
+    }
+}
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::Erase(std::size_t position, std::size_t count) {
+    // Entries inside a run may hold stale ends, so this walk checks every
+    // entry instead of jumping over runs.
+    for (std::size_t entry = EntryAt(position); count > 0U; ++entry) {
+        if (IsTombstone(entries_[entry])) {
+            continue;
+        }
+        Bury(entry);
+        for (std::size_t k = entry + 1U; k <= tree_.size(); k += LowBit(k)) {
+            --tree_[k - 1U];
+        }
+        ++tombstones_;
+        --count;
+    }
+
+    if (tombstones_ > Size()) {
+        Compact();
+    }
+}
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::Clear() noexcept {
+    entries_.clear();
+    tree_.clear();
+    positions_.clear();
+    tombstones_ = 0U;
+}
+
+template <typename Policy>
+std::uint32_t BasicPlayOrder<Policy>::LiveFrom(std::size_t entry) const noexcept {
+    if (entry < entries_.size() && IsTombstone(entries_[entry])) {
+        // @p entry follows a live entry (or is 0), so it starts its run.
+        entry = OtherEnd(entries_[entry]) + 1U;
+    }
+    return entry < entries_.size() ? entries_[entry] : kNone;
+}
+
+template <typename Policy>
+std::uint32_t BasicPlayOrder<Policy>::LiveUpTo(std::size_t entry) const noexcept {
+    if (entry == 0U) {
+        return kNone;
+    }
+    --entry;
+    if (IsTombstone(entries_[entry])) {
+        // @p entry precedes a live entry (or is the last), so it ends its run.
+        entry = OtherEnd(entries_[entry]);
+        if (entry == 0U) {
+            return kNone;
+        }
+        --entry;
+    }
+    return entries_[entry];
+}
+
+template <typename Policy>
+std::size_t BasicPlayOrder<Policy>::LiveBefore(std::size_t entry) const noexcept {
+    std::size_t live = 0U;
+    for (std::size_t k = entry; k > 0U; k -= LowBit(k)) {
+        live += tree_[k - 1U];
+    }
+    return live;
+}
+
+template <typename Policy>
+std::size_t BasicPlayOrder<Policy>::EntryAt(std::size_t position) const noexcept {
+    if (tombstones_ == 0U) {
+        return position;
+    }
+
+    // Descend to the longest prefix holding at most @p position live entries;
+    // the entry right after it is the one wanted.
+    std::size_t step = 1U;
+    while (step * 2U <= tree_.size()) {
+        step *= 2U;
+    }
+    std::size_t prefix = 0U;
+    std::size_t remaining = position;
+    for (; step > 0U; step /= 2U) {
+        if (prefix + step <= tree_.size() && tree_[prefix + step - 1U] <= remaining) {
+            prefix += step;
+            remaining -= tree_[prefix - 1U];
+        }
+    }
+    return prefix;
+}
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::Bury(std::size_t entry) noexcept {
+    // Join the runs on either side, if any; their facing ends are run ends.
+    std::size_t first = entry;
+    std::size_t last = entry;
+    if (entry > 0U && IsTombstone(entries_[entry - 1U])) {
+        first = OtherEnd(entries_[entry - 1U]);
+    }
+    if (entry + 1U < entries_.size() && IsTombstone(entries_[entry + 1U])) {
+        last = OtherEnd(entries_[entry + 1U]);
+    }
+    entries_[entry] = kTombstone;
+    entries_[first] = kTombstone | static_cast<std::uint32_t>(last);
+    entries_[last] = kTombstone | static_cast<std::uint32_t>(first);
+}
+
+template <typename Policy>
+void BasicPlayOrder<Policy>::Compact() {
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(), IsTombstone), entries_.end());
+    tree_.resize(entries_.size());
+    for (std::size_t entry = 0U; entry < entries_.size(); ++entry) {
+        positions_[entries_[entry]] = static_cast<std::uint32_t>(entry);
+        tree_[entry] = static_cast<std::uint32_t>(LowBit(entry + 1U));
+    }
+    tombstones_ = 0U;
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -1,53 +1,815 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-#include <memory>
+#include <cstdint>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "app_error_codes.hpp"
 #include "app_types.hpp"
+#include "playlist_fwd.hpp"
+#include "playlist_observer.hpp"
+#include "play_order.hpp"
+#include "playlist_storage_policy.hpp"
+#include "shuffle_order.hpp"
+#include "song_index.hpp"
+#include "song_storage.hpp"
+#include "track_list.hpp"
 
 namespace AutosarMusicPlayer::Asw::Playlist {
 
-class IPlaylistObserver;
+/**
+ * @brief Order in which Next/Previous walk the playlist
+ */
+enum class PlaybackOrder : std::uint8_t {
+    Sequential, ///< Playlist order
+    Shuffle,    ///< Seeded random permutation (see SetShuffleSeed)
+};
+
+/**
+ * @brief What Next/Previous do at the end of the order
+ */
+enum class RepeatMode : std::uint8_t {
+    Off, ///< Stop at the last (or first) song
+    All, ///< Wrap around
+};
 
-class Playlist {
+/**
+ * @brief Ordered song collection with current-song selection (Model in MVC)
+ *
+ * Capacity and allocation behaviour come from the storage policy:
+ * - Playlist (DynamicCapacity) grows on the heap up to kMaxLibrarySize songs
+ * - StaticPlaylist (FixedCapacity) keeps every record, title and index
+ *   bucket inline and never allocates
+ * Both share this implementation and API.
+ *
+ * Navigation: Next/Previous move the current song in playlist order or in
+ * a shuffle order kept alongside it, both in O(1), also right after
+ * removals. The shuffle order is a
+ * random permutation that new songs are spliced into and removed songs
+ * are unlinked from, so edits never reshuffle the rest. When the current
+ * song is removed, the song that followed it in the active order becomes
+ * current (wrapping to the start), so a non-empty playlist always has a
+ * current song.
+ *
+ * @tparam Policy Storage policy (see playlist_storage_policy.hpp)
+ */
+template <typename Policy>
+class BasicPlaylist {
 public:
-    Playlist() = default;
+    using StoragePolicy = Policy;
+
+    /**
+     * @param maxSongs Upper bound on the number of songs (AddSong returns Busy
+     *                 beyond it); clamped to Policy::kCapacity
+     */
+    explicit BasicPlaylist(std::size_t maxSongs = Policy::kCapacity);
 
     [[nodiscard]] Common::AppError AddSong(Common::SongInfo song);
+    [[nodiscard]] Common::AppError AddSong(Common::SongInfo song, SongHandle& outHandle);
     [[nodiscard]] Common::AppError RemoveSong(Common::SongId id);
     [[nodiscard]] Common::AppError Clear();
 
+    /**
+     * @brief Add a range of songs as one transaction
+     *
+     * Either every song is added or, on the first invalid/duplicate id or if
+     * the range does not fit, none is. Storage is reserved once and observers
+     * see a single OnPlaylistChanged.
+     */
+    [[nodiscard]] Common::AppError AddSongs(const std::vector<Common::SongInfo>& songs);
+    [[nodiscard]] Common::AppError AddSongs(const Common::TrackList& tracks);
+
+    /**
+     * @brief Insert a range of songs before @p position, same rules as AddSongs
+     */
+    [[nodiscard]] Common::AppError InsertSongs(std::size_t position, const std::vector<Common::SongInfo>& songs);
+    [[nodiscard]] Common::AppError InsertSongs(std::size_t position, const Common::TrackEntry* tracks,
+                                               std::size_t count);
+
+    /**
+     * @brief Remove @p count songs starting at @p position
+     */
+    [[nodiscard]] Common::AppError RemoveRange(std::size_t position, std::size_t count);
+
+    /**
+     * @brief Replace title/duration of the songs starting at @p position
+     *
+     * Ids must match the songs already at those positions; handles stay valid.
+     */
+    [[nodiscard]] Common::AppError UpdateSongs(std::size_t position, const std::vector<Common::SongInfo>& songs);
+    [[nodiscard]] Common::AppError UpdateSongs(std::size_t position, const Common::TrackEntry* tracks,
+                                               std::size_t count);
+
+    /**
+     * @brief Defer observer notifications until the matching EndUpdate
+     *
+     * Calls nest. While an update is open, any number of mutations result in
+     * at most one OnPlaylistChanged and one OnSongChanged (only if the current
+     * song differs from the one at the outermost BeginUpdate). Range events
+     * are not deferred.
+     */
+    void BeginUpdate() noexcept;
+    void EndUpdate();
+
+    /**
+     * @brief RAII wrapper around BeginUpdate/EndUpdate
+     */
+    class UpdateScope {
+    public:
+        explicit UpdateScope(BasicPlaylist& playlist) noexcept : playlist_(playlist) {
+            playlist_.BeginUpdate();
+        }
+        ~UpdateScope() {
+            playlist_.EndUpdate();
+        }
+
+        UpdateScope(const UpdateScope&) = delete;
+        UpdateScope& operator=(const UpdateScope&) = delete;
+        UpdateScope(UpdateScope&&) = delete;
+        UpdateScope& operator=(UpdateScope&&) = delete;
+
+    private:
+        BasicPlaylist& playlist_;
+    };
+
     [[nodiscard]] std::size_t Size() const noexcept;
+    [[nodiscard]] std::size_t MaxSize() const noexcept;
+    [[nodiscard]] bool Contains(Common::SongId id) const noexcept;
+
+    /**
+     * @brief Handle for @p id, or a null handle if it is not in the playlist
+     */
+    [[nodiscard]] SongHandle Find(Common::SongId id) const noexcept;
+
+    /**
+     * @brief Resolve a handle; empty if the song has been removed since
+     */
+    [[nodiscard]] std::optional<SongView> Get(SongHandle handle) const noexcept;
+
+    /**
+     * @brief Song at @p position in playlist order
+     */
+    [[nodiscard]] std::optional<SongView> At(std::size_t position) const noexcept;
+
+    /**
+     * @brief Visit every song in playlist order as a SongView
+     */
+    template <typename Fn>
+    void ForEachSong(Fn&& fn) const {
+        order_.ForEach([&](std::uint32_t slot) { fn(storage_.View(slot)); });
+    }
+
+    /**
+     * @brief Sum of all song durations; scans the hot records only
+     */
+    [[nodiscard]] std::uint64_t TotalDurationSeconds() const noexcept;
 
     [[nodiscard]] Common::AppError SetCurrentSong(Common::SongId id);
-    [[nodiscard]] const Common::SongInfo* GetCurrentSong() const noexcept;
+    [[nodiscard]] std::optional<SongView> GetCurrentSong() const noexcept;
+
+    /**
+     * @brief Position of the current song in playlist order
+     *
+     * An array read, or O(log n) while removals have left tombstones in the
+     * play order (see play_order.hpp).
+     */
+    [[nodiscard]] std::optional<std::size_t> CurrentPosition() const noexcept;
+
+    /**
+     * @brief Make the following song current
+     *
+     * Returns NotFound (and keeps the current song) at the end of the order
+     * with RepeatMode::Off, or if the playlist is empty.
+     */
+    [[nodiscard]] Common::AppError Next();
+
+    /**
+     * @brief Make the preceding song current; same rules as Next
+     */
+    [[nodiscard]] Common::AppError Previous();
+
+    /**
+     * @brief Song that Next would select, without selecting it
+     */
+    [[nodiscard]] std::optional<SongView> PeekNext() const noexcept;
+
+    void SetPlaybackOrder(PlaybackOrder order) noexcept;
+    [[nodiscard]] PlaybackOrder GetPlaybackOrder() const noexcept;
+    void SetRepeatMode(RepeatMode mode) noexcept;
+    [[nodiscard]] RepeatMode GetRepeatMode() const noexcept;
+
+    /**
+     * @brief Deal a new shuffle order from @p seed
+     *
+     * The same seed over the same playlist gives the same order, and the
+     * same later edits keep it identical. O(n).
+     */
+    void SetShuffleSeed(std::uint64_t seed);
 
-    void RegisterObserver(IPlaylistObserver* observer);
+    /**
+     * @brief Register an observer; returns Busy once Policy::kMaxObservers are registered
+     */
+    [[nodiscard]] Common::AppError RegisterObserver(IPlaylistObserver* observer);
     void UnregisterObserver(IPlaylistObserver* observer);
 
 private:
-    struct Song {
-        explicit Song(Common::SongInfo i) : info(std::move(i)) {}
-        Common::SongInfo info;
-    };
+    // Shared by the SongInfo and TrackEntry overloads of the range operations.
+    template <typename Song>
+    [[nodiscard]] Common::AppError InsertRange(std::size_t position, const Song* songs, std::size_t count);
+    template <typename Song>
+    [[nodiscard]] Common::AppError UpdateRange(std::size_t position, const Song* songs, std::size_t count);
+
+    template <typename Song>
+    void InsertSong(const Song& song, SongHandle& outHandle);
+    void ReleaseSlot(std::uint32_t slot);
+    void SelectFallbackSong();
+
+    /**
+     * @brief Slot after (or before) the current song in the active order, or kNone
+     */
+    [[nodiscard]] std::uint32_t Neighbour(bool forward) const noexcept;
+    [[nodiscard]] Common::AppError Step(bool forward);
+    void MakeCurrent(std::uint32_t slot);
+    [[nodiscard]] Common::SongId CurrentId() const noexcept;
 
     void NotifyPlaylistChanged();
     void NotifySongChanged(Common::SongId id);
+    void NotifySongsInserted(std::size_t first, std::size_t count);
+    void NotifySongsRemoved(std::size_t first, std::size_t count);
+    void NotifySongsUpdated(std::size_t first, std::size_t count);
+
+    // Song records live in stable slots; order_ holds slot numbers in
+    // playlist order and removes them without shifting (see play_order.hpp).
+    template <typename T, std::size_t N>
+    using Vector = typename Policy::template Vector<T, N>;
 
-    std::vector<std::unique_ptr<Song>> songs_;
-    Common::SongId current_{0U};
+    BasicSongStorage<Policy> storage_;
+    BasicPlayOrder<Policy> order_;
+    std::size_t maxSongs_;
+
+    // id -> storage slot, kept in sync on every mutation
+    BasicSongIndex<Policy> index_;
+
+    // Storage slot of the current song (valid when hasCurrent_)
+    std::uint32_t currentSlot_{SongHandle::kInvalidSlot};
     bool hasCurrent_{false};
 
-    std::vector<IPlaylistObserver*> observers_;
-};
+    BasicShuffleOrder<Policy> shuffle_;
+    PlaybackOrder playbackOrder_{PlaybackOrder::Sequential};
+    RepeatMode repeatMode_{RepeatMode::Off};
 
-class IPlaylistObserver {
-public:
-    virtual ~IPlaylistObserver() = default;
-    virtual void OnPlaylistChanged() = 0;
-    virtual void OnSongChanged(Common::SongId newSongId) = 0;
+    Vector<IPlaylistObserver*, Policy::kMaxObservers> observers_;
+
+    // Batched notification state (see BeginUpdate)
+    std::uint32_t updateDepth_{0U};
+    bool playlistChangedPending_{false};
+    bool songChangedPending_{false};
+    Common::SongId songAtUpdateStart_{0U};
 };
 
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <typename Policy>
+BasicPlaylist<Policy>::BasicPlaylist(std::size_t maxSongs)
+    : maxSongs_(std::min(maxSongs, Policy::kCapacity)) {}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::AddSong(Common::SongInfo song) {
+    SongHandle handle;
+    return AddSong(std::move(song), handle);
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::AddSong(Common::SongInfo song, SongHandle& outHandle) {
+    if (order_.Size() >= maxSongs_) {
+        return Common::AppError::Busy;
+    }
+
+    if (song.id == 0U) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (index_.Contains(song.id)) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    InsertSong(song, outHandle);
+    NotifySongsInserted(order_.Size() - 1U, 1U);
+    NotifyPlaylistChanged();
+
+    if (!hasCurrent_) {
+        SelectFallbackSong();
+    }
+
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::AddSongs(const std::vector<Common::SongInfo>& songs) {
+    return InsertRange(order_.Size(), songs.data(), songs.size());
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::AddSongs(const Common::TrackList& tracks) {
+    return InsertRange(order_.Size(), tracks.Data(), tracks.Size());
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::InsertSongs(std::size_t position, const std::vector<Common::SongInfo>& songs) {
+    return InsertRange(position, songs.data(), songs.size());
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::InsertSongs(std::size_t position, const Common::TrackEntry* tracks,
+                                                    std::size_t count) {
+    return InsertRange(position, tracks, count);
+}
+
+template <typename Policy>
+template <typename Song>
+Common::AppError BasicPlaylist<Policy>::InsertRange(std::size_t position, const Song* songs, std::size_t count) {
+    if (position > order_.Size()) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (count == 0U) {
+        return Common::AppError::Ok;
+    }
+
+    if (count > maxSongs_ - order_.Size()) {
+        return Common::AppError::Busy;
+    }
+
+    const bool hasZeroId = std::any_of(songs, songs + count, [](const Song& song) { return song.id == 0U; });
+    if (hasZeroId) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    const UpdateScope scope(*this);
+
+    const std::size_t firstNew = order_.Size();
+    const std::size_t total = firstNew + count;
+    storage_.Reserve(total);
+    order_.Reserve(total);
+    index_.Reserve(total);
+    shuffle_.Reserve(total);
+
+    for (std::size_t i = 0U; i < count; ++i) {
+        // Duplicates (against the playlist or earlier entries of this
+        // range) roll the whole range back.
+        if (index_.Contains(songs[i].id)) {
+            while (order_.Size() > firstNew) {
+                ReleaseSlot(order_.At(order_.Size() - 1U));
+                order_.PopBack();
+            }
+            return Common::AppError::InvalidArgument;
+        }
+
+        SongHandle handle;
+        InsertSong(songs[i], handle);
+    }
+
+    // New slots were appended; move them into place with a single rotate.
+    order_.MoveTailTo(position, count);
+
+    NotifySongsInserted(position, count);
+    NotifyPlaylistChanged();
+
+    if (!hasCurrent_) {
+        SelectFallbackSong();
+    }
+
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::RemoveSong(Common::SongId id) {
+    const std::uint32_t slot = index_.Find(id);
+    if (slot == BasicSongIndex<Policy>::kInvalidSlot) {
+        return Common::AppError::NotFound;
+    }
+
+    return RemoveRange(order_.PositionOf(slot), 1U);
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::RemoveRange(std::size_t position, std::size_t count) {
+    if (position > order_.Size() || count > order_.Size() - position) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (count == 0U) {
+        return Common::AppError::Ok;
+    }
+
+    // The shuffle successor of the current song is taken before it is
+    // unlinked, and moved on past any song of the range unlinked after it.
+    bool removedCurrent = false;
+    std::uint32_t shuffleSuccessor = BasicShuffleOrder<Policy>::kNone;
+    order_.ForEachInRange(position, count, [&](std::uint32_t slot) {
+        if (hasCurrent_ && slot == currentSlot_) {
+            removedCurrent = true;
+            shuffleSuccessor = shuffle_.Next(slot);
+        } else if (slot == shuffleSuccessor) {
+            shuffleSuccessor = shuffle_.Next(slot);
+        }
+        ReleaseSlot(slot);
+    });
+    order_.Erase(position, count);
+
+    NotifySongsRemoved(position, count);
+    NotifyPlaylistChanged();
+
+    if (removedCurrent) {
+        hasCurrent_ = false;
+        currentSlot_ = SongHandle::kInvalidSlot;
+        if (playbackOrder_ == PlaybackOrder::Shuffle && shuffleSuccessor != BasicShuffleOrder<Policy>::kNone) {
+            MakeCurrent(shuffleSuccessor);
+        } else if (playbackOrder_ == PlaybackOrder::Sequential && position < order_.Size()) {
+            MakeCurrent(order_.At(position));
+        } else {
+            SelectFallbackSong();
+        }
+    }
+
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::UpdateSongs(std::size_t position, const std::vector<Common::SongInfo>& songs) {
+    return UpdateRange(position, songs.data(), songs.size());
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::UpdateSongs(std::size_t position, const Common::TrackEntry* tracks,
+                                                    std::size_t count) {
+    return UpdateRange(position, tracks, count);
+}
+
+template <typename Policy>
+template <typename Song>
+Common::AppError BasicPlaylist<Policy>::UpdateRange(std::size_t position, const Song* songs, std::size_t count) {
+    if (position > order_.Size() || count > order_.Size() - position) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    bool idsMatch = true;
+    order_.ForEachInRange(position, count, [&, i = std::size_t{0U}](std::uint32_t slot) mutable {
+        idsMatch = idsMatch && storage_.Hot(slot).id == songs[i++].id;
+    });
+    if (!idsMatch) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (count == 0U) {
+        return Common::AppError::Ok;
+    }
+
+    order_.ForEachInRange(position, count, [&, i = std::size_t{0U}](std::uint32_t slot) mutable {
+        storage_.Update(slot, songs[i++]);
+    });
+
+    NotifySongsUpdated(position, count);
+    NotifyPlaylistChanged();
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::Clear() {
+    const std::size_t removed = order_.Size();
+    storage_.Clear();
+    order_.Clear();
+    index_.Clear();
+    shuffle_.Clear();
+    hasCurrent_ = false;
+    currentSlot_ = SongHandle::kInvalidSlot;
+    if (removed != 0U) {
+        NotifySongsRemoved(0U, removed);
+    }
+    NotifyPlaylistChanged();
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+std::size_t BasicPlaylist<Policy>::Size() const noexcept {
+    return order_.Size();
+}
+
+template <typename Policy>
+std::size_t BasicPlaylist<Policy>::MaxSize() const noexcept {
+    return maxSongs_;
+}
+
+template <typename Policy>
+bool BasicPlaylist<Policy>::Contains(Common::SongId id) const noexcept {
+    return index_.Contains(id);
+}
+
+template <typename Policy>
+SongHandle BasicPlaylist<Policy>::Find(Common::SongId id) const noexcept {
+    const std::uint32_t slot = index_.Find(id);
+    if (slot == BasicSongIndex<Policy>::kInvalidSlot) {
+        return SongHandle{};
+    }
+    return storage_.HandleOf(slot);
+}
+
+template <typename Policy>
+std::optional<SongView> BasicPlaylist<Policy>::Get(SongHandle handle) const noexcept {
+    if (!storage_.IsValid(handle)) {
+        return std::nullopt;
+    }
+    return storage_.View(handle.slot);
+}
+
+template <typename Policy>
+std::optional<SongView> BasicPlaylist<Policy>::At(std::size_t position) const noexcept {
+    if (position >= order_.Size()) {
+        return std::nullopt;
+    }
+    return storage_.View(order_.At(position));
+}
+
+template <typename Policy>
+std::uint64_t BasicPlaylist<Policy>::TotalDurationSeconds() const noexcept {
+    std::uint64_t total = 0U;
+    for (const auto& hot : storage_.HotRecords()) {
+        total += hot.durationSeconds;
+    }
+    return total;
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::SetCurrentSong(Common::SongId id) {
+    const std::uint32_t slot = index_.Find(id);
+    if (slot == BasicSongIndex<Policy>::kInvalidSlot) {
+        return Common::AppError::NotFound;
+    }
+
+    hasCurrent_ = true;
+    currentSlot_ = slot;
+    NotifySongChanged(id);
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+std::optional<SongView> BasicPlaylist<Policy>::GetCurrentSong() const noexcept {
+    if (!hasCurrent_) {
+        return std::nullopt;
+    }
+
+    return storage_.View(currentSlot_);
+}
+
+template <typename Policy>
+std::optional<std::size_t> BasicPlaylist<Policy>::CurrentPosition() const noexcept {
+    if (!hasCurrent_) {
+        return std::nullopt;
+    }
+
+    return order_.PositionOf(currentSlot_);
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::Next() {
+    return Step(true);
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::Previous() {
+    return Step(false);
+}
+
+template <typename Policy>
+std::optional<SongView> BasicPlaylist<Policy>::PeekNext() const noexcept {
+    const std::uint32_t slot = Neighbour(true);
+    if (slot == BasicShuffleOrder<Policy>::kNone) {
+        return std::nullopt;
+    }
+    return storage_.View(slot);
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::SetPlaybackOrder(PlaybackOrder order) noexcept {
+    playbackOrder_ = order;
+}
+
+template <typename Policy>
+PlaybackOrder BasicPlaylist<Policy>::GetPlaybackOrder() const noexcept {
+    return playbackOrder_;
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::SetRepeatMode(RepeatMode mode) noexcept {
+    repeatMode_ = mode;
+}
+
+template <typename Policy>
+RepeatMode BasicPlaylist<Policy>::GetRepeatMode() const noexcept {
+    return repeatMode_;
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::SetShuffleSeed(std::uint64_t seed) {
+    shuffle_.Clear();
+    shuffle_.Seed(seed);
+    shuffle_.Reserve(storage_.HotRecords().size());
+    order_.ForEach([this](std::uint32_t slot) { shuffle_.Insert(slot); });
+}
+
+template <typename Policy>
+std::uint32_t BasicPlaylist<Policy>::Neighbour(bool forward) const noexcept {
+    constexpr std::uint32_t kNone = BasicShuffleOrder<Policy>::kNone;
+    if (!hasCurrent_) {
+        return kNone;
+    }
+
+    const bool wrap = repeatMode_ == RepeatMode::All;
+    if (playbackOrder_ == PlaybackOrder::Shuffle) {
+        const std::uint32_t slot = forward ? shuffle_.Next(currentSlot_) : shuffle_.Previous(currentSlot_);
+        if (slot != kNone || !wrap) {
+            return slot;
+        }
+        return forward ? shuffle_.First() : shuffle_.Last();
+    }
+
+    static_assert(BasicPlayOrder<Policy>::kNone == kNone);
+    const std::uint32_t slot = forward ? order_.Next(currentSlot_) : order_.Previous(currentSlot_);
+    if (slot != kNone || !wrap) {
+        return slot;
+    }
+    return forward ? order_.First() : order_.Last();
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::Step(bool forward) {
+    const std::uint32_t slot = Neighbour(forward);
+    if (slot == BasicShuffleOrder<Policy>::kNone) {
+        return Common::AppError::NotFound;
+    }
+
+    MakeCurrent(slot);
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::MakeCurrent(std::uint32_t slot) {
+    hasCurrent_ = true;
+    currentSlot_ = slot;
+    NotifySongChanged(storage_.Hot(slot).id);
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::BeginUpdate() noexcept {
+    if (updateDepth_ == 0U) {
+        songAtUpdateStart_ = CurrentId();
+    }
+    ++updateDepth_;
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::EndUpdate() {
+    if (updateDepth_ == 0U) {
+        return;
+    }
+
+    --updateDepth_;
+    if (updateDepth_ != 0U) {
+        return;
+    }
+
+    if (playlistChangedPending_) {
+        playlistChangedPending_ = false;
+        NotifyPlaylistChanged();
+    }
+
+    if (songChangedPending_) {
+        songChangedPending_ = false;
+        if (hasCurrent_ && CurrentId() != songAtUpdateStart_) {
+            NotifySongChanged(CurrentId());
+        }
+    }
+}
+
+template <typename Policy>
+template <typename Song>
+void BasicPlaylist<Policy>::InsertSong(const Song& song, SongHandle& outHandle) {
+    outHandle = storage_.Insert(song);
+    order_.PushBack(outHandle.slot);
+    index_.Insert(song.id, outHandle.slot);
+    shuffle_.Insert(outHandle.slot);
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::ReleaseSlot(std::uint32_t slot) {
+    (void)index_.Erase(storage_.Hot(slot).id);
+    shuffle_.Erase(slot);
+    (void)storage_.Erase(storage_.HandleOf(slot));
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::SelectFallbackSong() {
+    if (order_.Empty()) {
+        return;
+    }
+
+    if (playbackOrder_ == PlaybackOrder::Shuffle) {
+        MakeCurrent(shuffle_.First());
+    } else {
+        MakeCurrent(order_.First());
+    }
+}
+
+template <typename Policy>
+Common::SongId BasicPlaylist<Policy>::CurrentId() const noexcept {
+    return hasCurrent_ ? storage_.Hot(currentSlot_).id : 0U;
+}
+
+template <typename Policy>
+Common::AppError BasicPlaylist<Policy>::RegisterObserver(IPlaylistObserver* observer) {
+    if (observer == nullptr) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    const bool exists = std::any_of(observers_.begin(), observers_.end(), [&](auto* obs) { return obs == observer; });
+    if (exists) {
+        return Common::AppError::Ok;
+    }
+
+    if (observers_.size() >= Policy::kMaxObservers) {
+        return Common::AppError::Busy;
+    }
+
+    observers_.push_back(observer);
+    return Common::AppError::Ok;
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::UnregisterObserver(IPlaylistObserver* observer) {
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::NotifyPlaylistChanged() {
+    if (updateDepth_ != 0U) {
+        playlistChangedPending_ = true;
+        return;
+    }
+
+    for (auto* obs : observers_) {
+        if (obs != nullptr) {
+            obs->OnPlaylistChanged();
+        }
+    }
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::NotifySongChanged(Common::SongId id) {
+    if (updateDepth_ != 0U) {
+        songChangedPending_ = true;
+        return;
+    }
+
+    for (auto* obs : observers_) {
+        if (obs != nullptr) {
+            obs->OnSongChanged(id);
+        }
+    }
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::NotifySongsInserted(std::size_t first, std::size_t count) {
+    for (auto* obs : observers_) {
+        if (obs != nullptr) {
+            obs->OnSongsInserted(first, count);
+        }
+    }
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::NotifySongsRemoved(std::size_t first, std::size_t count) {
+    for (auto* obs : observers_) {
+        if (obs != nullptr) {
+            obs->OnSongsRemoved(first, count);
+        }
+    }
+}
+
+template <typename Policy>
+void BasicPlaylist<Policy>::NotifySongsUpdated(std::size_t first, std::size_t count) {
+    for (auto* obs : observers_) {
+        if (obs != nullptr) {
+            obs->OnSongsUpdated(first, count);
+        }
+    }
+}
+
+extern template class BasicPlaylist<DynamicCapacity>;
+extern template class BasicPlaylist<FixedCapacity<Common::kMaxPlaylistSize>>;
+
 } // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "app_error_codes.hpp"
+#include "app_types.hpp"
+#include "mpsc_queue.hpp"
+#include "playlist_observer.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Deferred, coalescing delivery of playlist events to slow observers
+ *
+ * Register the dispatcher as an observer of a playlist (or several) and
+ * register slow observers such as HmiController with the dispatcher. The
+ * mutating thread then only posts to a bounded lock-free MPSC queue; the
+ * observers run later, on the dispatcher's consumer thread (Start) or on
+ * whichever thread calls Pump.
+ *
+ * Redundant events are coalesced while they wait: any number of
+ * OnPlaylistChanged become one, and OnSongChanged delivers only the latest
+ * song id. So each kind occupies at most one queue cell and the queue
+ * cannot overflow.
+ *
+ * Range events are not forwarded: their positions are only meaningful at
+ * the time of the call. Observers that mirror the playlist register with
+ * it directly; deferred observers that need song data on another thread
+ * read it from a PlaylistSnapshotPublisher.
+ *
+ * Register and unregister observers while no events are being delivered
+ * (before Start, or from the delivering thread).
+ */
+class PlaylistEventDispatcher final : public IPlaylistObserver {
+public:
+    static constexpr std::size_t kQueueCapacity = 8U;
+
+    PlaylistEventDispatcher() = default;
+    ~PlaylistEventDispatcher() override;
+
+    PlaylistEventDispatcher(const PlaylistEventDispatcher&) = delete;
+    PlaylistEventDispatcher& operator=(const PlaylistEventDispatcher&) = delete;
+    PlaylistEventDispatcher(PlaylistEventDispatcher&&) = delete;
+    PlaylistEventDispatcher& operator=(PlaylistEventDispatcher&&) = delete;
+
+    [[nodiscard]] Common::AppError RegisterObserver(IPlaylistObserver* observer);
+    void UnregisterObserver(IPlaylistObserver* observer);
+
+    /**
+     * @brief Deliver the queued events on the calling thread
+     * @return Number of events delivered (each to every observer)
+     */
+    std::size_t Pump();
+
+    /**
+     * @brief Deliver events on a dedicated consumer thread from now on
+     *
+     * Returns Busy if the thread is already running.
+     */
+    Common::AppError Start();
+
+    /**
+     * @brief Stop the consumer thread after it delivered what is queued
+     */
+    void Stop();
+
+    /**
+     * @brief Events received from the playlist
+     */
+    [[nodiscard]] std::uint64_t Posted() const noexcept {
+        return posted_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Events merged into one that was already waiting
+     */
+    [[nodiscard]] std::uint64_t Coalesced() const noexcept {
+        return coalesced_.load(std::memory_order_relaxed);
+    }
+
+    // Producer side; any thread.
+    void OnPlaylistChanged() override;
+    void OnSongChanged(Common::SongId newSongId) override;
+
+private:
+    enum class EventKind : std::uint8_t {
+        PlaylistChanged,
+        SongChanged,
+    };
+
+    /**
+     * @brief Queue @p kind unless one is already waiting
+     */
+    void Post(EventKind kind, std::atomic<bool>& waiting);
+    void Deliver(EventKind kind);
+    void ConsumerLoop();
+
+    Common::MpscQueue<EventKind, kQueueCapacity> queue_;
+    std::atomic<bool> playlistChangedWaiting_{false};
+    std::atomic<bool> songChangedWaiting_{false};
+    std::atomic<Common::SongId> latestSongId_{0U};
+
+    std::atomic<std::uint64_t> posted_{0U};
+    std::atomic<std::uint64_t> coalesced_{0U};
+
+    std::vector<IPlaylistObserver*> observers_;
+
+    // Consumer thread parking. Producers only touch the mutex when the
+    // consumer is asleep.
+    std::thread consumer_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::atomic<std::size_t> queued_{0U};
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> running_{false};
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
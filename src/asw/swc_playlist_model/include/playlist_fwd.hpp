@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+#include "app_types.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+struct DynamicCapacity;
+
+template <std::size_t MaxSongs, std::size_t MaxTitleLength>
+struct FixedCapacity;
+
+template <typename Policy>
+class BasicPlaylist;
+
+class IPlaylistObserver;
+
+/**
+ * @brief Growable playlist for large libraries (up to kMaxLibrarySize songs)
+ */
+using Playlist = BasicPlaylist<DynamicCapacity>;
+
+/**
+ * @brief Heap-free playlist with kMaxPlaylistSize inline slots
+ */
+using StaticPlaylist = BasicPlaylist<FixedCapacity<Common::kMaxPlaylistSize, Common::kMaxTitleLength>>;
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
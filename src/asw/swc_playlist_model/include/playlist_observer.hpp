@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+#include "app_types.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Observer of playlist changes
+ *
+ * OnPlaylistChanged is the coarse "something changed" signal and is
+ * coalesced by BasicPlaylist::BeginUpdate/EndUpdate. The range events are
+ * delivered immediately, in mutation order, with positions relative to the
+ * playlist as it is at the time of the call, so a view can mirror the
+ * playlist incrementally. They default to no-ops for observers that only
+ * care about the coarse signal.
+ */
+class IPlaylistObserver {
+public:
+    virtual ~IPlaylistObserver() = default;
+    virtual void OnPlaylistChanged() = 0;
+    virtual void OnSongChanged(Common::SongId newSongId) = 0;
+
+    virtual void OnSongsInserted(std::size_t /*first*/, std::size_t /*count*/) {}
+    virtual void OnSongsRemoved(std::size_t /*first*/, std::size_t /*count*/) {}
+    virtual void OnSongsUpdated(std::size_t /*first*/, std::size_t /*count*/) {}
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
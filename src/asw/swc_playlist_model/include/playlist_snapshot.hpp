@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "snapshot_cell.hpp"
+#include "song_storage.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Immutable run of consecutive songs with their own copy of the titles
+ *
+ * Chunks are shared between successive snapshots; an edit only rebuilds the
+ * chunks it touches.
+ */
+class SnapshotChunk {
+public:
+    /**
+     * @brief Copy @p count songs starting at @p position out of @p playlist
+     */
+    SnapshotChunk(const Playlist& playlist, std::size_t position, std::size_t count);
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return entries_.size();
+    }
+
+    /**
+     * @pre index < Size()
+     */
+    [[nodiscard]] SongView At(std::size_t index) const noexcept;
+
+private:
+    struct Entry {
+        Common::SongId id;
+        std::uint32_t durationSeconds;
+        std::uint32_t titleOffset;
+        std::uint32_t titleLength;
+    };
+
+    std::vector<Entry> entries_;
+    std::string titles_;
+};
+
+/**
+ * @brief Immutable copy of a Playlist at one point in time
+ *
+ * Safe to read from any thread without locking for as long as it is held.
+ * SongViews returned here stay valid as long as the snapshot does.
+ */
+class PlaylistSnapshot {
+public:
+    /**
+     * @brief Increases by one with every published snapshot
+     */
+    [[nodiscard]] std::uint64_t Version() const noexcept {
+        return version_;
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return ends_.empty() ? 0U : ends_.back();
+    }
+
+    [[nodiscard]] std::optional<SongView> At(std::size_t position) const noexcept;
+
+    [[nodiscard]] std::optional<std::size_t> CurrentPosition() const noexcept {
+        return currentPosition_;
+    }
+
+    [[nodiscard]] std::optional<SongView> GetCurrentSong() const noexcept {
+        return currentPosition_.has_value() ? At(*currentPosition_) : std::nullopt;
+    }
+
+    /**
+     * @brief Visit every song in playlist order
+     */
+    template <typename Fn>
+    void ForEachSong(Fn&& fn) const {
+        for (const auto& chunk : chunks_) {
+            for (std::size_t i = 0U; i < chunk->Size(); ++i) {
+                fn(chunk->At(i));
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t ChunkCount() const noexcept {
+        return chunks_.size();
+    }
+
+    /**
+     * @brief Identity of a chunk, to tell which ones two snapshots share
+     */
+    [[nodiscard]] const SnapshotChunk* ChunkAt(std::size_t index) const noexcept {
+        return chunks_[index].get();
+    }
+
+private:
+    friend class PlaylistSnapshotPublisher;
+
+    std::vector<std::shared_ptr<const SnapshotChunk>> chunks_;
+    std::vector<std::size_t> ends_; ///< Position one past each chunk's last song
+    std::optional<std::size_t> currentPosition_;
+    std::uint64_t version_{0U};
+};
+
+/**
+ * @brief Copy-on-write (RCU) mode for a Playlist shared with reader threads
+ *
+ * The publisher mirrors the playlist in immutable chunks of at most
+ * kMaxChunkSongs songs, rebuilding only the chunks that range events touch,
+ * and publishes a new PlaylistSnapshot on every OnPlaylistChanged and
+ * OnSongChanged. Inside an UpdateScope (for example a rescan) that is once
+ * per scope, so readers never see a half-applied batch.
+ *
+ * Acquire() may be called from any thread and never blocks. Everything
+ * else, like the playlist itself, belongs to the writer thread.
+ */
+class PlaylistSnapshotPublisher final : public IPlaylistObserver {
+public:
+    static constexpr std::size_t kMaxChunkSongs = 512U;
+
+    explicit PlaylistSnapshotPublisher(Playlist& playlist);
+    ~PlaylistSnapshotPublisher() override;
+
+    PlaylistSnapshotPublisher(const PlaylistSnapshotPublisher&) = delete;
+    PlaylistSnapshotPublisher& operator=(const PlaylistSnapshotPublisher&) = delete;
+    PlaylistSnapshotPublisher(PlaylistSnapshotPublisher&&) = delete;
+    PlaylistSnapshotPublisher& operator=(PlaylistSnapshotPublisher&&) = delete;
+
+    /**
+     * @brief False if the playlist's observer table was full; the published
+     *        snapshot then stays at the state of construction
+     */
+    [[nodiscard]] bool IsAttached() const noexcept {
+        return attached_;
+    }
+
+    /**
+     * @brief Latest published snapshot; lock-free, callable from any thread
+     */
+    [[nodiscard]] std::shared_ptr<const PlaylistSnapshot> Acquire() const {
+        return published_.Load();
+    }
+
+    void OnPlaylistChanged() override;
+    void OnSongChanged(Common::SongId newSongId) override;
+    void OnSongsInserted(std::size_t first, std::size_t count) override;
+    void OnSongsRemoved(std::size_t first, std::size_t count) override;
+    void OnSongsUpdated(std::size_t first, std::size_t count) override;
+
+private:
+    /**
+     * @brief Index of the chunk holding @p position (or chunks_.size() past
+     *        the end) and the position of its first song
+     */
+    void Locate(std::size_t position, std::size_t& chunk, std::size_t& chunkStart) const noexcept;
+
+    /**
+     * @brief Replace chunks [firstChunk, lastChunk) with fresh chunks holding
+     *        the @p count playlist songs from @p position
+     */
+    void Rechunk(std::size_t firstChunk, std::size_t lastChunk, std::size_t position, std::size_t count);
+
+    void Publish();
+
+    Playlist& playlist_;
+    bool attached_{false};
+
+    std::vector<std::shared_ptr<const SnapshotChunk>> chunks_;
+    std::uint64_t version_{0U};
+    Common::SnapshotCell<PlaylistSnapshot> published_;
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
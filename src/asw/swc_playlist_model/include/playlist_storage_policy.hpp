@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "app_types.hpp"
+#include "fixed_string.hpp"
+#include "static_vector.hpp"
+#include "title_table.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Storage policies for BasicPlaylist and its building blocks
+ *
+ * A policy provides:
+ * - kGrowable: whether containers may allocate and grow at run time
+ * - kCapacity: the hard upper bound on songs
+ * - kMaxObservers: the hard upper bound on registered observers
+ * - Vector<T, N>: the container used for every internal array, where N is
+ *   the number of elements that array can ever need
+ * - TitleTable: the per-slot title storage (see title_table.hpp)
+ * - StoredTitle(title): the title as the TitleTable will hand it back
+ */
+
+/**
+ * @brief Growable storage on the heap, for large libraries
+ *
+ * Containers grow geometrically, so inserts are amortized O(1). The bound N
+ * is ignored. Titles are packed into a shared arena.
+ */
+struct DynamicCapacity {
+    static constexpr bool kGrowable = true;
+    static constexpr std::size_t kCapacity = Common::kMaxLibrarySize;
+    static constexpr std::size_t kMaxObservers = 16U;
+
+    template <typename T, std::size_t N>
+    using Vector = std::vector<T>;
+
+    using TitleTable = ArenaTitleTable;
+
+    [[nodiscard]] static std::string_view StoredTitle(std::string_view title) noexcept {
+        return title;
+    }
+};
+
+/**
+ * @brief Inline storage with no dynamic allocation at all
+ *
+ * Every record, title and index bucket lives inside the playlist object,
+ * so its size is fixed at compile time (see sizeof) and nothing touches the
+ * heap after construction. Titles longer than MaxTitleLength are truncated.
+ */
+template <std::size_t MaxSongs, std::size_t MaxTitleLength = Common::kMaxTitleLength>
+struct FixedCapacity {
+    static constexpr bool kGrowable = false;
+    static constexpr std::size_t kCapacity = MaxSongs;
+    static constexpr std::size_t kMaxObservers = 8U;
+
+    template <typename T, std::size_t N>
+    using Vector = Common::StaticVector<T, N>;
+
+    using TitleTable = InlineTitleTable<MaxSongs, MaxTitleLength>;
+
+    [[nodiscard]] static std::string_view StoredTitle(std::string_view title) noexcept {
+        return Common::FixedString<MaxTitleLength>::Truncated(title);
+    }
+};
+
+/**
+ * @brief Smallest power of two that is at least @p value (and at least 16)
+ */
+constexpr std::size_t NextPowerOfTwo(std::size_t value) noexcept {
+    std::size_t result = 16U;
+    while (result < value) {
+        result <<= 1U;
+    }
+    return result;
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
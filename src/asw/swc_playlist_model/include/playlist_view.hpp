@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "song_id_mirror.hpp"
+#include "song_index.hpp"
+#include "song_storage.hpp"
+#include "title_table.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Sorted, optionally filtered, incrementally maintained view of a Playlist
+ *
+ * The view mirrors the playlist through its range events. Every song gets a
+ * precomputed sort key (folded title, duration or arrival sequence) and the
+ * matching songs are kept as a permutation in a chunked sorted array, so an
+ * insert or removal costs a binary search plus a shift inside one chunk of
+ * at most kMaxChunkRows rows instead of a full re-sort.
+ *
+ * Work is lazy: playlist events only record which songs changed. Keys are
+ * computed and rows placed on the next query. A large batch (for example,
+ * the first load of a library) is merged with one sort instead of row by
+ * row. Queries only build SongViews for the rows they return.
+ *
+ * Songs are read back from the playlist on demand; the same rule as for
+ * SongView applies to the views returned here.
+ */
+class PlaylistView final : public IPlaylistObserver {
+public:
+    enum class Order : std::uint8_t {
+        Title,    ///< Case- and diacritic-insensitive title order
+        Duration, ///< Shortest first
+        Added,    ///< Order in which the songs arrived in the playlist
+    };
+
+    using Filter = std::function<bool(const SongView&)>;
+
+    static constexpr std::size_t kMaxChunkRows = 1024U;
+
+    /**
+     * @param filter Songs for which this returns false are not part of the
+     *               view; an empty filter admits every song
+     */
+    PlaylistView(Playlist& playlist, Order order, Filter filter = Filter{});
+    ~PlaylistView() override;
+
+    PlaylistView(const PlaylistView&) = delete;
+    PlaylistView& operator=(const PlaylistView&) = delete;
+    PlaylistView(PlaylistView&&) = delete;
+    PlaylistView& operator=(PlaylistView&&) = delete;
+
+    /**
+     * @brief False if the playlist's observer table was full; the view is
+     *        then empty and never updated
+     */
+    [[nodiscard]] bool IsAttached() const noexcept {
+        return attached_;
+    }
+
+    [[nodiscard]] std::size_t Size();
+
+    /**
+     * @brief Song at @p row of the view
+     */
+    [[nodiscard]] std::optional<SongView> At(std::size_t row);
+
+    /**
+     * @brief Replace @p out with rows [first, first + count) of the view,
+     *        clipped to its size; returns the number of rows written
+     */
+    std::size_t Window(std::size_t first, std::size_t count, std::vector<SongView>& out);
+
+    /**
+     * @brief Row of @p id, or empty if the song is not part of the view
+     */
+    [[nodiscard]] std::optional<std::size_t> RowOf(Common::SongId id);
+
+    void OnPlaylistChanged() override {}
+    void OnSongChanged(Common::SongId /*newSongId*/) override {}
+    void OnSongsInserted(std::size_t first, std::size_t count) override;
+    void OnSongsRemoved(std::size_t first, std::size_t count) override;
+    void OnSongsUpdated(std::size_t first, std::size_t count) override;
+
+private:
+    enum class State : std::uint8_t {
+        Free,    ///< Key slot unused
+        Pending, ///< Song changed since the last query; not placed yet
+        Placed,  ///< Song is a row of the view
+        Hidden,  ///< Song is rejected by the filter
+    };
+
+    struct KeyRecord {
+        std::uint64_t primary{0U};
+        Common::SongId id{0U};
+        State state{State::Free};
+    };
+
+    struct Row {
+        std::uint64_t primary;
+        Common::SongId id;
+        std::uint32_t keySlot;
+    };
+
+    using Chunk = std::vector<Row>;
+
+    void Track(Common::SongId id);
+    void Untrack(Common::SongId id);
+    void MarkPending(std::uint32_t keySlot);
+
+    /**
+     * @brief Place all pending songs (incrementally or by one merge sort)
+     */
+    void Flush();
+    void ComputeKey(std::uint32_t keySlot, const SongView& song);
+    [[nodiscard]] Row RowFor(std::uint32_t keySlot) const noexcept;
+    [[nodiscard]] bool Less(const Row& lhs, const Row& rhs) const noexcept;
+
+    [[nodiscard]] std::size_t ChunkFor(const Row& row) const noexcept;
+    void InsertRow(const Row& row);
+    void EraseRow(const Row& row);
+    void Rebuild(std::vector<Row> rows);
+
+    /**
+     * @brief Chunk and offset of view row @p row (row < rowCount_)
+     */
+    void Locate(std::size_t row, std::size_t& chunk, std::size_t& offset) const noexcept;
+    [[nodiscard]] std::optional<SongView> ViewOf(const Row& row) const noexcept;
+
+    Playlist& playlist_;
+    Order order_;
+    Filter filter_;
+    bool attached_{false};
+
+    SongIdMirror mirror_;
+
+    // Per-song sort keys, addressed by key slot.
+    SongIndex keySlots_;
+    std::vector<KeyRecord> keys_;
+    ArenaTitleTable foldedTitles_;
+    std::string foldScratch_;
+    std::vector<std::uint32_t> freeKeySlots_;
+    std::uint64_t nextSequence_{0U};
+
+    std::vector<std::uint32_t> pending_;
+
+    std::vector<Chunk> chunks_;
+    std::size_t rowCount_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "playlist_storage_policy.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Small deterministic PRNG (SplitMix64) for the shuffle order
+ *
+ * Unlike the standard distributions, the same seed yields the same sequence
+ * with every compiler and standard library.
+ */
+class ShuffleRng {
+public:
+    explicit ShuffleRng(std::uint64_t seed = 0U) noexcept : state_(seed) {}
+
+    void Seed(std::uint64_t seed) noexcept {
+        state_ = seed;
+    }
+
+    [[nodiscard]] std::uint64_t Next() noexcept {
+        state_ += 0x9E3779B97F4A7C15ULL;
+        std::uint64_t z = state_;
+        z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31U);
+    }
+
+    /**
+     * @brief Uniform value in [0, bound); @p bound must not be 0
+     */
+    [[nodiscard]] std::uint32_t Below(std::uint32_t bound) noexcept {
+        return static_cast<std::uint32_t>(((Next() >> 32U) * bound) >> 32U);
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+/**
+ * @brief Random permutation of storage slots, maintained incrementally
+ *
+ * The permutation is a doubly linked list threaded through an array indexed
+ * by storage slot, so next/previous, insert and erase are all O(1) and
+ * nothing is ever reshuffled. A new slot goes to a uniformly random position
+ * (picked through a dense array of members), which keeps the whole order a
+ * uniform random permutation. Given the same seed and the same sequence of
+ * inserts and erases, the order is the same.
+ *
+ * @tparam Policy Storage policy (see playlist_storage_policy.hpp)
+ */
+template <typename Policy>
+class BasicShuffleOrder {
+public:
+    static constexpr std::uint32_t kNone = 0xFFFFFFFFU;
+
+    void Reserve(std::size_t slots) {
+        links_.reserve(slots);
+        members_.reserve(slots);
+    }
+
+    /**
+     * @brief Reseed the generator; the current order is kept
+     */
+    void Seed(std::uint64_t seed) noexcept {
+        rng_.Seed(seed);
+    }
+
+    /**
+     * @pre @p slot is not a member and slot < Policy::kCapacity
+     */
+    void Insert(std::uint32_t slot);
+
+    /**
+     * @pre @p slot is a member
+     */
+    void Erase(std::uint32_t slot);
+
+    void Clear() noexcept;
+
+    /**
+     * @brief Member after @p slot, or kNone at the end of the order
+     */
+    [[nodiscard]] std::uint32_t Next(std::uint32_t slot) const noexcept {
+        return links_[slot].next;
+    }
+
+    /**
+     * @brief Member before @p slot, or kNone at the start of the order
+     */
+    [[nodiscard]] std::uint32_t Previous(std::uint32_t slot) const noexcept {
+        return links_[slot].prev;
+    }
+
+    [[nodiscard]] std::uint32_t First() const noexcept {
+        return head_;
+    }
+
+    [[nodiscard]] std::uint32_t Last() const noexcept {
+        return tail_;
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return members_.size();
+    }
+
+private:
+    struct Link {
+        std::uint32_t prev{kNone};
+        std::uint32_t next{kNone};
+        std::uint32_t member{kNone}; ///< Index into members_
+    };
+
+    template <typename T>
+    using Array = typename Policy::template Vector<T, Policy::kCapacity>;
+
+    Array<Link> links_;
+    Array<std::uint32_t> members_;
+    std::uint32_t head_{kNone};
+    std::uint32_t tail_{kNone};
+    ShuffleRng rng_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <typename Policy>
+void BasicShuffleOrder<Policy>::Insert(std::uint32_t slot) {
+    if (slot >= links_.size()) {
+        links_.resize(static_cast<std::size_t>(slot) + 1U);
+    }
+
+    // k members leave k + 1 gaps: after one of the members, or in front.
+    const auto count = static_cast<std::uint32_t>(members_.size());
+    const std::uint32_t gap = rng_.Below(count + 1U);
+    const std::uint32_t prev = gap == count ? kNone : members_[gap];
+    const std::uint32_t next = prev == kNone ? head_ : links_[prev].next;
+
+    links_[slot] = Link{prev, next, count};
+    members_.push_back(slot);
+    (prev == kNone ? head_ : links_[prev].next) = slot;
+    (next == kNone ? tail_ : links_[next].prev) = slot;
+}
+
+template <typename Policy>
+void BasicShuffleOrder<Policy>::Erase(std::uint32_t slot) {
+    const Link link = links_[slot];
+    (link.prev == kNone ? head_ : links_[link.prev].next) = link.next;
+    (link.next == kNone ? tail_ : links_[link.next].prev) = link.prev;
+
+    const std::uint32_t moved = members_.back();
+    members_[link.member] = moved;
+    links_[moved].member = link.member;
+    members_.pop_back();
+    links_[slot] = Link{};
+}
+
+template <typename Policy>
+void BasicShuffleOrder<Policy>::Clear() noexcept {
+    links_.clear();
+    members_.clear();
+    head_ = kNone;
+    tail_ = kNone;
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "app_types.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Song ids in playlist order, maintained from range events
+ *
+ * Removal events arrive after the songs are gone from the playlist, so an
+ * observer that indexes songs by id keeps this mirror to learn which ids a
+ * removed range held. 4 bytes per song.
+ */
+class SongIdMirror {
+public:
+    /**
+     * @brief Mirror OnSongsInserted; calls @p onAdded(id) for every new song
+     */
+    template <typename PlaylistT, typename Fn>
+    void Insert(const PlaylistT& playlist, std::size_t first, std::size_t count, Fn&& onAdded) {
+        const auto at = ids_.begin() + static_cast<std::ptrdiff_t>(first);
+        const auto inserted = ids_.insert(at, count, Common::SongId{0U});
+        for (std::size_t i = 0U; i < count; ++i) {
+            const auto song = playlist.At(first + i);
+            inserted[static_cast<std::ptrdiff_t>(i)] = song.has_value() ? song->id : 0U;
+            onAdded(inserted[static_cast<std::ptrdiff_t>(i)]);
+        }
+    }
+
+    /**
+     * @brief Mirror OnSongsRemoved; calls @p onRemoved(id) for every removed song
+     */
+    template <typename Fn>
+    void Remove(std::size_t first, std::size_t count, Fn&& onRemoved) {
+        const auto begin = ids_.begin() + static_cast<std::ptrdiff_t>(first);
+        const auto end = begin + static_cast<std::ptrdiff_t>(count);
+        for (auto it = begin; it != end; ++it) {
+            onRemoved(*it);
+        }
+        ids_.erase(begin, end);
+    }
+
+    [[nodiscard]] Common::SongId operator[](std::size_t position) const noexcept {
+        return ids_[position];
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return ids_.size();
+    }
+
+private:
+    std::vector<Common::SongId> ids_;
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
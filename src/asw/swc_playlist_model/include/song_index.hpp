@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app_types.hpp"
+#include "playlist_storage_policy.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Open-addressing hash index from SongId to a playlist slot
+ *
+ * Linear probing over a power-of-two table. Id 0 is never a valid song id
+ * and marks an empty bucket, so no separate occupancy bitmap is needed.
+ * Erase uses backward-shift deletion, which keeps probe chains short
+ * without tombstones. The table is kept at most half full.
+ *
+ * With a fixed-capacity policy the table is sized for Policy::kCapacity up
+ * front and never rehashes.
+ *
+ * @tparam Policy Storage policy (see playlist_storage_policy.hpp)
+ */
+template <typename Policy>
+class BasicSongIndex {
+public:
+    static constexpr std::uint32_t kInvalidSlot = 0xFFFFFFFFU;
+    static constexpr std::size_t kMaxBuckets = NextPowerOfTwo(Policy::kCapacity * 2U);
+
+    BasicSongIndex();
+
+    /**
+     * @brief Pre-size the table for @p count entries (never shrinks)
+     */
+    void Reserve(std::size_t count);
+
+    /**
+     * @brief Insert or overwrite the slot stored for @p id
+     * @pre id != 0
+     */
+    void Insert(Common::SongId id, std::uint32_t slot);
+
+    /**
+     * @brief Remove @p id; returns false if it was not present
+     */
+    bool Erase(Common::SongId id) noexcept;
+
+    /**
+     * @brief Slot stored for @p id, or kInvalidSlot
+     */
+    [[nodiscard]] std::uint32_t Find(Common::SongId id) const noexcept;
+
+    [[nodiscard]] bool Contains(Common::SongId id) const noexcept {
+        return Find(id) != kInvalidSlot;
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return size_;
+    }
+
+    void Clear() noexcept;
+
+private:
+    struct Bucket {
+        Common::SongId id{0U};
+        std::uint32_t slot{kInvalidSlot};
+    };
+
+    using Buckets = typename Policy::template Vector<Bucket, kMaxBuckets>;
+
+    [[nodiscard]] std::size_t HomeBucket(Common::SongId id) const noexcept;
+    void Rehash(std::size_t bucketCount);
+
+    Buckets buckets_;
+    std::size_t mask_{0U};
+    std::size_t size_{0U};
+};
+
+using SongIndex = BasicSongIndex<DynamicCapacity>;
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+namespace Detail {
+
+// Fibonacci hashing spreads sequential ids (the common case for USB scans)
+// evenly over the table.
+constexpr std::uint64_t kFibonacciMultiplier = 11400714819323198485ULL;
+
+} // namespace Detail
+
+template <typename Policy>
+BasicSongIndex<Policy>::BasicSongIndex() {
+    if constexpr (!Policy::kGrowable) {
+        // Fixed storage: take the whole table now, never rehash later.
+        buckets_.resize(kMaxBuckets);
+        mask_ = kMaxBuckets - 1U;
+    }
+}
+
+template <typename Policy>
+void BasicSongIndex<Policy>::Reserve(std::size_t count) {
+    const std::size_t needed = NextPowerOfTwo(count * 2U);
+    if (needed > buckets_.size()) {
+        Rehash(needed);
+    }
+}
+
+template <typename Policy>
+void BasicSongIndex<Policy>::Insert(Common::SongId id, std::uint32_t slot) {
+    if ((size_ + 1U) * 2U > buckets_.size()) {
+        Rehash(NextPowerOfTwo((size_ + 1U) * 2U));
+    }
+
+    std::size_t pos = HomeBucket(id);
+    while (buckets_[pos].id != 0U) {
+        if (buckets_[pos].id == id) {
+            buckets_[pos].slot = slot;
+            return;
+        }
+        pos = (pos + 1U) & mask_;
+    }
+
+    buckets_[pos] = Bucket{id, slot};
+    ++size_;
+}
+
+template <typename Policy>
+bool BasicSongIndex<Policy>::Erase(Common::SongId id) noexcept {
+    if (buckets_.empty() || id == 0U) {
+        return false;
+    }
+
+    std::size_t pos = HomeBucket(id);
+    while (buckets_[pos].id != id) {
+        if (buckets_[pos].id == 0U) {
+            return false;
+        }
+        pos = (pos + 1U) & mask_;
+    }
+
+    // Backward-shift: pull later entries of the probe chain into the hole
+    // as long as that does not move them in front of their home bucket.
+    std::size_t hole = pos;
+    std::size_t next = (hole + 1U) & mask_;
+    while (buckets_[next].id != 0U) {
+        const std::size_t home = HomeBucket(buckets_[next].id);
+        const std::size_t distToHole = (next - hole) & mask_;
+        const std::size_t distToHome = (next - home) & mask_;
+        if (distToHome >= distToHole) {
+            buckets_[hole] = buckets_[next];
+            hole = next;
+        }
+        next = (next + 1U) & mask_;
+    }
+
+    buckets_[hole] = Bucket{};
+    --size_;
+    return true;
+}
+
+template <typename Policy>
+std::uint32_t BasicSongIndex<Policy>::Find(Common::SongId id) const noexcept {
+    if (buckets_.empty() || id == 0U) {
+        return kInvalidSlot;
+    }
+
+    std::size_t pos = HomeBucket(id);
+    while (buckets_[pos].id != 0U) {
+        if (buckets_[pos].id == id) {
+            return buckets_[pos].slot;
+        }
+        pos = (pos + 1U) & mask_;
+    }
+    return kInvalidSlot;
+}
+
+template <typename Policy>
+void BasicSongIndex<Policy>::Clear() noexcept {
+    for (auto& bucket : buckets_) {
+        bucket = Bucket{};
+    }
+    size_ = 0U;
+}
+
+template <typename Policy>
+std::size_t BasicSongIndex<Policy>::HomeBucket(Common::SongId id) const noexcept {
+    const std::uint64_t hash = static_cast<std::uint64_t>(id) * Detail::kFibonacciMultiplier;
+    const auto high = static_cast<std::uint32_t>(hash >> 32U);
+    return high & mask_;
+}
+
+template <typename Policy>
+void BasicSongIndex<Policy>::Rehash(std::size_t bucketCount) {
+    if constexpr (Policy::kGrowable) {
+        Buckets old(bucketCount);
+        old.swap(buckets_);
+        mask_ = bucketCount - 1U;
+        size_ = 0U;
+
+        for (const auto& bucket : old) {
+            if (bucket.id != 0U) {
+                Insert(bucket.id, bucket.slot);
+            }
+        }
+    } else {
+        // A fixed table is sized for kCapacity in the constructor and is
+        // never more than half full, so it never needs to grow.
+        (void)bucketCount;
+    }
+}
+
+extern template class BasicSongIndex<DynamicCapacity>;
+extern template class BasicSongIndex<FixedCapacity<Common::kMaxPlaylistSize>>;
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
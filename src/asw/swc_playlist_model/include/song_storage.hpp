@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "app_types.hpp"
+#include "playlist_storage_policy.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Generation-checked reference to a song stored in a Playlist
+ *
+ * A handle stays valid across unrelated inserts and removals. Once the song
+ * it refers to is removed, the slot's generation is bumped and the handle
+ * no longer resolves, even if the slot is reused for another song.
+ */
+struct SongHandle {
+    static constexpr std::uint32_t kInvalidSlot = 0xFFFFFFFFU;
+
+    std::uint32_t slot{kInvalidSlot};
+    std::uint32_t generation{0U};
+
+    [[nodiscard]] bool IsNull() const noexcept {
+        return slot == kInvalidSlot;
+    }
+
+    friend bool operator==(const SongHandle& lhs, const SongHandle& rhs) noexcept {
+        return lhs.slot == rhs.slot && lhs.generation == rhs.generation;
+    }
+
+    friend bool operator!=(const SongHandle& lhs, const SongHandle& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+};
+
+/**
+ * @brief Read-only view of a stored song
+ *
+ * The title view points into playlist storage. Do not keep it across
+ * playlist mutations: the growable policy may repack all titles when songs
+ * are removed or updated.
+ */
+struct SongView {
+    Common::SongId id{};
+    std::string_view title{};
+    std::uint32_t durationSeconds{};
+};
+
+/**
+ * @brief Slot map holding song records in contiguous arrays
+ *
+ * Records are split hot/cold: id and duration are packed together so scans
+ * and lookups touch 8 bytes per song, while titles live in a parallel title
+ * table that is only read when a view is materialised. Removed slots go on a free
+ * list and are reused; nothing is ever shifted.
+ *
+ * @tparam Policy Storage policy (see playlist_storage_policy.hpp)
+ */
+template <typename Policy>
+class BasicSongStorage {
+public:
+    struct HotRecord {
+        Common::SongId id{0U}; ///< 0 marks a free slot
+        std::uint32_t durationSeconds{0U};
+    };
+
+    template <typename T>
+    using Array = typename Policy::template Vector<T, Policy::kCapacity>;
+
+    BasicSongStorage() = default;
+
+    void Reserve(std::size_t count);
+
+    /**
+     * @brief Store a song record (Common::SongInfo or Common::TrackEntry)
+     * @pre Size() < Policy::kCapacity
+     */
+    template <typename Song>
+    [[nodiscard]] SongHandle Insert(const Song& song);
+
+    /**
+     * @brief Release a slot; returns false for stale or null handles
+     */
+    bool Erase(SongHandle handle);
+
+    /**
+     * @brief Overwrite duration and title of a live slot; its handle stays valid
+     */
+    template <typename Song>
+    void Update(std::uint32_t slot, const Song& song);
+
+    /**
+     * @brief Release every slot and invalidate all outstanding handles
+     */
+    void Clear();
+
+    [[nodiscard]] bool IsValid(SongHandle handle) const noexcept {
+        return handle.slot < hot_.size() && generations_[handle.slot] == handle.generation &&
+               hot_[handle.slot].id != 0U;
+    }
+
+    [[nodiscard]] SongHandle HandleOf(std::uint32_t slot) const noexcept {
+        return SongHandle{slot, generations_[slot]};
+    }
+
+    [[nodiscard]] const HotRecord& Hot(std::uint32_t slot) const noexcept {
+        return hot_[slot];
+    }
+
+    [[nodiscard]] std::string_view Title(std::uint32_t slot) const noexcept {
+        return titles_.Get(slot);
+    }
+
+    [[nodiscard]] SongView View(std::uint32_t slot) const noexcept {
+        return SongView{hot_[slot].id, Title(slot), hot_[slot].durationSeconds};
+    }
+
+    /**
+     * @brief All hot records including free slots (id == 0), for linear scans
+     */
+    [[nodiscard]] const Array<HotRecord>& HotRecords() const noexcept {
+        return hot_;
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return hot_.size() - freeSlots_.size();
+    }
+
+private:
+    Array<HotRecord> hot_;
+    typename Policy::TitleTable titles_;
+    Array<std::uint32_t> generations_;
+    Array<std::uint32_t> freeSlots_;
+};
+
+using SongStorage = BasicSongStorage<DynamicCapacity>;
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <typename Policy>
+void BasicSongStorage<Policy>::Reserve(std::size_t count) {
+    hot_.reserve(count);
+    titles_.Reserve(count);
+    generations_.reserve(count);
+    freeSlots_.reserve(count);
+}
+
+template <typename Policy>
+template <typename Song>
+SongHandle BasicSongStorage<Policy>::Insert(const Song& song) {
+    std::uint32_t slot = SongHandle::kInvalidSlot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(hot_.size());
+        hot_.emplace_back();
+        titles_.EmplaceBack();
+        generations_.push_back(0U);
+    }
+
+    hot_[slot] = HotRecord{song.id, song.durationSeconds};
+    titles_.Set(slot, song.title);
+    return SongHandle{slot, generations_[slot]};
+}
+
+template <typename Policy>
+bool BasicSongStorage<Policy>::Erase(SongHandle handle) {
+    if (!IsValid(handle)) {
+        return false;
+    }
+
+    hot_[handle.slot] = HotRecord{};
+    titles_.Release(handle.slot);
+    ++generations_[handle.slot];
+    freeSlots_.push_back(handle.slot);
+    return true;
+}
+
+template <typename Policy>
+template <typename Song>
+void BasicSongStorage<Policy>::Update(std::uint32_t slot, const Song& song) {
+    hot_[slot].durationSeconds = song.durationSeconds;
+    titles_.Set(slot, song.title);
+}
+
+template <typename Policy>
+void BasicSongStorage<Policy>::Clear() {
+    freeSlots_.clear();
+    titles_.Clear();
+    for (std::size_t i = hot_.size(); i > 0U; --i) {
+        const std::size_t slot = i - 1U;
+        if (hot_[slot].id != 0U) {
+            ++generations_[slot];
+        }
+        hot_[slot] = HotRecord{};
+        freeSlots_.push_back(static_cast<std::uint32_t>(slot));
+    }
+}
+
+extern template class BasicSongStorage<DynamicCapacity>;
+extern template class BasicSongStorage<FixedCapacity<Common::kMaxPlaylistSize>>;
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Append the collation form of @p title to @p out
+ *
+ * Folds case and diacritics so that "Éclair", "eclair" and "ECLAIR" compare
+ * equal: ASCII letters are lower-cased, Latin-1 Supplement and Latin
+ * Extended-A letters are mapped to their unaccented lower-case base
+ * ("ß" -> "ss", "Æ" -> "ae"). All other bytes are copied unchanged, so
+ * non-Latin scripts still sort by code point.
+ */
+void AppendFolded(std::string_view title, std::string& out);
+
+/**
+ * @brief First 8 bytes of a folded key packed big-endian, zero-padded
+ *
+ * Comparing two prefixes as integers gives the same order as comparing the
+ * first 8 bytes of the keys, so sorted containers can settle most
+ * comparisons without touching the full key.
+ */
+[[nodiscard]] std::uint64_t KeyPrefix(std::string_view foldedKey) noexcept;
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
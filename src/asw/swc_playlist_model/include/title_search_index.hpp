@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "song_id_mirror.hpp"
+#include "song_index.hpp"
+#include "title_table.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Search-as-you-type index over the titles of a Playlist
+ *
+ * Titles are folded like PlaylistView's title order (case and Latin
+ * diacritics), so "cafe" finds "Café". The index keeps posting lists of:
+ * - every trigram of each folded title, for queries of 3 bytes or more
+ * - the first one and two bytes of each word, for short prefix queries
+ *
+ * A query reads the shortest posting list of its grams and checks those
+ * candidates against the folded titles, so its cost scales with the
+ * rarest gram, not with the library. Only one- and two-byte substring
+ * queries scan every title.
+ *
+ * The index follows the playlist through range events. Removed songs leave
+ * stale posting entries that queries skip. The lists are rebuilt once stale
+ * entries outnumber live ones.
+ */
+class TitleSearchIndex final : public IPlaylistObserver {
+public:
+    explicit TitleSearchIndex(Playlist& playlist);
+    ~TitleSearchIndex() override;
+
+    TitleSearchIndex(const TitleSearchIndex&) = delete;
+    TitleSearchIndex& operator=(const TitleSearchIndex&) = delete;
+    TitleSearchIndex(TitleSearchIndex&&) = delete;
+    TitleSearchIndex& operator=(TitleSearchIndex&&) = delete;
+
+    /**
+     * @brief False if the playlist's observer table was full; queries then
+     *        find nothing
+     */
+    [[nodiscard]] bool IsAttached() const noexcept {
+        return attached_;
+    }
+
+    /**
+     * @brief Songs with a title word starting with @p query
+     *
+     * Replaces @p out with at most @p maxResults ids, best first: matches at
+     * the start of the title, then earlier matches, then in title order.
+     * Returns the number of ids written.
+     */
+    std::size_t FindPrefix(std::string_view query, std::size_t maxResults, std::vector<Common::SongId>& out);
+
+    /**
+     * @brief Songs whose title contains @p query anywhere; ranked like FindPrefix
+     */
+    std::size_t FindSubstring(std::string_view query, std::size_t maxResults, std::vector<Common::SongId>& out);
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return slots_.Size();
+    }
+
+    void OnPlaylistChanged() override {}
+    void OnSongChanged(Common::SongId /*newSongId*/) override {}
+    void OnSongsInserted(std::size_t first, std::size_t count) override;
+    void OnSongsRemoved(std::size_t first, std::size_t count) override;
+    void OnSongsUpdated(std::size_t first, std::size_t count) override;
+
+private:
+    struct Match {
+        std::uint32_t position;
+        std::uint32_t slot;
+    };
+
+    void Add(Common::SongId id);
+    void Remove(Common::SongId id);
+
+    void IndexTitle(std::uint32_t slot);
+    void AddPosting(std::uint32_t key, std::uint32_t slot);
+
+    /**
+     * @brief Posting list for @p key, or nullptr if no title has that gram
+     */
+    [[nodiscard]] const std::vector<std::uint32_t>* Postings(std::uint32_t key) const noexcept;
+    void MaybeRebuildPostings();
+
+    std::size_t Find(std::string_view query, bool wordPrefix, std::size_t maxResults,
+                     std::vector<Common::SongId>& out);
+    [[nodiscard]] bool MatchAt(std::string_view title, std::string_view query, bool wordPrefix,
+                               std::uint32_t& outPosition) const noexcept;
+
+    Playlist& playlist_;
+    bool attached_{false};
+    SongIdMirror mirror_;
+
+    // Folded titles by slot; slotIds_[slot] == 0 marks a free slot.
+    SongIndex slots_;
+    std::vector<Common::SongId> slotIds_;
+    std::vector<std::uint32_t> slotEntries_; ///< Posting entries added for the slot
+    ArenaTitleTable folded_;
+    std::vector<std::uint32_t> freeSlots_;
+
+    // Gram key -> index into postings_.
+    SongIndex postingIndex_;
+    std::vector<std::vector<std::uint32_t>> postings_;
+    std::size_t liveEntries_{0U};
+    std::size_t staleEntries_{0U};
+
+    // Per-slot query stamp, so a slot listed twice is checked once.
+    std::vector<std::uint32_t> seen_;
+    std::uint32_t queryStamp_{0U};
+
+    std::string scratch_;
+    std::vector<Match> matches_;
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
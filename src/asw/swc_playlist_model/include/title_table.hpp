@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "fixed_string.hpp"
+#include "static_vector.hpp"
+#include "string_arena.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+/**
+ * @brief Per-slot song titles packed into one StringArena
+ *
+ * Used by the growable storage policy. A title costs its bytes plus a
+ * 16-byte view instead of a separately allocated std::string. Replaced and
+ * released titles leave dead bytes behind; once those outweigh the live
+ * ones, the live titles are copied into a fresh arena. That moves every
+ * title, so views handed out earlier must not be kept across mutations.
+ */
+class ArenaTitleTable {
+public:
+    void Reserve(std::size_t count) {
+        views_.reserve(count);
+    }
+
+    void EmplaceBack() {
+        views_.emplace_back();
+    }
+
+    [[nodiscard]] std::string_view Get(std::uint32_t slot) const noexcept {
+        return views_[slot];
+    }
+
+    void Set(std::uint32_t slot, std::string_view title);
+    void Release(std::uint32_t slot);
+
+    /**
+     * @brief Drop all titles; the slot count is kept
+     */
+    void Clear() noexcept;
+
+    [[nodiscard]] std::size_t LiveBytes() const noexcept {
+        return liveBytes_;
+    }
+
+    [[nodiscard]] std::size_t ReservedBytes() const noexcept {
+        return arena_.BytesReserved();
+    }
+
+private:
+    // Below this, dead bytes are cheaper to keep than to compact away.
+    static constexpr std::size_t kCompactMinDeadBytes = 64U * 1024U;
+
+    void MaybeCompact();
+
+    Common::StringArena arena_;
+    std::vector<std::string_view> views_;
+    std::size_t liveBytes_{0U};
+    std::size_t deadBytes_{0U};
+};
+
+/**
+ * @brief Per-slot song titles stored inline (no heap)
+ *
+ * Used by fixed-capacity storage policies. Titles longer than MaxTitleLength
+ * are truncated on a UTF-8 boundary.
+ *
+ * @tparam N Number of slots
+ * @tparam MaxTitleLength Title bytes kept per slot
+ */
+template <std::size_t N, std::size_t MaxTitleLength>
+class InlineTitleTable {
+public:
+    void Reserve(std::size_t /*count*/) const noexcept {}
+
+    void EmplaceBack() {
+        titles_.emplace_back();
+    }
+
+    [[nodiscard]] std::string_view Get(std::uint32_t slot) const noexcept {
+        return titles_[slot].View();
+    }
+
+    void Set(std::uint32_t slot, std::string_view title) noexcept {
+        titles_[slot].assign(title.data(), title.size());
+    }
+
+    void Release(std::uint32_t slot) noexcept {
+        titles_[slot].clear();
+    }
+
+    void Clear() noexcept {
+        for (auto& title : titles_) {
+            title.clear();
+        }
+    }
+
+private:
+    Common::StaticVector<Common::FixedString<MaxTitleLength>, N> titles_;
+};
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
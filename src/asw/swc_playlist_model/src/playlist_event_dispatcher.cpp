@@ -0,0 +1,120 @@
+#include "playlist_event_dispatcher.hpp"
+
+#include <algorithm>
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+PlaylistEventDispatcher::~PlaylistEventDispatcher() {
+    Stop();
+}
+
+Common::AppError PlaylistEventDispatcher::RegisterObserver(IPlaylistObserver* observer) {
+    if (observer == nullptr) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (std::find(observers_.begin(), observers_.end(), observer) == observers_.end()) {
+        observers_.push_back(observer);
+    }
+    return Common::AppError::Ok;
+}
+
+void PlaylistEventDispatcher::UnregisterObserver(IPlaylistObserver* observer) {
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
+
+void PlaylistEventDispatcher::OnPlaylistChanged() {
+    Post(EventKind::PlaylistChanged, playlistChangedWaiting_);
+}
+
+void PlaylistEventDispatcher::OnSongChanged(Common::SongId newSongId) {
+    latestSongId_.store(newSongId, std::memory_order_relaxed);
+    Post(EventKind::SongChanged, songChangedWaiting_);
+}
+
+void PlaylistEventDispatcher::Post(EventKind kind, std::atomic<bool>& waiting) {
+    posted_.fetch_add(1U, std::memory_order_relaxed);
+    if (waiting.exchange(true, std::memory_order_acq_rel)) {
+        coalesced_.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    // Count before pushing: Pump decrements only after popping, so the
+    // counter never drops below the number of queued events (and never
+    // wraps). One cell per kind at most, so the push cannot fail.
+    queued_.fetch_add(1U, std::memory_order_seq_cst);
+    (void)queue_.TryPush(kind);
+    if (sleeping_.load(std::memory_order_seq_cst)) {
+        const std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_.notify_one();
+    }
+}
+
+std::size_t PlaylistEventDispatcher::Pump() {
+    std::size_t delivered = 0U;
+    EventKind kind{};
+    while (queue_.TryPop(kind)) {
+        queued_.fetch_sub(1U, std::memory_order_seq_cst);
+        Deliver(kind);
+        ++delivered;
+    }
+    return delivered;
+}
+
+void PlaylistEventDispatcher::Deliver(EventKind kind) {
+    // Clear the flag before reading the payload: an event posted from now on
+    // queues a new delivery instead of being merged into this one.
+    switch (kind) {
+    case EventKind::PlaylistChanged:
+        playlistChangedWaiting_.store(false, std::memory_order_release);
+        for (auto* observer : observers_) {
+            observer->OnPlaylistChanged();
+        }
+        break;
+    case EventKind::SongChanged: {
+        (void)songChangedWaiting_.exchange(false, std::memory_order_acq_rel);
+        const Common::SongId id = latestSongId_.load(std::memory_order_relaxed);
+        for (auto* observer : observers_) {
+            observer->OnSongChanged(id);
+        }
+        break;
+    }
+    }
+}
+
+Common::AppError PlaylistEventDispatcher::Start() {
+    if (running_.exchange(true)) {
+        return Common::AppError::Busy;
+    }
+
+    consumer_ = std::thread([this]() { ConsumerLoop(); });
+    return Common::AppError::Ok;
+}
+
+void PlaylistEventDispatcher::Stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_.notify_one();
+    }
+    consumer_.join();
+}
+
+void PlaylistEventDispatcher::ConsumerLoop() {
+    while (running_.load()) {
+        if (Pump() != 0U) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        sleeping_.store(true, std::memory_order_seq_cst);
+        wake_.wait(lock, [this]() { return queued_.load(std::memory_order_seq_cst) != 0U || !running_.load(); });
+        sleeping_.store(false, std::memory_order_relaxed);
+    }
+    (void)Pump();
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,157 @@
+#include "playlist_snapshot.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+SnapshotChunk::SnapshotChunk(const Playlist& playlist, std::size_t position, std::size_t count) {
+    entries_.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        const auto song = playlist.At(position + i);
+        if (!song.has_value()) {
+            break;
+        }
+        entries_.push_back(Entry{song->id, song->durationSeconds, static_cast<std::uint32_t>(titles_.size()),
+                                 static_cast<std::uint32_t>(song->title.size())});
+        titles_.append(song->title);
+    }
+}
+
+SongView SnapshotChunk::At(std::size_t index) const noexcept {
+    const Entry& entry = entries_[index];
+    return SongView{entry.id, std::string_view(titles_).substr(entry.titleOffset, entry.titleLength),
+                    entry.durationSeconds};
+}
+
+std::optional<SongView> PlaylistSnapshot::At(std::size_t position) const noexcept {
+    const auto it = std::upper_bound(ends_.begin(), ends_.end(), position);
+    if (it == ends_.end()) {
+        return std::nullopt;
+    }
+
+    const auto chunk = static_cast<std::size_t>(it - ends_.begin());
+    const std::size_t chunkStart = chunk == 0U ? 0U : ends_[chunk - 1U];
+    return chunks_[chunk]->At(position - chunkStart);
+}
+
+PlaylistSnapshotPublisher::PlaylistSnapshotPublisher(Playlist& playlist) : playlist_(playlist) {
+    Rechunk(0U, 0U, 0U, playlist_.Size());
+    Publish();
+    attached_ = playlist_.RegisterObserver(this) == Common::AppError::Ok;
+}
+
+PlaylistSnapshotPublisher::~PlaylistSnapshotPublisher() {
+    if (attached_) {
+        playlist_.UnregisterObserver(this);
+    }
+}
+
+void PlaylistSnapshotPublisher::OnPlaylistChanged() {
+    Publish();
+}
+
+void PlaylistSnapshotPublisher::OnSongChanged(Common::SongId /*newSongId*/) {
+    Publish();
+}
+
+void PlaylistSnapshotPublisher::OnSongsInserted(std::size_t first, std::size_t count) {
+    std::size_t chunk = 0U;
+    std::size_t chunkStart = 0U;
+    Locate(first, chunk, chunkStart);
+    if (chunk == chunks_.size() && chunk != 0U) {
+        // Appending: top up the last chunk.
+        --chunk;
+        chunkStart -= chunks_[chunk]->Size();
+    }
+
+    const std::size_t oldSize = chunk < chunks_.size() ? chunks_[chunk]->Size() : 0U;
+    Rechunk(chunk, std::min(chunk + 1U, chunks_.size()), chunkStart, oldSize + count);
+}
+
+void PlaylistSnapshotPublisher::OnSongsRemoved(std::size_t first, std::size_t count) {
+    std::size_t firstChunk = 0U;
+    std::size_t chunkStart = 0U;
+    Locate(first, firstChunk, chunkStart);
+
+    // Chunks overlapping the removed range, plus the next one if what is
+    // left would be a sliver.
+    std::size_t lastChunk = firstChunk;
+    std::size_t regionSize = 0U;
+    while (lastChunk < chunks_.size() && chunkStart + regionSize < first + count) {
+        regionSize += chunks_[lastChunk++]->Size();
+    }
+    regionSize -= count;
+    if (regionSize < kMaxChunkSongs / 4U && lastChunk < chunks_.size() &&
+        regionSize + chunks_[lastChunk]->Size() <= kMaxChunkSongs) {
+        regionSize += chunks_[lastChunk++]->Size();
+    }
+
+    Rechunk(firstChunk, lastChunk, chunkStart, regionSize);
+}
+
+void PlaylistSnapshotPublisher::OnSongsUpdated(std::size_t first, std::size_t count) {
+    std::size_t firstChunk = 0U;
+    std::size_t chunkStart = 0U;
+    Locate(first, firstChunk, chunkStart);
+
+    std::size_t lastChunk = firstChunk;
+    std::size_t regionSize = 0U;
+    while (lastChunk < chunks_.size() && chunkStart + regionSize < first + count) {
+        regionSize += chunks_[lastChunk++]->Size();
+    }
+
+    Rechunk(firstChunk, lastChunk, chunkStart, regionSize);
+}
+
+void PlaylistSnapshotPublisher::Locate(std::size_t position, std::size_t& chunk,
+                                       std::size_t& chunkStart) const noexcept {
+    chunk = 0U;
+    chunkStart = 0U;
+    while (chunk < chunks_.size() && position >= chunkStart + chunks_[chunk]->Size()) {
+        chunkStart += chunks_[chunk]->Size();
+        ++chunk;
+    }
+}
+
+void PlaylistSnapshotPublisher::Rechunk(std::size_t firstChunk, std::size_t lastChunk, std::size_t position,
+                                        std::size_t count) {
+    // Even split, so a chunk that just overflowed becomes two half-full ones.
+    const std::size_t pieces = (count + kMaxChunkSongs - 1U) / kMaxChunkSongs;
+    std::vector<std::shared_ptr<const SnapshotChunk>> fresh;
+    fresh.reserve(pieces);
+    for (std::size_t piece = 0U; piece < pieces; ++piece) {
+        const std::size_t begin = count * piece / pieces;
+        const std::size_t end = count * (piece + 1U) / pieces;
+        fresh.push_back(std::make_shared<const SnapshotChunk>(playlist_, position + begin, end - begin));
+    }
+
+    const auto first = chunks_.begin() + static_cast<std::ptrdiff_t>(firstChunk);
+    const auto last = chunks_.begin() + static_cast<std::ptrdiff_t>(lastChunk);
+    const auto replaced = static_cast<std::ptrdiff_t>(lastChunk - firstChunk);
+    const auto common = std::min(replaced, static_cast<std::ptrdiff_t>(fresh.size()));
+    std::move(fresh.begin(), fresh.begin() + common, first);
+    if (replaced > common) {
+        chunks_.erase(first + common, last);
+    } else {
+        chunks_.insert(first + common, std::make_move_iterator(fresh.begin() + common),
+                       std::make_move_iterator(fresh.end()));
+    }
+}
+
+void PlaylistSnapshotPublisher::Publish() {
+    auto snapshot = std::make_shared<PlaylistSnapshot>();
+    snapshot->chunks_ = chunks_;
+    snapshot->ends_.reserve(chunks_.size());
+    std::size_t end = 0U;
+    for (const auto& chunk : chunks_) {
+        end += chunk->Size();
+        snapshot->ends_.push_back(end);
+    }
+    snapshot->currentPosition_ = playlist_.CurrentPosition();
+    snapshot->version_ = ++version_;
+    published_.Store(std::move(snapshot));
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,322 @@
+#include "playlist_view.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "title_folding.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+namespace {
+
+// Above this share of new rows, one sort beats placing rows one by one.
+constexpr std::size_t kRebuildDivisor = 8U;
+
+} // namespace
+
+PlaylistView::PlaylistView(Playlist& playlist, Order order, Filter filter)
+    : playlist_(playlist), order_(order), filter_(std::move(filter)) {
+    attached_ = playlist_.RegisterObserver(this) == Common::AppError::Ok;
+    if (attached_) {
+        OnSongsInserted(0U, playlist_.Size());
+    }
+}
+
+PlaylistView::~PlaylistView() {
+    if (attached_) {
+        playlist_.UnregisterObserver(this);
+    }
+}
+
+std::size_t PlaylistView::Size() {
+    Flush();
+    return rowCount_;
+}
+
+std::optional<SongView> PlaylistView::At(std::size_t row) {
+    Flush();
+    if (row >= rowCount_) {
+        return std::nullopt;
+    }
+
+    std::size_t chunk = 0U;
+    std::size_t offset = 0U;
+    Locate(row, chunk, offset);
+    return ViewOf(chunks_[chunk][offset]);
+}
+
+std::size_t PlaylistView::Window(std::size_t first, std::size_t count, std::vector<SongView>& out) {
+    Flush();
+    out.clear();
+    if (first >= rowCount_) {
+        return 0U;
+    }
+
+    count = std::min(count, rowCount_ - first);
+    out.reserve(count);
+
+    std::size_t chunk = 0U;
+    std::size_t offset = 0U;
+    Locate(first, chunk, offset);
+    for (std::size_t visited = 0U; visited < count; ++visited) {
+        const auto song = ViewOf(chunks_[chunk][offset]);
+        if (song.has_value()) {
+            out.push_back(*song);
+        }
+        if (++offset == chunks_[chunk].size()) {
+            ++chunk;
+            offset = 0U;
+        }
+    }
+    return out.size();
+}
+
+std::optional<std::size_t> PlaylistView::RowOf(Common::SongId id) {
+    Flush();
+    const std::uint32_t slot = keySlots_.Find(id);
+    if (slot == SongIndex::kInvalidSlot || keys_[slot].state != State::Placed) {
+        return std::nullopt;
+    }
+
+    const Row row = RowFor(slot);
+    const std::size_t chunk = ChunkFor(row);
+    std::size_t position = 0U;
+    for (std::size_t i = 0U; i < chunk; ++i) {
+        position += chunks_[i].size();
+    }
+    const auto& rows = chunks_[chunk];
+    const auto it = std::lower_bound(rows.begin(), rows.end(), row,
+                                     [this](const Row& lhs, const Row& rhs) { return Less(lhs, rhs); });
+    return position + static_cast<std::size_t>(it - rows.begin());
+}
+
+void PlaylistView::OnSongsInserted(std::size_t first, std::size_t count) {
+    mirror_.Insert(playlist_, first, count, [this](Common::SongId id) { Track(id); });
+}
+
+void PlaylistView::OnSongsRemoved(std::size_t first, std::size_t count) {
+    mirror_.Remove(first, count, [this](Common::SongId id) { Untrack(id); });
+}
+
+void PlaylistView::OnSongsUpdated(std::size_t first, std::size_t count) {
+    for (std::size_t i = first; i < first + count; ++i) {
+        const std::uint32_t slot = keySlots_.Find(mirror_[i]);
+        if (slot != SongIndex::kInvalidSlot) {
+            MarkPending(slot);
+        }
+    }
+}
+
+void PlaylistView::Track(Common::SongId id) {
+    std::uint32_t slot = 0U;
+    if (!freeKeySlots_.empty()) {
+        slot = freeKeySlots_.back();
+        freeKeySlots_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(keys_.size());
+        keys_.emplace_back();
+        foldedTitles_.EmplaceBack();
+    }
+
+    // Arrival order is fixed when the song shows up, not when it is placed.
+    keys_[slot] = KeyRecord{order_ == Order::Added ? nextSequence_++ : 0U, id, State::Free};
+    keySlots_.Insert(id, slot);
+    MarkPending(slot);
+}
+
+void PlaylistView::Untrack(Common::SongId id) {
+    const std::uint32_t slot = keySlots_.Find(id);
+    if (slot == SongIndex::kInvalidSlot) {
+        return;
+    }
+
+    if (keys_[slot].state == State::Placed) {
+        EraseRow(RowFor(slot));
+    }
+    // A stale pending_ entry for this slot is skipped by Flush.
+    keys_[slot].state = State::Free;
+    foldedTitles_.Release(slot);
+    (void)keySlots_.Erase(id);
+    freeKeySlots_.push_back(slot);
+}
+
+void PlaylistView::MarkPending(std::uint32_t keySlot) {
+    KeyRecord& key = keys_[keySlot];
+    if (key.state == State::Pending) {
+        return;
+    }
+    if (key.state == State::Placed) {
+        EraseRow(RowFor(keySlot));
+    }
+    key.state = State::Pending;
+    pending_.push_back(keySlot);
+}
+
+void PlaylistView::Flush() {
+    if (pending_.empty()) {
+        return;
+    }
+
+    std::vector<Row> fresh;
+    fresh.reserve(pending_.size());
+    for (const std::uint32_t slot : pending_) {
+        KeyRecord& key = keys_[slot];
+        if (key.state != State::Pending) {
+            continue;
+        }
+
+        const auto song = playlist_.Get(playlist_.Find(key.id));
+        if (!song.has_value() || (filter_ && !filter_(*song))) {
+            key.state = State::Hidden;
+            continue;
+        }
+
+        ComputeKey(slot, *song);
+        key.state = State::Placed;
+        fresh.push_back(RowFor(slot));
+    }
+    pending_.clear();
+
+    if (fresh.size() > rowCount_ / kRebuildDivisor) {
+        std::vector<Row> rows;
+        rows.reserve(rowCount_ + fresh.size());
+        for (auto& chunk : chunks_) {
+            rows.insert(rows.end(), chunk.begin(), chunk.end());
+        }
+        rows.insert(rows.end(), fresh.begin(), fresh.end());
+        Rebuild(std::move(rows));
+        return;
+    }
+
+    for (const Row& row : fresh) {
+        InsertRow(row);
+    }
+}
+
+void PlaylistView::ComputeKey(std::uint32_t keySlot, const SongView& song) {
+    switch (order_) {
+    case Order::Title:
+        foldScratch_.clear();
+        AppendFolded(song.title, foldScratch_);
+        foldedTitles_.Set(keySlot, foldScratch_);
+        keys_[keySlot].primary = KeyPrefix(foldScratch_);
+        break;
+    case Order::Duration:
+        keys_[keySlot].primary = song.durationSeconds;
+        break;
+    case Order::Added:
+        break;
+    }
+}
+
+PlaylistView::Row PlaylistView::RowFor(std::uint32_t keySlot) const noexcept {
+    return Row{keys_[keySlot].primary, keys_[keySlot].id, keySlot};
+}
+
+bool PlaylistView::Less(const Row& lhs, const Row& rhs) const noexcept {
+    if (lhs.primary != rhs.primary) {
+        return lhs.primary < rhs.primary;
+    }
+    if (order_ == Order::Title) {
+        const int cmp = foldedTitles_.Get(lhs.keySlot).compare(foldedTitles_.Get(rhs.keySlot));
+        if (cmp != 0) {
+            return cmp < 0;
+        }
+    }
+    return lhs.id < rhs.id;
+}
+
+std::size_t PlaylistView::ChunkFor(const Row& row) const noexcept {
+    // First chunk whose last row is not less than @p row; rows past the end
+    // of the view go to the last chunk.
+    std::size_t lo = 0U;
+    std::size_t hi = chunks_.size();
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2U;
+        if (Less(chunks_[mid].back(), row)) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+    return std::min(lo, chunks_.size() - 1U);
+}
+
+void PlaylistView::InsertRow(const Row& row) {
+    if (chunks_.empty()) {
+        chunks_.emplace_back();
+        chunks_.back().reserve(kMaxChunkRows);
+        chunks_.back().push_back(row);
+        rowCount_ = 1U;
+        return;
+    }
+
+    const std::size_t chunk = ChunkFor(row);
+    auto& rows = chunks_[chunk];
+    const auto it = std::lower_bound(rows.begin(), rows.end(), row,
+                                     [this](const Row& lhs, const Row& rhs) { return Less(lhs, rhs); });
+    rows.insert(it, row);
+    ++rowCount_;
+
+    if (rows.size() > kMaxChunkRows) {
+        Chunk upper(rows.begin() + static_cast<std::ptrdiff_t>(kMaxChunkRows / 2U), rows.end());
+        rows.resize(kMaxChunkRows / 2U);
+        chunks_.insert(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk + 1U), std::move(upper));
+    }
+}
+
+void PlaylistView::EraseRow(const Row& row) {
+    if (chunks_.empty()) {
+        return;
+    }
+
+    const std::size_t chunk = ChunkFor(row);
+    auto& rows = chunks_[chunk];
+    const auto it = std::lower_bound(rows.begin(), rows.end(), row,
+                                     [this](const Row& lhs, const Row& rhs) { return Less(lhs, rhs); });
+    if (it == rows.end() || it->id != row.id) {
+        return;
+    }
+    rows.erase(it);
+    --rowCount_;
+
+    // Keep chunks from fragmenting: fold a small chunk into its successor.
+    const bool hasNext = chunk + 1U < chunks_.size();
+    if (rows.empty()) {
+        chunks_.erase(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk));
+    } else if (hasNext && rows.size() + chunks_[chunk + 1U].size() <= kMaxChunkRows / 2U) {
+        auto& next = chunks_[chunk + 1U];
+        next.insert(next.begin(), rows.begin(), rows.end());
+        chunks_.erase(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk));
+    }
+}
+
+void PlaylistView::Rebuild(std::vector<Row> rows) {
+    std::sort(rows.begin(), rows.end(), [this](const Row& lhs, const Row& rhs) { return Less(lhs, rhs); });
+
+    // Half-full chunks leave room for later inserts before the first split.
+    constexpr std::size_t kFill = kMaxChunkRows / 2U;
+    chunks_.clear();
+    for (std::size_t first = 0U; first < rows.size(); first += kFill) {
+        const std::size_t last = std::min(first + kFill, rows.size());
+        chunks_.emplace_back(rows.begin() + static_cast<std::ptrdiff_t>(first),
+                             rows.begin() + static_cast<std::ptrdiff_t>(last));
+    }
+    rowCount_ = rows.size();
+}
+
+void PlaylistView::Locate(std::size_t row, std::size_t& chunk, std::size_t& offset) const noexcept {
+    chunk = 0U;
+    while (row >= chunks_[chunk].size()) {
+        row -= chunks_[chunk].size();
+        ++chunk;
+    }
+    offset = row;
+}
+
+std::optional<SongView> PlaylistView::ViewOf(const Row& row) const noexcept {
+    return playlist_.Get(playlist_.Find(row.id));
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
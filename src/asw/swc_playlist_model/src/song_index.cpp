@@ -0,0 +1,8 @@
+#include "song_index.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+template class BasicSongIndex<DynamicCapacity>;
+template class BasicSongIndex<FixedCapacity<Common::kMaxPlaylistSize>>;
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
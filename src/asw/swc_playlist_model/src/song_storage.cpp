@@ -0,0 +1,8 @@
+#include "song_storage.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+template class BasicSongStorage<DynamicCapacity>;
+template class BasicSongStorage<FixedCapacity<Common::kMaxPlaylistSize>>;
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,94 @@
+#include "title_folding.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+namespace {
+
+// U+00C0..U+00FF. nullptr keeps the character as is (the two operators).
+constexpr std::array<const char*, 64U> kLatin1Folding = {
+    "a",  "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",  // C0-CF
+    "d",  "n", "o", "o", "o", "o", "o",  nullptr, "o", "u", "u", "u", "u", "y", "th", "ss", // D0-DF
+    "a",  "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",  // E0-EF
+    "d",  "n", "o", "o", "o", "o", "o",  nullptr, "o", "u", "u", "u", "u", "y", "th", "y",  // F0-FF
+};
+
+struct FoldRange {
+    std::uint32_t first;
+    std::uint32_t last;
+    const char* folded;
+};
+
+// U+0100..U+017F: upper/lower pairs of the same base letter are adjacent.
+constexpr std::array<FoldRange, 22U> kLatinExtendedAFolding = {{
+    {0x100U, 0x105U, "a"},  {0x106U, 0x10DU, "c"},  {0x10EU, 0x111U, "d"}, {0x112U, 0x11BU, "e"},
+    {0x11CU, 0x123U, "g"},  {0x124U, 0x127U, "h"},  {0x128U, 0x131U, "i"}, {0x132U, 0x133U, "ij"},
+    {0x134U, 0x135U, "j"},  {0x136U, 0x138U, "k"},  {0x139U, 0x142U, "l"}, {0x143U, 0x14BU, "n"},
+    {0x14CU, 0x151U, "o"},  {0x152U, 0x153U, "oe"}, {0x154U, 0x159U, "r"}, {0x15AU, 0x161U, "s"},
+    {0x162U, 0x167U, "t"},  {0x168U, 0x173U, "u"},  {0x174U, 0x175U, "w"}, {0x176U, 0x178U, "y"},
+    {0x179U, 0x17EU, "z"},  {0x17FU, 0x17FU, "s"},
+}};
+
+const char* FoldCodePoint(std::uint32_t codePoint) noexcept {
+    if (codePoint >= 0xC0U && codePoint <= 0xFFU) {
+        return kLatin1Folding[codePoint - 0xC0U];
+    }
+    for (const auto& range : kLatinExtendedAFolding) {
+        if (codePoint >= range.first && codePoint <= range.last) {
+            return range.folded;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+void AppendFolded(std::string_view title, std::string& out) {
+    constexpr unsigned char kTwoByteLead = 0xC0U;
+    constexpr unsigned char kTwoByteMask = 0xE0U;
+    constexpr unsigned char kContinuationMask = 0xC0U;
+    constexpr unsigned char kContinuation = 0x80U;
+
+    out.reserve(out.size() + title.size());
+    std::size_t i = 0U;
+    while (i < title.size()) {
+        const auto lead = static_cast<unsigned char>(title[i]);
+        if (lead >= 'A' && lead <= 'Z') {
+            out.push_back(static_cast<char>(lead - 'A' + 'a'));
+            ++i;
+            continue;
+        }
+
+        // Only two-byte sequences can be Latin-1 / Latin Extended-A letters.
+        if ((lead & kTwoByteMask) == kTwoByteLead && i + 1U < title.size()) {
+            const auto trail = static_cast<unsigned char>(title[i + 1U]);
+            if ((trail & kContinuationMask) == kContinuation) {
+                const std::uint32_t codePoint = ((lead & 0x1FU) << 6U) | (trail & 0x3FU);
+                const char* folded = FoldCodePoint(codePoint);
+                if (folded != nullptr) {
+                    out.append(folded);
+                } else {
+                    out.append(title.substr(i, 2U));
+                }
+                i += 2U;
+                continue;
+            }
+        }
+
+        out.push_back(title[i]);
+        ++i;
+    }
+}
+
+std::uint64_t KeyPrefix(std::string_view foldedKey) noexcept {
+    std::uint64_t prefix = 0U;
+    for (std::size_t i = 0U; i < 8U; ++i) {
+        const std::uint64_t byte = i < foldedKey.size() ? static_cast<unsigned char>(foldedKey[i]) : 0U;
+        prefix = (prefix << 8U) | byte;
+    }
+    return prefix;
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,275 @@
+#include "title_search_index.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "title_folding.hpp"
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+namespace {
+
+// Below this, stale posting entries are cheaper to skip than to rebuild.
+constexpr std::size_t kRebuildMinStaleEntries = 64U * 1024U;
+
+constexpr std::uint32_t kTrigramTag = 3U << 24U;
+constexpr std::uint32_t kWordStart1Tag = 1U << 24U;
+constexpr std::uint32_t kWordStart2Tag = 2U << 24U;
+
+std::uint32_t Byte(std::string_view text, std::size_t pos) noexcept {
+    return static_cast<unsigned char>(text[pos]);
+}
+
+// Bytes of multi-byte UTF-8 sequences count as word characters, so words
+// in other scripts are not split apart.
+bool IsWordByte(char c) noexcept {
+    const auto byte = static_cast<unsigned char>(c);
+    return (byte >= 'a' && byte <= 'z') || (byte >= '0' && byte <= '9') || byte >= 0x80U;
+}
+
+bool IsWordStart(std::string_view text, std::size_t pos) noexcept {
+    return IsWordByte(text[pos]) && (pos == 0U || !IsWordByte(text[pos - 1U]));
+}
+
+// Calls fn(key) for every gram of a folded title (duplicates included).
+template <typename Fn>
+void ForEachGram(std::string_view folded, Fn&& fn) {
+    for (std::size_t i = 0U; i < folded.size(); ++i) {
+        if (i + 2U < folded.size()) {
+            fn(kTrigramTag | (Byte(folded, i) << 16U) | (Byte(folded, i + 1U) << 8U) | Byte(folded, i + 2U));
+        }
+        if (IsWordStart(folded, i)) {
+            fn(kWordStart1Tag | (Byte(folded, i) << 16U));
+            if (i + 1U < folded.size()) {
+                fn(kWordStart2Tag | (Byte(folded, i) << 16U) | (Byte(folded, i + 1U) << 8U));
+            }
+        }
+    }
+}
+
+} // namespace
+
+TitleSearchIndex::TitleSearchIndex(Playlist& playlist) : playlist_(playlist) {
+    attached_ = playlist_.RegisterObserver(this) == Common::AppError::Ok;
+    if (attached_) {
+        OnSongsInserted(0U, playlist_.Size());
+    }
+}
+
+TitleSearchIndex::~TitleSearchIndex() {
+    if (attached_) {
+        playlist_.UnregisterObserver(this);
+    }
+}
+
+std::size_t TitleSearchIndex::FindPrefix(std::string_view query, std::size_t maxResults,
+                                         std::vector<Common::SongId>& out) {
+    return Find(query, true, maxResults, out);
+}
+
+std::size_t TitleSearchIndex::FindSubstring(std::string_view query, std::size_t maxResults,
+                                            std::vector<Common::SongId>& out) {
+    return Find(query, false, maxResults, out);
+}
+
+void TitleSearchIndex::OnSongsInserted(std::size_t first, std::size_t count) {
+    mirror_.Insert(playlist_, first, count, [this](Common::SongId id) { Add(id); });
+}
+
+void TitleSearchIndex::OnSongsRemoved(std::size_t first, std::size_t count) {
+    mirror_.Remove(first, count, [this](Common::SongId id) { Remove(id); });
+    MaybeRebuildPostings();
+}
+
+void TitleSearchIndex::OnSongsUpdated(std::size_t first, std::size_t count) {
+    for (std::size_t i = first; i < first + count; ++i) {
+        Remove(mirror_[i]);
+        Add(mirror_[i]);
+    }
+    MaybeRebuildPostings();
+}
+
+void TitleSearchIndex::Add(Common::SongId id) {
+    const auto song = playlist_.Get(playlist_.Find(id));
+    if (!song.has_value()) {
+        return;
+    }
+
+    std::uint32_t slot = 0U;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(slotIds_.size());
+        slotIds_.push_back(0U);
+        slotEntries_.push_back(0U);
+        folded_.EmplaceBack();
+        seen_.push_back(0U);
+    }
+
+    scratch_.clear();
+    AppendFolded(song->title, scratch_);
+    folded_.Set(slot, scratch_);
+    slotIds_[slot] = id;
+    slots_.Insert(id, slot);
+    IndexTitle(slot);
+}
+
+void TitleSearchIndex::Remove(Common::SongId id) {
+    const std::uint32_t slot = slots_.Find(id);
+    if (slot == SongIndex::kInvalidSlot) {
+        return;
+    }
+
+    // Posting entries stay behind; queries skip or re-check them.
+    liveEntries_ -= slotEntries_[slot];
+    staleEntries_ += slotEntries_[slot];
+
+    slotIds_[slot] = 0U;
+    folded_.Release(slot);
+    (void)slots_.Erase(id);
+    freeSlots_.push_back(slot);
+}
+
+void TitleSearchIndex::IndexTitle(std::uint32_t slot) {
+    const std::size_t before = liveEntries_;
+    ForEachGram(folded_.Get(slot), [this, slot](std::uint32_t key) { AddPosting(key, slot); });
+    slotEntries_[slot] = static_cast<std::uint32_t>(liveEntries_ - before);
+}
+
+void TitleSearchIndex::AddPosting(std::uint32_t key, std::uint32_t slot) {
+    std::uint32_t list = postingIndex_.Find(key);
+    if (list == SongIndex::kInvalidSlot) {
+        list = static_cast<std::uint32_t>(postings_.size());
+        postings_.emplace_back();
+        postingIndex_.Insert(key, list);
+    }
+    auto& postings = postings_[list];
+    // Repeated grams within one title are listed once.
+    if (postings.empty() || postings.back() != slot) {
+        postings.push_back(slot);
+        ++liveEntries_;
+    }
+}
+
+const std::vector<std::uint32_t>* TitleSearchIndex::Postings(std::uint32_t key) const noexcept {
+    const std::uint32_t list = postingIndex_.Find(key);
+    return list == SongIndex::kInvalidSlot ? nullptr : &postings_[list];
+}
+
+void TitleSearchIndex::MaybeRebuildPostings() {
+    if (staleEntries_ < kRebuildMinStaleEntries || staleEntries_ < liveEntries_) {
+        return;
+    }
+
+    postingIndex_.Clear();
+    postings_.clear();
+    liveEntries_ = 0U;
+    staleEntries_ = 0U;
+    for (std::uint32_t slot = 0U; slot < slotIds_.size(); ++slot) {
+        if (slotIds_[slot] != 0U) {
+            IndexTitle(slot);
+        }
+    }
+}
+
+std::size_t TitleSearchIndex::Find(std::string_view query, bool wordPrefix, std::size_t maxResults,
+                                   std::vector<Common::SongId>& out) {
+    out.clear();
+    scratch_.clear();
+    AppendFolded(query, scratch_);
+    const std::string_view folded = scratch_;
+    if (folded.empty() || maxResults == 0U) {
+        return 0U;
+    }
+
+    // Pick the rarest gram of the query; nullptr means "scan every title".
+    const std::vector<std::uint32_t>* candidates = nullptr;
+    bool scanAll = false;
+    if (folded.size() >= 3U) {
+        for (std::size_t i = 0U; i + 2U < folded.size(); ++i) {
+            const auto* list = Postings(kTrigramTag | (Byte(folded, i) << 16U) | (Byte(folded, i + 1U) << 8U) |
+                                        Byte(folded, i + 2U));
+            if (list == nullptr) {
+                return 0U;
+            }
+            if (candidates == nullptr || list->size() < candidates->size()) {
+                candidates = list;
+            }
+        }
+    } else if (wordPrefix) {
+        const std::uint32_t key = folded.size() == 1U
+                                      ? (kWordStart1Tag | (Byte(folded, 0U) << 16U))
+                                      : (kWordStart2Tag | (Byte(folded, 0U) << 16U) | (Byte(folded, 1U) << 8U));
+        candidates = Postings(key);
+        if (candidates == nullptr) {
+            return 0U;
+        }
+    } else {
+        scanAll = true;
+    }
+
+    if (++queryStamp_ == 0U) {
+        std::fill(seen_.begin(), seen_.end(), 0U);
+        queryStamp_ = 1U;
+    }
+
+    matches_.clear();
+    const auto consider = [&](std::uint32_t slot) {
+        if (slotIds_[slot] == 0U || seen_[slot] == queryStamp_) {
+            return;
+        }
+        seen_[slot] = queryStamp_;
+        std::uint32_t position = 0U;
+        if (MatchAt(folded_.Get(slot), folded, wordPrefix, position)) {
+            matches_.push_back(Match{position, slot});
+        }
+    };
+
+    if (scanAll) {
+        for (std::uint32_t slot = 0U; slot < slotIds_.size(); ++slot) {
+            consider(slot);
+        }
+    } else {
+        for (const std::uint32_t slot : *candidates) {
+            consider(slot);
+        }
+    }
+
+    const auto better = [this](const Match& lhs, const Match& rhs) {
+        if (lhs.position != rhs.position) {
+            return lhs.position < rhs.position;
+        }
+        const int cmp = folded_.Get(lhs.slot).compare(folded_.Get(rhs.slot));
+        if (cmp != 0) {
+            return cmp < 0;
+        }
+        return slotIds_[lhs.slot] < slotIds_[rhs.slot];
+    };
+    const std::size_t count = std::min(maxResults, matches_.size());
+    std::partial_sort(matches_.begin(), matches_.begin() + static_cast<std::ptrdiff_t>(count), matches_.end(),
+                      better);
+
+    out.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        out.push_back(slotIds_[matches_[i].slot]);
+    }
+    return count;
+}
+
+bool TitleSearchIndex::MatchAt(std::string_view title, std::string_view query, bool wordPrefix,
+                               std::uint32_t& outPosition) const noexcept {
+    std::size_t pos = title.find(query);
+    while (pos != std::string_view::npos) {
+        if (!wordPrefix || IsWordStart(title, pos)) {
+            outPosition = pos > std::numeric_limits<std::uint32_t>::max()
+                              ? std::numeric_limits<std::uint32_t>::max()
+                              : static_cast<std::uint32_t>(pos);
+            return true;
+        }
+        pos = title.find(query, pos + 1U);
+    }
+    return false;
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
@@ -0,0 +1,47 @@
+#include "title_table.hpp"
+
+#include <utility>
+
+namespace AutosarMusicPlayer::Asw::Playlist {
+
+void ArenaTitleTable::Set(std::uint32_t slot, std::string_view title) {
+    deadBytes_ += views_[slot].size();
+    liveBytes_ -= views_[slot].size();
+
+    views_[slot] = arena_.Store(title);
+    liveBytes_ += title.size();
+
+    MaybeCompact();
+}
+
+void ArenaTitleTable::Release(std::uint32_t slot) {
+    deadBytes_ += views_[slot].size();
+    liveBytes_ -= views_[slot].size();
+    views_[slot] = std::string_view{};
+
+    MaybeCompact();
+}
+
+void ArenaTitleTable::Clear() noexcept {
+    arena_.Clear();
+    for (auto& view : views_) {
+        view = std::string_view{};
+    }
+    liveBytes_ = 0U;
+    deadBytes_ = 0U;
+}
+
+void ArenaTitleTable::MaybeCompact() {
+    if (deadBytes_ < kCompactMinDeadBytes || deadBytes_ < liveBytes_) {
+        return;
+    }
+
+    Common::StringArena compacted;
+    for (auto& view : views_) {
+        view = compacted.Store(view);
+    }
+    arena_ = std::move(compacted);
+    deadBytes_ = 0U;
+}
+
+} // namespace AutosarMusicPlayer::Asw::Playlist
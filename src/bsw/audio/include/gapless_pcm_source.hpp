@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "app_error_codes.hpp"
+#include "pcm_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+/**
+ * @brief IPcmSource that plays a chain of tracks back to back
+ *
+ * When the current track runs out in the middle of a Read(), the rest of
+ * that call is filled from the queued track, so the stream continues at
+ * the very next sample: no silence, no partial period, no engine restart.
+ *
+ * The track that follows is queued from the control side with QueueNext()
+ * after it has been opened. On its next Read(), the decoder thread decodes
+ * the first prerollFrames of it into a buffer allocated up front. Page
+ * faults, header parsing or decoder start-up of the new track therefore
+ * happen well before the boundary, not on it. One track can be queued at a
+ * time. Transitions() counts the switches; once it moves, the previous
+ * track is no longer read and may be closed.
+ *
+ * Begin() and End() only while the engine is stopped; QueueNext(),
+ * HasQueued() and Transitions() from any thread; Read() from the decoder
+ * thread.
+ */
+class GaplessPcmSource final : public IPcmSource {
+public:
+    static constexpr std::size_t kDefaultPrerollFrames = 4096U;
+
+    explicit GaplessPcmSource(std::uint16_t channels, std::size_t prerollFrames = kDefaultPrerollFrames);
+
+    void Begin(IPcmSource& first);
+    void End();
+
+    /**
+     * @return Busy if a track is already queued
+     */
+    Common::AppError QueueNext(IPcmSource& next);
+
+    [[nodiscard]] bool HasQueued() const noexcept {
+        return queued_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    [[nodiscard]] std::uint64_t Transitions() const noexcept {
+        return transitions_.load(std::memory_order_acquire);
+    }
+
+    std::size_t Read(float* samples, std::size_t frames) override;
+
+private:
+    /**
+     * @brief Take over the queued track and pre-roll it, once the buffer
+     *        is free
+     */
+    void Preroll();
+
+    /**
+     * @brief Frames of the current track: its pre-rolled head first
+     */
+    std::size_t ReadCurrent(float* samples, std::size_t frames);
+
+    std::uint16_t channels_;
+    std::vector<float> preroll_;
+    std::atomic<IPcmSource*> queued_{nullptr};
+    std::atomic<std::uint64_t> transitions_{0U};
+
+    // Decoder thread only
+    IPcmSource* current_{nullptr};
+    IPcmSource* next_{nullptr};    ///< Queued track once pre-rolled; owns the buffer
+    std::size_t headFrames_{0U};   ///< Pre-rolled frames of the current track...
+    std::size_t headPosition_{0U}; ///< ...and how many of them were read
+    std::size_t nextFrames_{0U};   ///< Pre-rolled frames of next_
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+/**
+ * @brief Lock-free SPSC ring of fixed-size PCM periods, allocated once
+ *
+ * Unlike Common::SpscRing, periods are not copied in and out: the producer
+ * fills the buffer returned by WriteSlot() in place and publishes it with
+ * CommitWrite(); the consumer reads ReadSlot() in place and frees it with
+ * ReleaseRead(). Indices are published with release/acquire, so the
+ * samples written before a commit are visible to the consumer.
+ */
+class PcmPeriodRing {
+public:
+    /**
+     * @param periods Number of periods
+     * @param samplesPerPeriod frames * channels
+     */
+    PcmPeriodRing(std::size_t periods, std::size_t samplesPerPeriod)
+        : periods_(periods), samplesPerPeriod_(samplesPerPeriod), samples_(periods * samplesPerPeriod, 0.0F) {}
+
+    PcmPeriodRing(const PcmPeriodRing&) = delete;
+    PcmPeriodRing& operator=(const PcmPeriodRing&) = delete;
+    PcmPeriodRing(PcmPeriodRing&&) = delete;
+    PcmPeriodRing& operator=(PcmPeriodRing&&) = delete;
+    ~PcmPeriodRing() = default;
+
+    /**
+     * @brief Next free period, or nullptr if the ring is full. Producer only.
+     */
+    [[nodiscard]] float* WriteSlot() noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == periods_) {
+            return nullptr;
+        }
+        return &samples_[(tail % periods_) * samplesPerPeriod_];
+    }
+
+    void CommitWrite() noexcept {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Oldest filled period, or nullptr if the ring is empty. Consumer only.
+     */
+    [[nodiscard]] const float* ReadSlot() const noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &samples_[(head % periods_) * samplesPerPeriod_];
+    }
+
+    void ReleaseRead() noexcept {
+        head_.store(head_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Filled periods; exact on either side, approximate elsewhere
+     */
+    [[nodiscard]] std::size_t Fill() const noexcept {
+        // head_ first: it never passes tail_, so a later tail_ cannot be
+        // behind it. The consumer may still move on between the loads.
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return std::min(tail - head, periods_);
+    }
+
+    [[nodiscard]] std::size_t Periods() const noexcept {
+        return periods_;
+    }
+
+    [[nodiscard]] std::size_t SamplesPerPeriod() const noexcept {
+        return samplesPerPeriod_;
+    }
+
+    /**
+     * @brief Drop everything; only while neither side is running
+     */
+    void Reset() noexcept {
+        head_.store(0U, std::memory_order_relaxed);
+        tail_.store(0U, std::memory_order_relaxed);
+    }
+
+private:
+    std::size_t periods_;
+    std::size_t samplesPerPeriod_;
+    std::vector<float> samples_;
+    alignas(64) std::atomic<std::size_t> tail_{0U};
+    alignas(64) std::atomic<std::size_t> head_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "app_error_codes.hpp"
+#include "pcm_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+/**
+ * @brief Discards samples and counts frames; stands in for a DAC on hosts
+ *        without one (the engine still paces it in real time)
+ */
+class NullPcmSink final : public IPcmSink {
+public:
+    Common::AppError Write(const float* samples, std::size_t frames) override;
+
+    [[nodiscard]] std::uint64_t FramesWritten() const noexcept {
+        return framesWritten_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint64_t> framesWritten_{0U};
+};
+
+/**
+ * @brief Appends interleaved float32 samples, in host byte order, to a raw
+ *        file (e.g. for `aplay -f FLOAT_LE` or `sox -t f32`)
+ */
+class FilePcmSink final : public IPcmSink {
+public:
+    explicit FilePcmSink(std::uint16_t channels) : channels_(channels) {}
+    ~FilePcmSink() override;
+
+    FilePcmSink(const FilePcmSink&) = delete;
+    FilePcmSink& operator=(const FilePcmSink&) = delete;
+    FilePcmSink(FilePcmSink&&) = delete;
+    FilePcmSink& operator=(FilePcmSink&&) = delete;
+
+    /**
+     * @brief Create or truncate @p path
+     * @return Busy if a file is already open
+     */
+    Common::AppError Open(const char* path);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return file_ != nullptr;
+    }
+
+    /**
+     * @return NotReady if no file is open
+     */
+    Common::AppError Write(const float* samples, std::size_t frames) override;
+
+    [[nodiscard]] std::uint64_t FramesWritten() const noexcept {
+        return framesWritten_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::uint16_t channels_;
+    std::FILE* file_{nullptr};
+    std::atomic<std::uint64_t> framesWritten_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "app_error_codes.hpp"
+#include "audio_codec.hpp"
+#include "pcm_period_ring.hpp"
+#include "pcm_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+struct PcmEngineConfig {
+    PcmFormat format{};
+    std::uint32_t framesPerPeriod{480U}; ///< 10 ms at 48 kHz
+    std::uint16_t periods{4U};           ///< Ring length; at least 2
+};
+
+struct PcmEngineStats {
+    std::uint64_t periodsPlayed{0U};
+    std::uint64_t underruns{0U};   ///< Periods the ring was empty; silence was written instead
+    std::uint64_t overruns{0U};    ///< Periods skipped because the sink thread woke up a whole period late
+    std::uint64_t writeErrors{0U}; ///< IPcmSink::Write() failures
+    std::size_t fillPeriods{0U};   ///< Decoded periods waiting in the ring
+};
+
+/**
+ * @brief Streaming playback: decoder thread -> period ring -> sink thread
+ *
+ * The decoder thread keeps the PcmPeriodRing full from the IPcmSource and
+ * sleeps for half a period whenever it is. The sink thread wakes at
+ * absolute deadlines, start + n * period, and writes one period to the
+ * IPcmSink per deadline: a decoded one, or silence (an underrun) if the
+ * ring is empty. Like the OS scheduler, a sink thread that wakes up a
+ * whole period late skips the missed deadlines instead of bursting, and
+ * counts each one as an overrun. The two threads share nothing but the
+ * ring's indices; the only lock is the one they sleep on.
+ *
+ * Start() from Stopped decodes the whole ring on the calling thread before
+ * the threads start, so playback begins without an underrun. The sink
+ * thread looks at the state before every period, so Pause() and Start()
+ * after a pause take effect at the next deadline; Stop() wakes both threads
+ * and joins them, dropping whatever is still buffered. While paused nothing
+ * is written and the decoder only tops up the ring.
+ *
+ * When the source ends, the last partial period is padded with silence,
+ * the ring drains, and the sink goes quiet; EndOfStream() turns true. Stop()
+ * and Start() play the source again from wherever it is.
+ *
+ * All samples live in buffers allocated by the constructor.
+ */
+class PcmStreamEngine final : public Hal::IAudioCodec {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    PcmStreamEngine(IPcmSource& source, IPcmSink& sink, const PcmEngineConfig& config);
+    ~PcmStreamEngine() override;
+
+    PcmStreamEngine(const PcmStreamEngine&) = delete;
+    PcmStreamEngine& operator=(const PcmStreamEngine&) = delete;
+    PcmStreamEngine(PcmStreamEngine&&) = delete;
+    PcmStreamEngine& operator=(PcmStreamEngine&&) = delete;
+
+    /**
+     * @return InvalidArgument for a config without samples or with fewer
+     *         than two periods
+     */
+    Common::AppError Start() override;
+
+    /**
+     * @return NotReady while stopped
+     */
+    Common::AppError Pause() override;
+
+    Common::AppError Stop() override;
+
+    /**
+     * @brief Playing or paused
+     */
+    [[nodiscard]] bool IsStarted() const override;
+
+    [[nodiscard]] bool IsPaused() const;
+
+    /**
+     * @brief The source has ended and everything it produced was written
+     */
+    [[nodiscard]] bool EndOfStream() const;
+
+    [[nodiscard]] PcmEngineStats Stats() const;
+
+    [[nodiscard]] Clock::duration Period() const noexcept {
+        return period_;
+    }
+
+private:
+    enum class State : std::uint8_t { Stopped, Playing, Paused };
+
+    void DecoderLoop();
+    void SinkLoop();
+
+    /**
+     * @brief Decode one period into the ring
+     * @return false if the ring is full or the source has ended
+     */
+    bool DecodePeriod();
+
+    [[nodiscard]] bool StopRequested() const;
+
+    IPcmSource& source_;
+    IPcmSink& sink_;
+    PcmEngineConfig config_;
+    Clock::duration period_;
+    PcmPeriodRing ring_;
+    std::vector<float> silence_;
+
+    std::mutex controlMutex_; ///< Serialises Start/Pause/Stop
+    std::atomic<State> state_{State::Stopped};
+    std::atomic<bool> sourceEnded_{false};
+    std::thread decoder_;
+    std::thread sinkThread_;
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+
+    std::atomic<std::uint64_t> periodsPlayed_{0U};
+    std::atomic<std::uint64_t> underruns_{0U};
+    std::atomic<std::uint64_t> overruns_{0U};
+    std::atomic<std::uint64_t> writeErrors_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app_error_codes.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+/**
+ * @brief Stream layout: interleaved 32-bit float samples in [-1, 1]
+ */
+struct PcmFormat {
+    std::uint32_t sampleRate{48000U};
+    std::uint16_t channels{2U};
+};
+
+/**
+ * @brief Producer of PCM, e.g. a decoder; called on the engine's decoder thread
+ */
+class IPcmSource {
+public:
+    virtual ~IPcmSource() = default;
+
+    /**
+     * @brief Write up to @p frames frames into @p samples
+     * @return Frames written; 0 once the stream has ended
+     */
+    virtual std::size_t Read(float* samples, std::size_t frames) = 0;
+};
+
+/**
+ * @brief Consumer of PCM, e.g. a DAC driver; called on the engine's sink
+ *        thread once per period
+ */
+class IPcmSink {
+public:
+    virtual ~IPcmSink() = default;
+
+    virtual Common::AppError Write(const float* samples, std::size_t frames) = 0;
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "app_error_codes.hpp"
+#include "pcm_types.hpp"
+#include "resampler.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+/**
+ * @brief IPcmSource converting a track to the output rate, e.g. a 44.1 kHz
+ *        file for the 48 kHz amplifier
+ *
+ * Reads the upstream source in blocks of kInputFrames and passes them
+ * through a Dsp::Resampler. When the upstream ends, the resampler is
+ * flushed, so a track of n frames yields exactly
+ * Resampler::OutputFramesFor(n) frames. Tracks already at the output rate
+ * are copied through.
+ *
+ * Begin() allocates and must not run concurrently with Read(); one
+ * instance per open track, so that a gapless chain can pre-roll the next
+ * track while this one plays.
+ */
+class ResamplingPcmSource final : public IPcmSource {
+public:
+    static constexpr std::size_t kInputFrames = 512U;
+
+    explicit ResamplingPcmSource(std::uint32_t outputRate = PcmFormat{}.sampleRate,
+                                 Dsp::ResamplerQuality quality = Dsp::ResamplerQuality::High)
+        : outputRate_(outputRate), quality_(quality) {}
+
+    /**
+     * @param format Layout of @p upstream
+     * @return InvalidArgument if the resampler cannot convert @p format
+     */
+    Common::AppError Begin(IPcmSource& upstream, const PcmFormat& format);
+    void End();
+
+    std::size_t Read(float* samples, std::size_t frames) override;
+
+    [[nodiscard]] PcmFormat OutputFormat() const noexcept {
+        return PcmFormat{outputRate_, resampler_.Config().channels};
+    }
+
+    [[nodiscard]] const Dsp::Resampler& Converter() const noexcept {
+        return resampler_;
+    }
+
+private:
+    std::uint32_t outputRate_;
+    Dsp::ResamplerQuality quality_;
+    Dsp::Resampler resampler_;
+    IPcmSource* upstream_{nullptr};
+    std::vector<float> input_;
+    std::size_t inputFrames_{0U};   ///< Frames in input_...
+    std::size_t inputPosition_{0U}; ///< ...and how many were consumed
+    bool upstreamEnded_{false};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
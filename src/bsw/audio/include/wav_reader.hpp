@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app_error_codes.hpp"
+#include "mapped_file.hpp"
+#include "pcm_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+/**
+ * @brief Sample encodings of a WAV data chunk, all little-endian
+ */
+enum class WavSampleFormat : std::uint8_t {
+    Pcm16,
+    Pcm24, ///< Packed, three bytes per sample
+    Pcm32, ///< Also 20/24-bit samples left-justified in 32-bit containers
+    Float32,
+};
+
+struct WavInfo {
+    PcmFormat format{};
+    WavSampleFormat sampleFormat{WavSampleFormat::Pcm16};
+    std::uint16_t bytesPerFrame{0U};
+    std::size_t frames{0U};     ///< Whole frames actually present in the file
+    std::size_t dataOffset{0U}; ///< Start of the samples in the file
+};
+
+/**
+ * @brief Parse the RIFF/WAVE header of a file held in memory
+ *
+ * Accepts WAVE_FORMAT_PCM (16/24/32 bit), WAVE_FORMAT_IEEE_FLOAT (32 bit)
+ * and WAVE_FORMAT_EXTENSIBLE with either sub-format. Unknown chunks are
+ * skipped; a data chunk longer than the file (an interrupted recording) is
+ * cut to the whole frames present.
+ *
+ * @return InvalidArgument if this is not a well-formed WAV file,
+ *         Unsupported if it is one in another encoding
+ */
+Common::AppError ParseWavHeader(const std::uint8_t* data, std::size_t size, WavInfo& info);
+
+/**
+ * @brief Interleaved samples in the file's own encoding; points into the
+ *        mapping and stays valid until the reader is closed
+ */
+struct PcmBlock {
+    const std::uint8_t* data{nullptr};
+    std::size_t frames{0U};
+};
+
+/**
+ * @brief Streaming reader over a memory-mapped WAV file
+ *
+ * NextBlock() hands out views into the mapping, so reading costs no copy
+ * and no syscall; pages come in through the kernel's read-ahead. The
+ * mapping is advised as sequential on Open(), and the reader keeps an
+ * explicit WILLNEED window of kReadAheadBytes in front of the position
+ * (one madvise per half window consumed), so the decoder thread rarely
+ * waits on a page fault.
+ *
+ * As an IPcmSource it converts to float on the way out, e.g. to feed a
+ * PcmStreamEngine. Not thread-safe; use from the decoder thread.
+ */
+class WavReader final : public IPcmSource {
+public:
+    static constexpr std::size_t kReadAheadBytes = std::size_t{1} << 20U;
+
+    /**
+     * @return Busy if a file is open, otherwise the errors of
+     *         Cdd::MappedFile::Open() and ParseWavHeader()
+     */
+    Common::AppError Open(const char* path);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return file_.IsOpen();
+    }
+
+    [[nodiscard]] const WavInfo& Info() const noexcept {
+        return info_;
+    }
+
+    /**
+     * @brief The next up to @p maxFrames frames; empty at the end
+     */
+    PcmBlock NextBlock(std::size_t maxFrames);
+
+    /**
+     * @return InvalidArgument past the last frame
+     */
+    Common::AppError Seek(std::size_t frame);
+
+    [[nodiscard]] std::size_t Position() const noexcept {
+        return position_;
+    }
+
+    std::size_t Read(float* samples, std::size_t frames) override;
+
+    /**
+     * @brief madvise calls issued since Open()
+     */
+    [[nodiscard]] std::uint64_t ReadAheadCalls() const noexcept {
+        return file_.AdviceCalls();
+    }
+
+private:
+    void ReadAhead(std::size_t upTo);
+
+    Cdd::MappedFile file_;
+    WavInfo info_{};
+    std::size_t position_{0U};
+    std::size_t prefetchedTo_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,89 @@
+#include "gapless_pcm_source.hpp"
+
+#include <algorithm>
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+GaplessPcmSource::GaplessPcmSource(std::uint16_t channels, std::size_t prerollFrames)
+    : channels_(channels), preroll_(prerollFrames * channels, 0.0F) {}
+
+void GaplessPcmSource::Begin(IPcmSource& first) {
+    End();
+    current_ = &first;
+}
+
+void GaplessPcmSource::End() {
+    current_ = nullptr;
+    next_ = nullptr;
+    headFrames_ = 0U;
+    headPosition_ = 0U;
+    nextFrames_ = 0U;
+    queued_.store(nullptr, std::memory_order_release);
+}
+
+Common::AppError GaplessPcmSource::QueueNext(IPcmSource& next) {
+    IPcmSource* expected = nullptr;
+    return queued_.compare_exchange_strong(expected, &next, std::memory_order_acq_rel) ? Common::AppError::Ok
+                                                                                          : Common::AppError::Busy;
+}
+
+std::size_t GaplessPcmSource::Read(float* samples, std::size_t frames) {
+    Preroll();
+
+    std::size_t produced = 0U;
+    while (produced < frames && current_ != nullptr) {
+        const std::size_t read = ReadCurrent(samples + produced * channels_, frames - produced);
+        if (read != 0U) {
+            produced += read;
+            continue;
+        }
+
+        // The current track has ended: splice in the next one right here.
+        Preroll();
+        if (next_ == nullptr) {
+            break;
+        }
+        current_ = next_;
+        next_ = nullptr;
+        headFrames_ = nextFrames_;
+        headPosition_ = 0U;
+        queued_.store(nullptr, std::memory_order_release);
+        transitions_.fetch_add(1U, std::memory_order_release);
+    }
+    return produced;
+}
+
+void GaplessPcmSource::Preroll() {
+    if (next_ != nullptr || headPosition_ != headFrames_) {
+        return;
+    }
+    IPcmSource* const queued = queued_.load(std::memory_order_acquire);
+    if (queued == nullptr) {
+        return;
+    }
+
+    const std::size_t capacity = preroll_.size() / std::max<std::size_t>(channels_, 1U);
+    std::size_t filled = 0U;
+    while (filled < capacity) {
+        const std::size_t read = queued->Read(preroll_.data() + filled * channels_, capacity - filled);
+        if (read == 0U) {
+            break;
+        }
+        filled += read;
+    }
+    next_ = queued;
+    nextFrames_ = filled;
+}
+
+std::size_t GaplessPcmSource::ReadCurrent(float* samples, std::size_t frames) {
+    if (headPosition_ < headFrames_) {
+        const std::size_t count = std::min(frames, headFrames_ - headPosition_);
+        const auto first = preroll_.begin() + static_cast<std::ptrdiff_t>(headPosition_ * channels_);
+        std::copy(first, first + static_cast<std::ptrdiff_t>(count * channels_), samples);
+        headPosition_ += count;
+        return count;
+    }
+    return current_->Read(samples, frames);
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,44 @@
+#include "pcm_sinks.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+Common::AppError NullPcmSink::Write(const float* /*samples*/, std::size_t frames) {
+    framesWritten_.fetch_add(frames, std::memory_order_relaxed);
+    return Common::AppError::Ok;
+}
+
+FilePcmSink::~FilePcmSink() {
+    Close();
+}
+
+Common::AppError FilePcmSink::Open(const char* path) {
+    if (path == nullptr || channels_ == 0U) {
+        return Common::AppError::InvalidArgument;
+    }
+    if (IsOpen()) {
+        return Common::AppError::Busy;
+    }
+    file_ = std::fopen(path, "wb");
+    return IsOpen() ? Common::AppError::Ok : Common::AppError::IoError;
+}
+
+void FilePcmSink::Close() {
+    if (IsOpen()) {
+        (void)std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+Common::AppError FilePcmSink::Write(const float* samples, std::size_t frames) {
+    if (!IsOpen()) {
+        return Common::AppError::NotReady;
+    }
+    const std::size_t count = frames * channels_;
+    if (std::fwrite(samples, sizeof(float), count, file_) != count) {
+        return Common::AppError::IoError;
+    }
+    framesWritten_.fetch_add(frames, std::memory_order_relaxed);
+    return Common::AppError::Ok;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,191 @@
+#include "pcm_stream_engine.hpp"
+
+#include <algorithm>
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+namespace {
+
+PcmStreamEngine::Clock::duration PeriodOf(const PcmEngineConfig& config) {
+    if (config.format.sampleRate == 0U) {
+        return PcmStreamEngine::Clock::duration::zero();
+    }
+    const std::chrono::nanoseconds period(std::uint64_t{config.framesPerPeriod} * 1000000000U /
+                                          config.format.sampleRate);
+    return std::chrono::duration_cast<PcmStreamEngine::Clock::duration>(period);
+}
+
+} // namespace
+
+PcmStreamEngine::PcmStreamEngine(IPcmSource& source, IPcmSink& sink, const PcmEngineConfig& config)
+    : source_(source), sink_(sink), config_(config), period_(PeriodOf(config)),
+      ring_(config.periods, std::size_t{config.framesPerPeriod} * config.format.channels),
+      silence_(ring_.SamplesPerPeriod(), 0.0F) {}
+
+PcmStreamEngine::~PcmStreamEngine() {
+    (void)Stop();
+}
+
+Common::AppError PcmStreamEngine::Start() {
+    const std::lock_guard<std::mutex> control(controlMutex_);
+    const State state = state_.load(std::memory_order_acquire);
+    if (state == State::Playing) {
+        return Common::AppError::Ok;
+    }
+    if (state == State::Paused) {
+        state_.store(State::Playing, std::memory_order_release);
+        return Common::AppError::Ok;
+    }
+
+    if (ring_.SamplesPerPeriod() == 0U || ring_.Periods() < 2U || period_ == Clock::duration::zero()) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    // Neither thread runs yet, so this thread may act as the producer.
+    ring_.Reset();
+    sourceEnded_.store(false, std::memory_order_relaxed);
+    while (DecodePeriod()) {
+    }
+
+    state_.store(State::Playing, std::memory_order_release);
+    decoder_ = std::thread([this] { DecoderLoop(); });
+    sinkThread_ = std::thread([this] { SinkLoop(); });
+    return Common::AppError::Ok;
+}
+
+Common::AppError PcmStreamEngine::Pause() {
+    const std::lock_guard<std::mutex> control(controlMutex_);
+    if (state_.load(std::memory_order_acquire) == State::Stopped) {
+        return Common::AppError::NotReady;
+    }
+    state_.store(State::Paused, std::memory_order_release);
+    return Common::AppError::Ok;
+}
+
+Common::AppError PcmStreamEngine::Stop() {
+    const std::lock_guard<std::mutex> control(controlMutex_);
+    {
+        const std::lock_guard<std::mutex> lock(sleepMutex_);
+        state_.store(State::Stopped, std::memory_order_release);
+    }
+    wake_.notify_all();
+
+    if (decoder_.joinable()) {
+        decoder_.join();
+    }
+    if (sinkThread_.joinable()) {
+        sinkThread_.join();
+    }
+    ring_.Reset();
+    return Common::AppError::Ok;
+}
+
+bool PcmStreamEngine::IsStarted() const {
+    return state_.load(std::memory_order_acquire) != State::Stopped;
+}
+
+bool PcmStreamEngine::IsPaused() const {
+    return state_.load(std::memory_order_acquire) == State::Paused;
+}
+
+bool PcmStreamEngine::EndOfStream() const {
+    return sourceEnded_.load(std::memory_order_acquire) && ring_.Fill() == 0U;
+}
+
+PcmEngineStats PcmStreamEngine::Stats() const {
+    PcmEngineStats stats;
+    stats.periodsPlayed = periodsPlayed_.load(std::memory_order_relaxed);
+    stats.underruns = underruns_.load(std::memory_order_relaxed);
+    stats.overruns = overruns_.load(std::memory_order_relaxed);
+    stats.writeErrors = writeErrors_.load(std::memory_order_relaxed);
+    stats.fillPeriods = ring_.Fill();
+    return stats;
+}
+
+bool PcmStreamEngine::StopRequested() const {
+    return state_.load(std::memory_order_acquire) == State::Stopped;
+}
+
+bool PcmStreamEngine::DecodePeriod() {
+    if (sourceEnded_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    float* const period = ring_.WriteSlot();
+    if (period == nullptr) {
+        return false;
+    }
+
+    const std::size_t channels = config_.format.channels;
+    std::size_t frames = 0U;
+    while (frames < config_.framesPerPeriod) {
+        const std::size_t read = source_.Read(period + frames * channels, config_.framesPerPeriod - frames);
+        if (read == 0U) {
+            break;
+        }
+        frames += std::min<std::size_t>(read, config_.framesPerPeriod - frames);
+    }
+
+    if (frames == 0U) {
+        sourceEnded_.store(true, std::memory_order_release);
+        return false;
+    }
+    if (frames < config_.framesPerPeriod) {
+        std::fill(period + frames * channels, period + ring_.SamplesPerPeriod(), 0.0F);
+    }
+    ring_.CommitWrite();
+    if (frames < config_.framesPerPeriod) {
+        sourceEnded_.store(true, std::memory_order_release);
+        return false;
+    }
+    return true;
+}
+
+void PcmStreamEngine::DecoderLoop() {
+    const Clock::duration idle = period_ / 2;
+    while (!StopRequested()) {
+        while (!StopRequested() && DecodePeriod()) {
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        (void)wake_.wait_for(lock, idle, [this] { return StopRequested(); });
+    }
+}
+
+void PcmStreamEngine::SinkLoop() {
+    Clock::time_point deadline = Clock::now();
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            if (wake_.wait_until(lock, deadline, [this] { return StopRequested(); })) {
+                return;
+            }
+        }
+
+        if (state_.load(std::memory_order_acquire) == State::Playing) {
+            const float* period = ring_.ReadSlot();
+            const bool ended = period == nullptr && sourceEnded_.load(std::memory_order_acquire);
+            if (period == nullptr && !ended) {
+                period = silence_.data();
+                underruns_.fetch_add(1U, std::memory_order_relaxed);
+            }
+            if (period != nullptr) {
+                if (sink_.Write(period, config_.framesPerPeriod) != Common::AppError::Ok) {
+                    writeErrors_.fetch_add(1U, std::memory_order_relaxed);
+                }
+                if (period != silence_.data()) {
+                    ring_.ReleaseRead();
+                    periodsPlayed_.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        deadline += period_;
+        const Clock::time_point now = Clock::now();
+        if (now >= deadline + period_) {
+            const auto missed = (now - deadline) / period_;
+            overruns_.fetch_add(static_cast<std::uint64_t>(missed), std::memory_order_relaxed);
+            deadline += missed * period_;
+        }
+    }
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,57 @@
+#include "resampling_pcm_source.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+Common::AppError ResamplingPcmSource::Begin(IPcmSource& upstream, const PcmFormat& format) {
+    End();
+    const Common::AppError result =
+        resampler_.Configure(Dsp::ResamplerConfig{format.sampleRate, outputRate_, format.channels, quality_});
+    if (result != Common::AppError::Ok) {
+        return result;
+    }
+    input_.assign(kInputFrames * format.channels, 0.0F);
+    upstream_ = &upstream;
+    return Common::AppError::Ok;
+}
+
+void ResamplingPcmSource::End() {
+    upstream_ = nullptr;
+    inputFrames_ = 0U;
+    inputPosition_ = 0U;
+    upstreamEnded_ = false;
+    resampler_.Reset();
+}
+
+std::size_t ResamplingPcmSource::Read(float* samples, std::size_t frames) {
+    if (upstream_ == nullptr) {
+        return 0U;
+    }
+
+    const std::uint16_t channels = resampler_.Config().channels;
+    std::size_t produced = 0U;
+    while (produced < frames) {
+        float* const output = samples + produced * channels;
+        if (inputPosition_ == inputFrames_ && !upstreamEnded_) {
+            inputFrames_ = upstream_->Read(input_.data(), kInputFrames);
+            inputPosition_ = 0U;
+            upstreamEnded_ = inputFrames_ == 0U;
+        }
+
+        if (upstreamEnded_) {
+            const std::size_t flushed = resampler_.Flush(output, frames - produced);
+            produced += flushed;
+            if (flushed == 0U) {
+                break;
+            }
+            continue;
+        }
+
+        const Dsp::ResamplerResult result = resampler_.Process(input_.data() + inputPosition_ * channels,
+                                                               inputFrames_ - inputPosition_, output, frames - produced);
+        inputPosition_ += result.inputFrames;
+        produced += result.outputFrames;
+    }
+    return produced;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,223 @@
+#include "wav_reader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dsp_kernels.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Audio {
+
+namespace {
+
+constexpr std::uint16_t kFormatPcm = 0x0001U;
+constexpr std::uint16_t kFormatIeeeFloat = 0x0003U;
+constexpr std::uint16_t kFormatExtensible = 0xFFFEU;
+
+// KSDATAFORMAT_SUBTYPE_*: the format tag followed by these 14 bytes.
+constexpr std::uint8_t kSubFormatGuidTail[14] = {0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x80U,
+                                                 0x00U, 0x00U, 0xAAU, 0x00U, 0x38U, 0x9BU, 0x71U};
+
+std::uint16_t Le16(const std::uint8_t* p) {
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8U));
+}
+
+std::uint32_t Le32(const std::uint8_t* p) {
+    return std::uint32_t{p[0]} | (std::uint32_t{p[1]} << 8U) | (std::uint32_t{p[2]} << 16U) |
+           (std::uint32_t{p[3]} << 24U);
+}
+
+bool IsTag(const std::uint8_t* p, const char (&tag)[5]) {
+    return std::memcmp(p, tag, 4U) == 0;
+}
+
+Common::AppError ParseFmt(const std::uint8_t* body, std::uint32_t size, WavInfo& info) {
+    if (size < 16U) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    std::uint16_t tag = Le16(body);
+    const std::uint16_t channels = Le16(body + 2);
+    const std::uint32_t sampleRate = Le32(body + 4);
+    const std::uint16_t blockAlign = Le16(body + 12);
+    const std::uint16_t bits = Le16(body + 14);
+
+    if (tag == kFormatExtensible) {
+        if (size < 40U || Le16(body + 16) < 22U || Le16(body + 18) > bits ||
+            std::memcmp(body + 26, kSubFormatGuidTail, sizeof(kSubFormatGuidTail)) != 0) {
+            return Common::AppError::InvalidArgument;
+        }
+        tag = Le16(body + 24);
+    }
+
+    if (channels == 0U || sampleRate == 0U || bits == 0U || (bits % 8U) != 0U ||
+        blockAlign != std::uint32_t{channels} * (bits / 8U)) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    if (tag == kFormatPcm && bits == 16U) {
+        info.sampleFormat = WavSampleFormat::Pcm16;
+    } else if (tag == kFormatPcm && bits == 24U) {
+        info.sampleFormat = WavSampleFormat::Pcm24;
+    } else if (tag == kFormatPcm && bits == 32U) {
+        info.sampleFormat = WavSampleFormat::Pcm32;
+    } else if (tag == kFormatIeeeFloat && bits == 32U) {
+        info.sampleFormat = WavSampleFormat::Float32;
+    } else {
+        return Common::AppError::Unsupported;
+    }
+
+    info.format.sampleRate = sampleRate;
+    info.format.channels = channels;
+    info.bytesPerFrame = blockAlign;
+    return Common::AppError::Ok;
+}
+
+/**
+ * @brief Integer samples scale to [-1, 1); 24-bit ones are shifted into
+ *        the top of a 32-bit word first so both share one factor
+ */
+void ToFloat(const std::uint8_t* in, WavSampleFormat format, std::size_t samples, float* out) {
+    constexpr float kScale16 = 1.0F / 32768.0F;
+    constexpr float kScale32 = 1.0F / 2147483648.0F;
+    const Dsp::DspKernels& kernels = Dsp::Kernels();
+
+    switch (format) {
+    case WavSampleFormat::Pcm16:
+        // The data chunk of any sane file starts at an even offset.
+        if (reinterpret_cast<std::uintptr_t>(in) % alignof(std::int16_t) == 0U) {
+            kernels.int16ToFloat(reinterpret_cast<const std::int16_t*>(in), out, samples);
+            break;
+        }
+        for (std::size_t i = 0U; i < samples; ++i, in += 2) {
+            out[i] = static_cast<float>(static_cast<std::int16_t>(Le16(in))) * kScale16;
+        }
+        break;
+    case WavSampleFormat::Pcm24:
+        kernels.int24ToFloat(in, out, samples);
+        break;
+    case WavSampleFormat::Pcm32:
+        for (std::size_t i = 0U; i < samples; ++i, in += 4) {
+            out[i] = static_cast<float>(static_cast<std::int32_t>(Le32(in))) * kScale32;
+        }
+        break;
+    case WavSampleFormat::Float32:
+        std::memcpy(out, in, samples * sizeof(float));
+        break;
+    }
+}
+
+} // namespace
+
+Common::AppError ParseWavHeader(const std::uint8_t* data, std::size_t size, WavInfo& info) {
+    if (data == nullptr || size < 12U || !IsTag(data, "RIFF") || !IsTag(data + 8, "WAVE")) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    WavInfo parsed;
+    bool haveFmt = false;
+    std::size_t offset = 12U;
+    while (size - offset >= 8U) {
+        const std::uint8_t* header = data + offset;
+        const std::uint32_t chunkSize = Le32(header + 4);
+        const std::size_t body = offset + 8U;
+        const std::size_t available = size - body;
+
+        if (IsTag(header, "fmt ")) {
+            if (chunkSize > available) {
+                return Common::AppError::InvalidArgument;
+            }
+            const Common::AppError result = ParseFmt(data + body, chunkSize, parsed);
+            if (result != Common::AppError::Ok) {
+                return result;
+            }
+            haveFmt = true;
+        } else if (IsTag(header, "data")) {
+            if (!haveFmt) {
+                return Common::AppError::InvalidArgument;
+            }
+            parsed.dataOffset = body;
+            parsed.frames = std::min<std::size_t>(chunkSize, available) / parsed.bytesPerFrame;
+            info = parsed;
+            return Common::AppError::Ok;
+        }
+
+        const std::size_t padded = std::size_t{chunkSize} + (chunkSize & 1U);
+        if (padded > available) {
+            break;
+        }
+        offset = body + padded;
+    }
+    return Common::AppError::InvalidArgument;
+}
+
+Common::AppError WavReader::Open(const char* path) {
+    if (IsOpen()) {
+        return Common::AppError::Busy;
+    }
+    Common::AppError result = file_.Open(path);
+    if (result != Common::AppError::Ok) {
+        return result;
+    }
+    result = ParseWavHeader(file_.Data(), file_.Size(), info_);
+    if (result != Common::AppError::Ok) {
+        Close();
+        return result;
+    }
+
+    position_ = 0U;
+    file_.Advise(Cdd::MappedFile::Access::Sequential);
+    prefetchedTo_ = info_.dataOffset;
+    ReadAhead(info_.dataOffset);
+    return Common::AppError::Ok;
+}
+
+void WavReader::Close() {
+    file_.Close();
+    info_ = WavInfo{};
+    position_ = 0U;
+    prefetchedTo_ = 0U;
+}
+
+PcmBlock WavReader::NextBlock(std::size_t maxFrames) {
+    PcmBlock block;
+    if (!IsOpen() || position_ >= info_.frames) {
+        return block;
+    }
+
+    block.frames = std::min(maxFrames, info_.frames - position_);
+    const std::size_t begin = info_.dataOffset + position_ * info_.bytesPerFrame;
+    block.data = file_.Data() + begin;
+    position_ += block.frames;
+    ReadAhead(begin + block.frames * info_.bytesPerFrame);
+    return block;
+}
+
+Common::AppError WavReader::Seek(std::size_t frame) {
+    if (!IsOpen() || frame > info_.frames) {
+        return Common::AppError::InvalidArgument;
+    }
+    position_ = frame;
+    prefetchedTo_ = info_.dataOffset + frame * info_.bytesPerFrame;
+    ReadAhead(prefetchedTo_);
+    return Common::AppError::Ok;
+}
+
+std::size_t WavReader::Read(float* samples, std::size_t frames) {
+    const PcmBlock block = NextBlock(frames);
+    if (block.frames == 0U) {
+        // At the end (or closed) block.data is null, which ToFloat must not see.
+        return 0U;
+    }
+    ToFloat(block.data, info_.sampleFormat, block.frames * info_.format.channels, samples);
+    return block.frames;
+}
+
+void WavReader::ReadAhead(std::size_t upTo) {
+    // Keep at least half a window requested beyond what was handed out.
+    while (prefetchedTo_ < file_.Size() && upTo + kReadAheadBytes / 2U >= prefetchedTo_) {
+        file_.WillNeed(prefetchedTo_, kReadAheadBytes);
+        prefetchedTo_ += kReadAheadBytes;
+    }
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Audio
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app_error_codes.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Cdd {
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * Pages are read in by the kernel on first touch; the advice calls only
+ * steer its read-ahead. Unsupported outside Linux.
+ */
+class MappedFile {
+public:
+    enum class Access : std::uint8_t {
+        Normal,
+        Sequential, ///< Read ahead aggressively, drop pages behind
+        Random,
+    };
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /**
+     * @return NotFound if @p path does not exist, Busy if a file is already
+     *         mapped; an empty file maps to Size() == 0 and Data() == nullptr
+     */
+    Common::AppError Open(const char* path);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return open_;
+    }
+
+    [[nodiscard]] const std::uint8_t* Data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Access pattern hint for the whole mapping
+     */
+    void Advise(Access access);
+
+    /**
+     * @brief Start reading [@p offset, @p offset + @p length) in the
+     *        background; clamped to the file
+     */
+    void WillNeed(std::size_t offset, std::size_t length);
+
+    /**
+     * @brief Advice syscalls issued since Open()
+     */
+    [[nodiscard]] std::uint64_t AdviceCalls() const noexcept {
+        return adviceCalls_;
+    }
+
+private:
+    std::uint8_t* data_{nullptr};
+    std::size_t size_{0U};
+    bool open_{false};
+    std::uint64_t adviceCalls_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Cdd
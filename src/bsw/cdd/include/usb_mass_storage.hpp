@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>
+#include <string_view>
 #include <vector>
 
 #include "app_error_codes.hpp"
@@ -10,7 +10,11 @@ namespace AutosarMusicPlayer::Bsw::Cdd {
 class UsbMassStorage {
 public:
     struct FileEntry {
-        std::string name;
+        // Owned by the driver. Callers copy the name (UsbSource does, into
+        // its TrackList) and must not keep the view past the next
+        // ListMusicFiles() or Unmount(). The stub hands out string literals,
+        // which happen to outlive both.
+        std::string_view name;
     };
 
     // In a real ECU this would talk to USB MSC driver.
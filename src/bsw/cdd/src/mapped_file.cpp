@@ -0,0 +1,103 @@
+#include "mapped_file.hpp"
+
+#include <cerrno>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AutosarMusicPlayer::Bsw::Cdd {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+#if defined(__linux__)
+
+Common::AppError MappedFile::Open(const char* path) {
+    if (path == nullptr) {
+        return Common::AppError::InvalidArgument;
+    }
+    if (IsOpen()) {
+        return Common::AppError::Busy;
+    }
+
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return errno == ENOENT ? Common::AppError::NotFound : Common::AppError::IoError;
+    }
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        (void)close(fd);
+        return Common::AppError::IoError;
+    }
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    if (size != 0U) {
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            (void)close(fd);
+            return Common::AppError::IoError;
+        }
+        data_ = static_cast<std::uint8_t*>(mapping);
+    }
+    // The mapping keeps the file referenced.
+    (void)close(fd);
+
+    size_ = size;
+    open_ = true;
+    adviceCalls_ = 0U;
+    return Common::AppError::Ok;
+}
+
+void MappedFile::Close() {
+    if (data_ != nullptr) {
+        (void)munmap(data_, size_);
+    }
+    data_ = nullptr;
+    size_ = 0U;
+    open_ = false;
+}
+
+void MappedFile::Advise(Access access) {
+    if (data_ == nullptr) {
+        return;
+    }
+    const int advice = access == Access::Sequential ? MADV_SEQUENTIAL
+                       : access == Access::Random   ? MADV_RANDOM
+                                                    : MADV_NORMAL;
+    (void)madvise(data_, size_, advice);
+    ++adviceCalls_;
+}
+
+void MappedFile::WillNeed(std::size_t offset, std::size_t length) {
+    if (data_ == nullptr || offset >= size_) {
+        return;
+    }
+    // madvise wants a page-aligned start; the mapping itself is aligned.
+    const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const std::size_t start = offset - offset % page;
+    const std::size_t end = length > size_ - offset ? size_ : offset + length;
+    (void)madvise(data_ + start, end - start, MADV_WILLNEED);
+    ++adviceCalls_;
+}
+
+#else
+
+Common::AppError MappedFile::Open(const char* /*path*/) {
+    return Common::AppError::Unsupported;
+}
+
+void MappedFile::Close() {}
+
+void MappedFile::Advise(Access /*access*/) {}
+
+void MappedFile::WillNeed(std::size_t /*offset*/, std::size_t /*length*/) {}
+
+#endif
+
+} // namespace AutosarMusicPlayer::Bsw::Cdd
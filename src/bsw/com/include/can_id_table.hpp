@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "com_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+/**
+ * @brief CAN id to RX PduId lookup, built at compile time
+ *
+ * Open addressing with linear probing over kSlots slots, at most half of
+ * them used, so a lookup is a multiply, a shift and usually one compare;
+ * ids that are not configured (most of the bus) end at the first empty
+ * slot. Build it as a constexpr from the RX PDU table:
+ *
+ *     inline constexpr auto kRxIdTable = CanIdTable::Build(kRxPdus);
+ */
+class CanIdTable {
+public:
+    static constexpr std::size_t kSlots = 32U;
+    static constexpr std::size_t kMaxPdus = kSlots / 2U;
+
+    template <std::size_t N>
+    static constexpr CanIdTable Build(const std::array<RxPduConfig, N>& pdus) noexcept {
+        static_assert(N <= kMaxPdus, "Too many RX PDUs for CanIdTable");
+        CanIdTable table;
+        for (std::size_t i = 0U; i < N; ++i) {
+            table.Insert(pdus[i].canId, static_cast<PduId>(i));
+        }
+        return table;
+    }
+
+    /**
+     * @return Whether @p canId is configured; its PDU in @p pdu
+     */
+    [[nodiscard]] constexpr bool Find(std::uint32_t canId, PduId& pdu) const noexcept {
+        for (std::size_t slot = Slot(canId);; slot = (slot + 1U) & kMask) {
+            if (pdus_[slot] == kEmpty) {
+                return false;
+            }
+            if (ids_[slot] == canId) {
+                pdu = pdus_[slot];
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Configured ids; less than the PDU count if ids repeat
+     */
+    [[nodiscard]] constexpr std::size_t Size() const noexcept {
+        return size_;
+    }
+
+private:
+    static constexpr std::size_t kMask = kSlots - 1U;
+    static constexpr PduId kEmpty = 0xFFFFU;
+
+    static constexpr std::size_t Slot(std::uint32_t canId) noexcept {
+        // Fibonacci hashing: the top 5 bits of id * 2^32 / phi.
+        return static_cast<std::size_t>((canId * 0x9E3779B1U) >> 27U);
+    }
+
+    constexpr CanIdTable() noexcept {
+        for (auto& pdu : pdus_) {
+            pdu = kEmpty;
+        }
+    }
+
+    constexpr void Insert(std::uint32_t canId, PduId pdu) noexcept {
+        std::size_t slot = Slot(canId);
+        while (pdus_[slot] != kEmpty) {
+            if (ids_[slot] == canId) {
+                return;
+            }
+            slot = (slot + 1U) & kMask;
+        }
+        ids_[slot] = canId;
+        pdus_[slot] = pdu;
+        ++size_;
+    }
+
+    std::array<std::uint32_t, kSlots> ids_{};
+    std::array<PduId, kSlots> pdus_{};
+    std::size_t size_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Com
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "app_error_codes.hpp"
+#include "can_if.hpp"
+#include "com_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+/**
+ * @brief Transmission statistics of one PDU since the first main function
+ */
+struct PduStats {
+    std::uint64_t transmitted{0U};
+    std::uint64_t coalesced{0U};      ///< Changes merged into a frame that was already pending
+    std::uint64_t transmitErrors{0U}; ///< Transmit() refusals; the frame is retried
+    std::uint64_t maxLatencyUs{0U};   ///< Triggering change to transmission
+    std::uint64_t totalLatencyUs{0U};
+    std::uint64_t latencySamples{0U};
+};
+
+struct BusLoadReport {
+    std::uint64_t elapsedUs{0U};
+    std::uint64_t frames{0U};
+    std::uint64_t bits{0U}; ///< Worst case, stuff bits included
+    double load{0.0};       ///< bits / (elapsed * bitrate), 0 to 1
+};
+
+/**
+ * @brief Transmit side of an AUTOSAR-style COM layer on top of ICanIf
+ *
+ * Signals are written with SendSignal() into the PDU buffers described by
+ * a static signal table; MainFunctionTx(), called from the 1 ms task,
+ * decides which PDUs go out. A PDU is due when its cycle elapses (Cyclic,
+ * Mixed) or when a triggering signal changed value (OnChange, Mixed), but
+ * never sooner than minDelayUs after its previous transmission: changes
+ * arriving in between only update the buffer, so a burst of state changes
+ * costs one frame carrying the latest values. A cycle that could not be
+ * served is sent once, late, rather than several times.
+ *
+ * SendSignal() may be called from any task; the PDU buffers are guarded
+ * by a mutex that MainFunctionTx() also holds while transmitting.
+ */
+class Com {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    Com(Hal::ICanIf& canIf, const PduConfig* pdus, std::size_t pduCount, const SignalConfig* signals,
+        std::size_t signalCount, std::uint32_t bitrate);
+
+    template <std::size_t P, std::size_t S>
+    Com(Hal::ICanIf& canIf, const std::array<PduConfig, P>& pdus, const std::array<SignalConfig, S>& signals,
+        std::uint32_t bitrate)
+        : Com(canIf, pdus.data(), P, signals.data(), S, bitrate) {}
+
+    /**
+     * @brief Update a signal
+     * @return InvalidArgument for an unknown signal or a value wider than it
+     */
+    Common::AppError SendSignal(SignalId signal, std::uint32_t value) {
+        return SendSignal(signal, value, Clock::now());
+    }
+
+    Common::AppError SendSignal(SignalId signal, std::uint32_t value, Clock::time_point now);
+
+    /**
+     * @brief Transmit the PDUs that are due
+     */
+    void MainFunctionTx() {
+        MainFunctionTx(Clock::now());
+    }
+
+    void MainFunctionTx(Clock::time_point now);
+
+    [[nodiscard]] PduStats Stats(PduId pdu) const;
+
+    [[nodiscard]] BusLoadReport BusLoad() const;
+
+    [[nodiscard]] std::size_t PduCount() const noexcept {
+        return pdus_.size();
+    }
+
+private:
+    struct Pdu {
+        PduConfig config;
+        std::uint8_t data[8]{};
+        bool pending{false};           ///< Triggering change not yet sent
+        Clock::time_point changedAt;   ///< First unsent change
+        Clock::time_point nextCycle;
+        Clock::time_point lastTransmit;
+        bool everTransmitted{false};
+        PduStats stats;
+    };
+
+    [[nodiscard]] bool IsDue(const Pdu& pdu, Clock::time_point now) const noexcept;
+
+    Hal::ICanIf& canIf_;
+    std::vector<Pdu> pdus_;
+    std::vector<SignalConfig> signals_;
+    std::uint32_t bitrate_;
+
+    mutable std::mutex mutex_;
+    bool started_{false};
+    Clock::time_point startedAt_;
+    Clock::time_point lastMainFunction_;
+    std::uint64_t busFrames_{0U};
+    std::uint64_t busBits_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Com
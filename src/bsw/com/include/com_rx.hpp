@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "can_id_table.hpp"
+#include "can_if.hpp"
+#include "com_types.hpp"
+#include "spsc_ring.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+/**
+ * @brief Receiver of decoded RX signals
+ */
+class IComRxListener {
+public:
+    virtual ~IComRxListener() = default;
+
+    /**
+     * @brief A frame carrying @p signal arrived; called for every reception,
+     *        whether or not the value changed
+     */
+    virtual void OnSignalReceived(SignalId signal, std::uint32_t value) = 0;
+};
+
+struct RxStats {
+    std::uint64_t received{0U}; ///< Frames of a configured PDU, decoded
+    std::uint64_t filtered{0U}; ///< Frames with an id nobody listens to
+    std::uint64_t dlcErrors{0U};
+    std::uint64_t overruns{0U}; ///< Frames lost because the ring was full
+};
+
+/**
+ * @brief Receive side of the COM layer
+ *
+ * RxIndication(), called by the CAN driver in interrupt context, only
+ * copies the frame into a lock-free SPSC ring (or counts an overrun when
+ * the ring is full); it never blocks or allocates. MainFunctionRx(), run by
+ * a task, drains the ring: the id is looked up in a compile-time CanIdTable,
+ * frames of unknown ids or too short for their PDU are dropped, and each
+ * signal of the PDU is decoded and handed to the listener on the task's
+ * thread.
+ *
+ * The ring holds kRingLength frames: at 1 Mbit/s that is at least 3 ms of
+ * back-to-back frames (even empty ones take 47 bits), so a 1 ms task keeps
+ * up with a fully loaded bus.
+ */
+class ComRx final : public Hal::ICanRxIndication {
+public:
+    static constexpr std::size_t kRingLength = 64U;
+
+    ComRx(const CanIdTable& ids, const RxPduConfig* pdus, std::size_t pduCount, const SignalConfig* signals,
+          std::size_t signalCount, IComRxListener& listener);
+
+    template <std::size_t P, std::size_t S>
+    ComRx(const CanIdTable& ids, const std::array<RxPduConfig, P>& pdus, const std::array<SignalConfig, S>& signals,
+          IComRxListener& listener)
+        : ComRx(ids, pdus.data(), P, signals.data(), S, listener) {}
+
+    /**
+     * @brief Interrupt context: queue @p frame for MainFunctionRx()
+     */
+    void RxIndication(const Hal::CanFrame& frame) override {
+        if (!ring_.TryPush(frame)) {
+            overruns_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Dispatch every queued frame
+     * @return Frames taken from the ring
+     */
+    std::size_t MainFunctionRx();
+
+    /**
+     * @brief Counters; call from the thread running MainFunctionRx()
+     */
+    [[nodiscard]] RxStats Stats() const noexcept;
+
+private:
+    void Dispatch(const Hal::CanFrame& frame);
+
+    CanIdTable ids_;
+    std::vector<RxPduConfig> pdus_;
+    std::vector<SignalConfig> signals_;
+    std::vector<std::vector<SignalId>> signalsOfPdu_;
+    IComRxListener& listener_;
+
+    Common::SpscRing<Hal::CanFrame, kRingLength> ring_;
+    std::atomic<std::uint64_t> overruns_{0U};
+    RxStats stats_;
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Com
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+using PduId = std::uint16_t;
+using SignalId = std::uint16_t;
+
+enum class TransmitMode : std::uint8_t {
+    Cyclic,   ///< Every cycle, whatever the signals do
+    OnChange, ///< When a triggering signal changes value
+    Mixed     ///< Both
+};
+
+/**
+ * @brief One transmitted PDU of the COM configuration (see generated/com/Com_Cfg.h)
+ */
+struct PduConfig {
+    const char* name;
+    std::uint32_t canId;
+    std::uint8_t dlc;
+    TransmitMode mode;
+    std::uint32_t cycleUs;      ///< Cyclic and Mixed only
+    std::uint32_t minDelayUs;   ///< Minimum time between two transmissions of this PDU
+};
+
+/**
+ * @brief One received PDU of the COM configuration
+ */
+struct RxPduConfig {
+    const char* name;
+    std::uint32_t canId;
+    std::uint8_t dlc; ///< Shorter frames are dropped
+};
+
+/**
+ * @brief One signal, packed little-endian (Intel) into its PDU
+ */
+struct SignalConfig {
+    const char* name;
+    PduId pdu;
+    std::uint8_t startBit;  ///< Least significant bit, 0 = bit 0 of byte 0
+    std::uint8_t bitLength; ///< 1 to 32
+    bool triggersOnChange;  ///< Transmit only: a new value makes an OnChange/Mixed PDU pending
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Com
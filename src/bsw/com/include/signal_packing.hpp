@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "com_types.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+/**
+ * @brief PDU payload as one little-endian 64-bit word
+ */
+[[nodiscard]] inline std::uint64_t LoadPayload(const std::uint8_t (&data)[8]) noexcept {
+    std::uint64_t word = 0U;
+    for (std::size_t i = 8U; i > 0U; --i) {
+        word = (word << 8U) | data[i - 1U];
+    }
+    return word;
+}
+
+inline void StorePayload(std::uint8_t (&data)[8], std::uint64_t word) noexcept {
+    for (auto& byte : data) {
+        byte = static_cast<std::uint8_t>(word & 0xFFU);
+        word >>= 8U;
+    }
+}
+
+[[nodiscard]] constexpr std::uint64_t SignalMask(const SignalConfig& signal) noexcept {
+    return (std::uint64_t{1U} << signal.bitLength) - 1U;
+}
+
+/**
+ * @brief Whether @p signal is 1 to 32 bits wide and lies within @p dlc bytes
+ */
+[[nodiscard]] constexpr bool SignalFits(const SignalConfig& signal, std::uint8_t dlc) noexcept {
+    return signal.bitLength != 0U && signal.bitLength <= 32U && signal.startBit + signal.bitLength <= 8U * dlc;
+}
+
+[[nodiscard]] inline std::uint32_t UnpackSignal(std::uint64_t payload, const SignalConfig& signal) noexcept {
+    return static_cast<std::uint32_t>((payload >> signal.startBit) & SignalMask(signal));
+}
+
+[[nodiscard]] inline std::uint64_t PackSignal(std::uint64_t payload, const SignalConfig& signal,
+                                              std::uint32_t value) noexcept {
+    const std::uint64_t mask = SignalMask(signal);
+    return (payload & ~(mask << signal.startBit)) | ((std::uint64_t{value} & mask) << signal.startBit);
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Com
@@ -0,0 +1,140 @@
+#include "com.hpp"
+
+#include <algorithm>
+
+#include "signal_packing.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+namespace {
+
+std::uint64_t ElapsedUs(Com::Clock::time_point from, Com::Clock::time_point to) {
+    return to > from ? static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count())
+                     : 0U;
+}
+
+} // namespace
+
+Com::Com(Hal::ICanIf& canIf, const PduConfig* pdus, std::size_t pduCount, const SignalConfig* signals,
+         std::size_t signalCount, std::uint32_t bitrate)
+    : canIf_(canIf), signals_(signals, signals + signalCount), bitrate_(bitrate) {
+    pdus_.reserve(pduCount);
+    for (std::size_t i = 0U; i < pduCount; ++i) {
+        Pdu pdu;
+        pdu.config = pdus[i];
+        pdu.config.dlc = std::min<std::uint8_t>(pdu.config.dlc, 8U);
+        pdus_.push_back(pdu);
+    }
+}
+
+Common::AppError Com::SendSignal(SignalId signal, std::uint32_t value, Clock::time_point now) {
+    if (signal >= signals_.size()) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    const SignalConfig& config = signals_[signal];
+    if (config.pdu >= pdus_.size() || config.bitLength == 0U || config.bitLength > 32U ||
+        value > SignalMask(config)) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    const std::lock_guard<std::mutex> lock(mutex_);
+    Pdu& pdu = pdus_[config.pdu];
+    if (!SignalFits(config, pdu.config.dlc)) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    const std::uint64_t payload = LoadPayload(pdu.data);
+    if (UnpackSignal(payload, config) == value) {
+        return Common::AppError::Ok;
+    }
+    StorePayload(pdu.data, PackSignal(payload, config, value));
+
+    if (config.triggersOnChange && pdu.config.mode != TransmitMode::Cyclic) {
+        if (pdu.pending) {
+            ++pdu.stats.coalesced;
+        } else {
+            pdu.pending = true;
+            pdu.changedAt = now;
+        }
+    }
+    return Common::AppError::Ok;
+}
+
+bool Com::IsDue(const Pdu& pdu, Clock::time_point now) const noexcept {
+    if (pdu.everTransmitted && now < pdu.lastTransmit + std::chrono::microseconds(pdu.config.minDelayUs)) {
+        return false;
+    }
+
+    const bool cyclic = pdu.config.mode != TransmitMode::OnChange && pdu.config.cycleUs != 0U;
+    return pdu.pending || (cyclic && now >= pdu.nextCycle);
+}
+
+void Com::MainFunctionTx(Clock::time_point now) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (!started_) {
+        // Cyclic PDUs go out on the first call, then every cycle from there.
+        started_ = true;
+        startedAt_ = now;
+        for (auto& pdu : pdus_) {
+            pdu.nextCycle = now;
+        }
+    }
+    lastMainFunction_ = now;
+
+    for (auto& pdu : pdus_) {
+        if (!IsDue(pdu, now)) {
+            continue;
+        }
+
+        Hal::CanFrame frame;
+        frame.id = pdu.config.canId;
+        frame.dlc = pdu.config.dlc;
+        std::copy(std::begin(pdu.data), std::end(pdu.data), std::begin(frame.data));
+        if (canIf_.Transmit(frame) != Common::AppError::Ok) {
+            ++pdu.stats.transmitErrors;
+            continue;
+        }
+
+        ++pdu.stats.transmitted;
+        ++busFrames_;
+        busBits_ += Hal::CanFrameBits(frame.id, frame.dlc);
+        pdu.lastTransmit = now;
+        pdu.everTransmitted = true;
+
+        if (pdu.pending) {
+            const std::uint64_t latency = ElapsedUs(pdu.changedAt, now);
+            pdu.stats.maxLatencyUs = std::max(pdu.stats.maxLatencyUs, latency);
+            pdu.stats.totalLatencyUs += latency;
+            ++pdu.stats.latencySamples;
+            pdu.pending = false;
+        }
+
+        if (pdu.config.cycleUs != 0U) {
+            const std::chrono::microseconds cycle(pdu.config.cycleUs);
+            while (pdu.nextCycle <= now) {
+                pdu.nextCycle += cycle;
+            }
+        }
+    }
+}
+
+PduStats Com::Stats(PduId pdu) const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return pdu < pdus_.size() ? pdus_[pdu].stats : PduStats{};
+}
+
+BusLoadReport Com::BusLoad() const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    BusLoadReport report;
+    report.elapsedUs = started_ ? ElapsedUs(startedAt_, lastMainFunction_) : 0U;
+    report.frames = busFrames_;
+    report.bits = busBits_;
+    if (report.elapsedUs != 0U && bitrate_ != 0U) {
+        report.load = static_cast<double>(busBits_) * 1e6 /
+                      (static_cast<double>(report.elapsedUs) * static_cast<double>(bitrate_));
+    }
+    return report;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Com
@@ -0,0 +1,53 @@
+#include "com_rx.hpp"
+
+#include "signal_packing.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Com {
+
+ComRx::ComRx(const CanIdTable& ids, const RxPduConfig* pdus, std::size_t pduCount, const SignalConfig* signals,
+             std::size_t signalCount, IComRxListener& listener)
+    : ids_(ids), pdus_(pdus, pdus + pduCount), signals_(signals, signals + signalCount), signalsOfPdu_(pduCount),
+      listener_(listener) {
+    for (std::size_t i = 0U; i < signals_.size(); ++i) {
+        const SignalConfig& signal = signals_[i];
+        if (signal.pdu < pdus_.size() && SignalFits(signal, pdus_[signal.pdu].dlc)) {
+            signalsOfPdu_[signal.pdu].push_back(static_cast<SignalId>(i));
+        }
+    }
+}
+
+std::size_t ComRx::MainFunctionRx() {
+    std::size_t count = 0U;
+    Hal::CanFrame frame;
+    while (ring_.TryPop(frame)) {
+        Dispatch(frame);
+        ++count;
+    }
+    return count;
+}
+
+void ComRx::Dispatch(const Hal::CanFrame& frame) {
+    PduId pdu = 0U;
+    if (!ids_.Find(frame.id, pdu) || pdu >= pdus_.size()) {
+        ++stats_.filtered;
+        return;
+    }
+    if (frame.dlc < pdus_[pdu].dlc) {
+        ++stats_.dlcErrors;
+        return;
+    }
+
+    ++stats_.received;
+    const std::uint64_t payload = LoadPayload(frame.data);
+    for (const SignalId signal : signalsOfPdu_[pdu]) {
+        listener_.OnSignalReceived(signal, UnpackSignal(payload, signals_[signal]));
+    }
+}
+
+RxStats ComRx::Stats() const noexcept {
+    RxStats stats = stats_;
+    stats.overruns = overruns_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Com
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AutosarMusicPlayer::Bsw::Dsp {
+
+/**
+ * @brief Instruction sets a kernel table can be built for, slowest first
+ */
+enum class DspIsa : std::uint8_t {
+    Scalar,
+    Sse2,
+    Avx2,
+};
+
+[[nodiscard]] constexpr const char* ToString(DspIsa isa) noexcept {
+    switch (isa) {
+    case DspIsa::Scalar: return "Scalar";
+    case DspIsa::Sse2: return "SSE2";
+    case DspIsa::Avx2: return "AVX2";
+    default: return "Unknown";
+    }
+}
+
+/**
+ * @brief Sample-format and gain kernels of one instruction set
+ *
+ * Integer samples are host-order (little-endian on every target we ship);
+ * 24-bit ones are packed three bytes per sample, as in WAV files. Float
+ * samples are full scale at +-1. Conversions to integer round to nearest
+ * even and saturate; NaN becomes the most negative value. Pointers need no
+ * particular alignment, and counts of any size are handled.
+ *
+ * Every table computes bit-identical results to the Scalar one, which is
+ * the reference: the vector kernels perform the same float operations in
+ * the same order, and nothing is fused into FMAs.
+ */
+struct DspKernels {
+    DspIsa isa;
+
+    void (*int16ToFloat)(const std::int16_t* in, float* out, std::size_t samples);
+    void (*floatToInt16)(const float* in, std::int16_t* out, std::size_t samples);
+    void (*int24ToFloat)(const std::uint8_t* in, float* out, std::size_t samples);
+    void (*floatToInt24)(const float* in, std::uint8_t* out, std::size_t samples);
+
+    /**
+     * @brief Split interleaved stereo into two planes, and back
+     */
+    void (*deinterleave2)(const float* in, float* left, float* right, std::size_t frames);
+    void (*interleave2)(const float* left, const float* right, float* out, std::size_t frames);
+
+    /**
+     * @brief Multiply interleaved samples by a gain ramping linearly from
+     *        @p startGain (first frame) towards @p endGain (reached by the
+     *        frame after the last), then clip to [-1, 1]
+     *
+     * Ramping over a period instead of jumping avoids zipper noise when the
+     * volume changes; startGain == endGain is a plain gain.
+     */
+    void (*gainRamp)(float* samples, std::size_t frames, std::uint16_t channels, float startGain, float endGain);
+
+    /**
+     * @brief Sum of a[i] * b[i], the inner loop of FIR filters
+     *
+     * Accumulated in sixteen interleaved partial sums, two independent
+     * chains per vector kernel; if at least eight products are left over,
+     * they go to the first eight sums. The sums are then folded to eight
+     * and added pairwise, and the last n % 8 products are added in order.
+     */
+    float (*dot)(const float* a, const float* b, std::size_t n);
+};
+
+/**
+ * @brief Best instruction set of the CPU we are running on, among those
+ *        this build has kernels for
+ */
+[[nodiscard]] DspIsa DetectIsa() noexcept;
+
+/**
+ * @brief Kernels for @p isa, or nullptr if this build or CPU lacks it
+ */
+[[nodiscard]] const DspKernels* KernelsFor(DspIsa isa) noexcept;
+
+/**
+ * @brief Kernels for DetectIsa(), chosen on the first call
+ */
+[[nodiscard]] const DspKernels& Kernels() noexcept;
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp
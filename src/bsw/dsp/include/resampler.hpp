@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "app_error_codes.hpp"
+#include "dsp_kernels.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Dsp {
+
+/**
+ * @brief Filter length against CPU cost; all tiers keep images and aliases
+ *        out of the band below the lower Nyquist frequency
+ *
+ * Low:    24 taps, 70 dB stopband, flat to about 0.64 x the lower Nyquist
+ * Medium: 64 taps, 100 dB stopband, flat to about 0.80 x
+ * High:   160 taps, 120 dB stopband, flat to about 0.90 x (19.9 kHz at 44.1 kHz)
+ *
+ * Tap counts are per output sample and channel when upsampling; when
+ * downsampling they grow by the ratio, so the filter stays as sharp in
+ * terms of the output rate.
+ */
+enum class ResamplerQuality : std::uint8_t {
+    Low,
+    Medium,
+    High,
+};
+
+/**
+ * @brief How a configured Resampler gets its filter coefficients
+ */
+enum class ResamplerMode : std::uint8_t {
+    Passthrough,  ///< Equal rates: samples are copied
+    Polyphase,    ///< One precomputed filter per output phase
+    Interpolated, ///< Arbitrary ratio: coefficients interpolated between a fixed set of phases
+};
+
+struct ResamplerConfig {
+    std::uint32_t inputRate{44100U};
+    std::uint32_t outputRate{48000U};
+    std::uint16_t channels{2U};
+    ResamplerQuality quality{ResamplerQuality::High};
+};
+
+struct ResamplerResult {
+    std::size_t inputFrames{0U};  ///< Consumed
+    std::size_t outputFrames{0U}; ///< Produced
+};
+
+/**
+ * @brief Coefficients of one rate ratio and quality tier, shared between
+ *        resamplers
+ *
+ * Row r holds the taps for an output falling r / phases of the way between
+ * two input samples. Interpolated banks have one extra row, a whole input
+ * sample on, so that every phase has a row after it.
+ */
+struct ResamplerFilterBank {
+    std::size_t taps{0U};
+    std::size_t phases{0U};
+    bool interpolated{false};
+    std::vector<float> coefficients; ///< Row-major, taps per row
+};
+
+/**
+ * @brief Streaming polyphase sample-rate converter for interleaved float PCM
+ *
+ * The rate ratio is reduced to L/M, and output n is sampled at input time
+ * n * M / L. Position is tracked in whole input samples plus a phase
+ * counted in 1/L steps, so no rounding error builds up over time. While L
+ * is at most kMaxPolyphasePhases, which covers 44.1 <-> 48 kHz and every
+ * other ratio between the usual rates, each phase has its own Kaiser-windowed
+ * sinc filter. Larger L switches to interpolated mode: the coefficients are
+ * interpolated linearly between the neighbouring rows of a bank with a
+ * fixed number of phases. Banks are designed once per ratio and tier, then
+ * shared between instances. The inner loop is the dot kernel of the
+ * DspKernels table, so it is vectorized for whatever the CPU supports.
+ *
+ * Process() can be fed blocks of any size; the filter history carries over,
+ * so the output does not depend on how the input was split. Output is
+ * aligned with the input: there is no group delay to compensate, but the
+ * last taps / 2 input frames are only turned into output by Flush() at the
+ * end of the stream. Configure() allocates; Process() and Flush() do not.
+ */
+class Resampler {
+public:
+    /**
+     * @brief Largest L given its own filter per phase
+     */
+    static constexpr std::size_t kMaxPolyphasePhases = 320U;
+
+    static constexpr std::uint32_t kMinRate = 8000U;
+    static constexpr std::uint32_t kMaxRate = 384000U;
+    static constexpr std::uint32_t kMaxDecimation = 8U; ///< Largest input/output rate ratio
+
+    /**
+     * @return InvalidArgument for rates outside [kMinRate, kMaxRate], more
+     *         than kMaxDecimation apart when downsampling, or no channels;
+     *         the resampler is then unconfigured
+     */
+    Common::AppError Configure(const ResamplerConfig& config, const DspKernels& kernels = Kernels());
+
+    /**
+     * @brief Back to the state right after Configure(): history cleared,
+     *        phase zero
+     */
+    void Reset();
+
+    /**
+     * @brief Convert up to @p inputFrames frames into up to @p outputFrames
+     *        frames
+     *
+     * Stops when the input is used up or the output is full, whichever is
+     * first; call again with the rest. Does nothing while unconfigured.
+     */
+    ResamplerResult Process(const float* input, std::size_t inputFrames, float* output, std::size_t outputFrames);
+
+    /**
+     * @brief After the last Process(): the output still owed for the input
+     *        consumed so far, up to @p outputFrames frames
+     * @return Frames written; 0 once everything is out
+     */
+    std::size_t Flush(float* output, std::size_t outputFrames);
+
+    /**
+     * @brief Exact number of output frames @p inputFrames input frames make,
+     *        Flush() included
+     */
+    [[nodiscard]] std::uint64_t OutputFramesFor(std::uint64_t inputFrames) const noexcept;
+
+    [[nodiscard]] bool IsConfigured() const noexcept {
+        return channels_ != 0U;
+    }
+
+    [[nodiscard]] const ResamplerConfig& Config() const noexcept {
+        return config_;
+    }
+
+    [[nodiscard]] ResamplerMode Mode() const noexcept {
+        return mode_;
+    }
+
+    /**
+     * @brief Filter taps per output sample and channel; 0 in passthrough
+     */
+    [[nodiscard]] std::size_t Taps() const noexcept {
+        return bank_ ? bank_->taps : 0U;
+    }
+
+private:
+    static constexpr std::size_t kBlockFrames = 256U; ///< Input frames appended to the history at a time
+
+    /**
+     * @brief Append up to kBlockFrames frames of @p input, zeros if null,
+     *        to the history
+     */
+    std::size_t Append(const float* input, std::size_t frames);
+    void EmitFrame(float* output);
+    void Advance() noexcept;
+
+    ResamplerConfig config_{};
+    const DspKernels* kernels_{nullptr};
+    std::shared_ptr<const ResamplerFilterBank> bank_;
+    ResamplerMode mode_{ResamplerMode::Passthrough};
+    std::uint16_t channels_{0U};
+    std::uint64_t upFactor_{1U};   ///< L
+    std::uint64_t downFactor_{1U}; ///< M
+
+    std::vector<float> history_; ///< Planar, capacity_ frames per channel
+    std::size_t capacity_{0U};
+    std::size_t fill_{0U}; ///< Frames in the history, leading zeros included
+    std::size_t base_{0U}; ///< First history frame under the filter for the next output
+    std::uint64_t phase_{0U};
+    std::uint64_t consumed_{0U};
+    std::uint64_t produced_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp
@@ -0,0 +1,148 @@
+#include "dsp_kernels.hpp"
+
+#include <initializer_list>
+
+#include "dsp_kernels_internal.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Dsp {
+
+namespace Detail {
+
+void Int16ToFloatScalar(const std::int16_t* in, float* out, std::size_t samples) {
+    for (std::size_t i = 0U; i < samples; ++i) {
+        out[i] = static_cast<float>(in[i]) * kScale16;
+    }
+}
+
+void FloatToInt16Scalar(const float* in, std::int16_t* out, std::size_t samples) {
+    for (std::size_t i = 0U; i < samples; ++i) {
+        out[i] = ToInt16(in[i]);
+    }
+}
+
+void Int24ToFloatScalar(const std::uint8_t* in, float* out, std::size_t samples) {
+    for (std::size_t i = 0U; i < samples; ++i, in += 3) {
+        const std::uint32_t word =
+            (std::uint32_t{in[0]} << 8U) | (std::uint32_t{in[1]} << 16U) | (std::uint32_t{in[2]} << 24U);
+        out[i] = static_cast<float>(static_cast<std::int32_t>(word)) * kScale32;
+    }
+}
+
+void FloatToInt24Scalar(const float* in, std::uint8_t* out, std::size_t samples) {
+    for (std::size_t i = 0U; i < samples; ++i, out += 3) {
+        const auto word = static_cast<std::uint32_t>(ToInt24(in[i]));
+        out[0] = static_cast<std::uint8_t>(word);
+        out[1] = static_cast<std::uint8_t>(word >> 8U);
+        out[2] = static_cast<std::uint8_t>(word >> 16U);
+    }
+}
+
+void Deinterleave2Scalar(const float* in, float* left, float* right, std::size_t frames) {
+    for (std::size_t i = 0U; i < frames; ++i) {
+        left[i] = in[2U * i];
+        right[i] = in[2U * i + 1U];
+    }
+}
+
+void Interleave2Scalar(const float* left, const float* right, float* out, std::size_t frames) {
+    for (std::size_t i = 0U; i < frames; ++i) {
+        out[2U * i] = left[i];
+        out[2U * i + 1U] = right[i];
+    }
+}
+
+void GainRampScalar(float* samples, std::size_t firstFrame, std::size_t frames, std::uint16_t channels,
+                    float startGain, float step) {
+    for (std::size_t frame = firstFrame; frame < frames; ++frame) {
+        const float gain = startGain + step * static_cast<float>(frame);
+        float* const sample = samples + frame * channels;
+        for (std::uint16_t ch = 0U; ch < channels; ++ch) {
+            sample[ch] = Clamp(sample[ch] * gain, -1.0F, 1.0F);
+        }
+    }
+}
+
+float DotScalar(const float* a, const float* b, std::size_t n) {
+    float lanes[2U * kDotLanes] = {};
+    std::size_t i = 0U;
+    for (; i + 2U * kDotLanes <= n; i += 2U * kDotLanes) {
+        for (std::size_t lane = 0U; lane < 2U * kDotLanes; ++lane) {
+            lanes[lane] += a[i + lane] * b[i + lane];
+        }
+    }
+    if (i + kDotLanes <= n) {
+        for (std::size_t lane = 0U; lane < kDotLanes; ++lane) {
+            lanes[lane] += a[i + lane] * b[i + lane];
+        }
+        i += kDotLanes;
+    }
+    for (std::size_t lane = 0U; lane < kDotLanes; ++lane) {
+        lanes[lane] += lanes[lane + kDotLanes];
+    }
+    return DotTail(a, b, i, n, ReduceLanes(lanes));
+}
+
+namespace {
+
+void GainRamp(float* samples, std::size_t frames, std::uint16_t channels, float startGain, float endGain) {
+    if (frames == 0U) {
+        return;
+    }
+    GainRampScalar(samples, 0U, frames, channels, startGain, (endGain - startGain) / static_cast<float>(frames));
+}
+
+} // namespace
+
+const DspKernels kScalarKernels{
+    DspIsa::Scalar,     Int16ToFloatScalar, FloatToInt16Scalar, Int24ToFloatScalar,
+    FloatToInt24Scalar, Deinterleave2Scalar, Interleave2Scalar,  GainRamp,           DotScalar,
+};
+
+} // namespace Detail
+
+namespace {
+
+bool CpuSupports(DspIsa isa) noexcept {
+#if MUSIC_PLAYER_DSP_X86
+    switch (isa) {
+    case DspIsa::Scalar: return true;
+    case DspIsa::Sse2: return __builtin_cpu_supports("sse2") != 0;
+    case DspIsa::Avx2: return __builtin_cpu_supports("avx2") != 0;
+    default: return false;
+    }
+#else
+    return isa == DspIsa::Scalar;
+#endif
+}
+
+} // namespace
+
+DspIsa DetectIsa() noexcept {
+    for (const DspIsa isa : {DspIsa::Avx2, DspIsa::Sse2}) {
+        if (KernelsFor(isa) != nullptr) {
+            return isa;
+        }
+    }
+    return DspIsa::Scalar;
+}
+
+const DspKernels* KernelsFor(DspIsa isa) noexcept {
+    if (!CpuSupports(isa)) {
+        return nullptr;
+    }
+    switch (isa) {
+    case DspIsa::Scalar: return &Detail::kScalarKernels;
+#if MUSIC_PLAYER_DSP_X86
+    case DspIsa::Sse2: return &Detail::kSse2Kernels;
+    case DspIsa::Avx2: return &Detail::kAvx2Kernels;
+#endif
+    default: return nullptr;
+    }
+}
+
+const DspKernels& Kernels() noexcept {
+    static const DspKernels* const kernels = KernelsFor(DetectIsa());
+    return *kernels;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp
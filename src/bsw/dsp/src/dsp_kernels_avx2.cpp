@@ -0,0 +1,178 @@
+#include "dsp_kernels_internal.hpp"
+
+#if MUSIC_PLAYER_DSP_X86
+
+#include <immintrin.h>
+
+// Only the functions below are compiled for AVX2, so nothing here can leak
+// into code that runs before the CPU check. They are reached solely through
+// kAvx2Kernels, which KernelsFor() hands out on AVX2 machines only.
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace AutosarMusicPlayer::Bsw::Dsp::Detail {
+
+namespace {
+
+constexpr std::size_t kWidth = 8U;
+
+inline __m256 ClampVec(__m256 x, __m256 lo, __m256 hi) {
+    return _mm256_min_ps(_mm256_max_ps(x, lo), hi);
+}
+
+void Int16ToFloat(const std::int16_t* in, float* out, std::size_t samples) {
+    const __m256 scale = _mm256_set1_ps(kScale16);
+    std::size_t i = 0U;
+    for (; i + kWidth <= samples; i += kWidth) {
+        const __m256i wide = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(wide), scale));
+    }
+    Int16ToFloatScalar(in + i, out + i, samples - i);
+}
+
+void FloatToInt16(const float* in, std::int16_t* out, std::size_t samples) {
+    const __m256 fullScale = _mm256_set1_ps(kFullScale16);
+    const __m256 lo = _mm256_set1_ps(-kFullScale16);
+    const __m256 hi = _mm256_set1_ps(kFullScale16 - 1.0F);
+    std::size_t i = 0U;
+    for (; i + 2U * kWidth <= samples; i += 2U * kWidth) {
+        const __m256i a = _mm256_cvtps_epi32(ClampVec(_mm256_mul_ps(_mm256_loadu_ps(in + i), fullScale), lo, hi));
+        const __m256i b =
+            _mm256_cvtps_epi32(ClampVec(_mm256_mul_ps(_mm256_loadu_ps(in + i + kWidth), fullScale), lo, hi));
+        // packs works per 128-bit lane: a0 b0 a1 b1 -> a0 a1 b0 b1
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+    }
+    FloatToInt16Scalar(in + i, out + i, samples - i);
+}
+
+void Int24ToFloat(const std::uint8_t* in, float* out, std::size_t samples) {
+    // Eight samples are 24 bytes; the 32-byte load reads 8 bytes beyond,
+    // so the loop stops while those still belong to the input.
+    const __m256i spread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i toTop = _mm256_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, //
+                                           -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    const __m256 scale = _mm256_set1_ps(kScale32);
+    std::size_t i = 0U;
+    for (; 3U * i + 32U <= 3U * samples; i += kWidth) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 3U * i));
+        // Lane 0 gets bytes 0..11, lane 1 bytes 12..23; each sample then
+        // moves into the top three bytes of its int32.
+        const __m256i words = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(bytes, spread), toTop);
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(words), scale));
+    }
+    Int24ToFloatScalar(in + 3U * i, out + i, samples - i);
+}
+
+void FloatToInt24(const float* in, std::uint8_t* out, std::size_t samples) {
+    const __m256 fullScale = _mm256_set1_ps(kFullScale24);
+    const __m256 lo = _mm256_set1_ps(-kFullScale24);
+    const __m256 hi = _mm256_set1_ps(kFullScale24 - 1.0F);
+    const __m256i pack = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, //
+                                          0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    const __m256i gather = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    std::size_t i = 0U;
+    for (; i + kWidth <= samples; i += kWidth) {
+        const __m256i words =
+            _mm256_cvtps_epi32(ClampVec(_mm256_mul_ps(_mm256_loadu_ps(in + i), fullScale), lo, hi));
+        // 12 bytes per lane, then the two runs made contiguous: 24 bytes.
+        const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(words, pack), gather);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 3U * i), _mm256_castsi256_si128(packed));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 3U * i + 16U), _mm256_extracti128_si256(packed, 1));
+    }
+    FloatToInt24Scalar(in + i, out + 3U * i, samples - i);
+}
+
+inline __m256 PairsInOrder(__m256 x) {
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(x), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+void Deinterleave2(const float* in, float* left, float* right, std::size_t frames) {
+    std::size_t i = 0U;
+    for (; i + kWidth <= frames; i += kWidth) {
+        const __m256 a = _mm256_loadu_ps(in + 2U * i);
+        const __m256 b = _mm256_loadu_ps(in + 2U * i + kWidth);
+        // Per lane: L0 L1 L4 L5 | L2 L3 L6 L7, then the 64-bit pairs put in order.
+        const __m256 l = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 r = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm256_storeu_ps(left + i, PairsInOrder(l));
+        _mm256_storeu_ps(right + i, PairsInOrder(r));
+    }
+    Deinterleave2Scalar(in + 2U * i, left + i, right + i, frames - i);
+}
+
+void Interleave2(const float* left, const float* right, float* out, std::size_t frames) {
+    std::size_t i = 0U;
+    for (; i + kWidth <= frames; i += kWidth) {
+        const __m256 l = _mm256_loadu_ps(left + i);
+        const __m256 r = _mm256_loadu_ps(right + i);
+        const __m256 low = _mm256_unpacklo_ps(l, r);  // L0 R0 L1 R1 | L4 R4 L5 R5
+        const __m256 high = _mm256_unpackhi_ps(l, r); // L2 R2 L3 R3 | L6 R6 L7 R7
+        _mm256_storeu_ps(out + 2U * i, _mm256_permute2f128_ps(low, high, 0x20));
+        _mm256_storeu_ps(out + 2U * i + kWidth, _mm256_permute2f128_ps(low, high, 0x31));
+    }
+    Interleave2Scalar(left + i, right + i, out + 2U * i, frames - i);
+}
+
+void GainRamp(float* samples, std::size_t frames, std::uint16_t channels, float startGain, float endGain) {
+    if (frames == 0U || channels == 0U) {
+        return;
+    }
+    const float step = (endGain - startGain) / static_cast<float>(frames);
+    if ((channels & (channels - 1U)) != 0U || frames > 0x7FFFFFFFU) {
+        GainRampScalar(samples, 0U, frames, channels, startGain, step);
+        return;
+    }
+
+    const std::size_t total = frames * channels;
+    const auto shift = static_cast<unsigned>(__builtin_ctz(channels)); // i / channels
+    const __m256i laneFrame = _mm256_setr_epi32(0, 1 / channels, 2 / channels, 3 / channels, 4 / channels,
+                                                5 / channels, 6 / channels, 7 / channels);
+    const __m256 start = _mm256_set1_ps(startGain);
+    const __m256 stepVec = _mm256_set1_ps(step);
+    const __m256 lo = _mm256_set1_ps(-1.0F);
+    const __m256 hi = _mm256_set1_ps(1.0F);
+    std::size_t i = 0U;
+    for (; i + kWidth <= total; i += kWidth) {
+        const __m256i frame = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i >> shift)), laneFrame);
+        const __m256 gain = _mm256_add_ps(start, _mm256_mul_ps(stepVec, _mm256_cvtepi32_ps(frame)));
+        _mm256_storeu_ps(samples + i, ClampVec(_mm256_mul_ps(_mm256_loadu_ps(samples + i), gain), lo, hi));
+    }
+    GainRampScalar(samples, i / channels, frames, channels, startGain, step);
+}
+
+inline __m256 Product(const float* a, const float* b, std::size_t i) {
+    return _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+}
+
+float Dot(const float* a, const float* b, std::size_t n) {
+    // Two chains, so the adds do not wait on each other's latency
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    std::size_t i = 0U;
+    for (; i + 2U * kWidth <= n; i += 2U * kWidth) {
+        sum0 = _mm256_add_ps(sum0, Product(a, b, i));
+        sum1 = _mm256_add_ps(sum1, Product(a, b, i + kWidth));
+    }
+    if (i + kWidth <= n) {
+        sum0 = _mm256_add_ps(sum0, Product(a, b, i));
+        i += kWidth;
+    }
+    float lanes[kDotLanes];
+    _mm256_storeu_ps(lanes, _mm256_add_ps(sum0, sum1));
+    return DotTail(a, b, i, n, ReduceLanes(lanes));
+}
+
+} // namespace
+
+const DspKernels kAvx2Kernels{
+    DspIsa::Avx2, Int16ToFloat,  FloatToInt16, Int24ToFloat,
+    FloatToInt24, Deinterleave2, Interleave2,  GainRamp,
+    Dot,
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp::Detail
+
+#pragma GCC pop_options
+
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "dsp_kernels.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define MUSIC_PLAYER_DSP_X86 1
+#else
+#define MUSIC_PLAYER_DSP_X86 0
+#endif
+
+// Shared by the per-ISA translation units: the scalar kernels double as the
+// tail loops of the vector ones, and the per-sample helpers pin down the
+// exact operation order every vector kernel reproduces.
+namespace AutosarMusicPlayer::Bsw::Dsp::Detail {
+
+inline constexpr float kScale16 = 1.0F / 32768.0F;
+inline constexpr float kScale32 = 1.0F / 2147483648.0F; ///< 24-bit samples are left-justified first
+inline constexpr float kFullScale16 = 32768.0F;
+inline constexpr float kFullScale24 = 8388608.0F;
+
+/**
+ * @brief max(x, lo) then min(x, hi), NaN-propagating like MAXPS/MINPS:
+ *        the second operand wins unless the comparison holds
+ */
+inline float Clamp(float x, float lo, float hi) noexcept {
+    x = x > lo ? x : lo;
+    return x < hi ? x : hi;
+}
+
+inline std::int16_t ToInt16(float sample) noexcept {
+    return static_cast<std::int16_t>(std::lrint(Clamp(sample * kFullScale16, -kFullScale16, kFullScale16 - 1.0F)));
+}
+
+inline std::int32_t ToInt24(float sample) noexcept {
+    return static_cast<std::int32_t>(std::lrint(Clamp(sample * kFullScale24, -kFullScale24, kFullScale24 - 1.0F)));
+}
+
+void Int16ToFloatScalar(const std::int16_t* in, float* out, std::size_t samples);
+void FloatToInt16Scalar(const float* in, std::int16_t* out, std::size_t samples);
+void Int24ToFloatScalar(const std::uint8_t* in, float* out, std::size_t samples);
+void FloatToInt24Scalar(const float* in, std::uint8_t* out, std::size_t samples);
+void Deinterleave2Scalar(const float* in, float* left, float* right, std::size_t frames);
+void Interleave2Scalar(const float* left, const float* right, float* out, std::size_t frames);
+
+/**
+ * @brief Partial sums a dot-product kernel keeps per register; the scalar
+ *        kernel keeps the same lanes
+ */
+inline constexpr std::size_t kDotLanes = 8U;
+
+/**
+ * @brief Eight partial sums of a dot product added pairwise, as the vector
+ *        kernels reduce their registers
+ */
+inline float ReduceLanes(const float* lanes) noexcept {
+    return ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) + ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+}
+
+/**
+ * @brief Dot product from element @p first on, given the reduced sum of
+ *        the elements before it
+ */
+inline float DotTail(const float* a, const float* b, std::size_t first, std::size_t n, float sum) noexcept {
+    for (std::size_t i = first; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+float DotScalar(const float* a, const float* b, std::size_t n);
+
+/**
+ * @brief Gain ramp from frame @p firstFrame on; @p step is the per-frame
+ *        increment of the whole ramp
+ */
+void GainRampScalar(float* samples, std::size_t firstFrame, std::size_t frames, std::uint16_t channels,
+                    float startGain, float step);
+
+extern const DspKernels kScalarKernels;
+#if MUSIC_PLAYER_DSP_X86
+extern const DspKernels kSse2Kernels;
+extern const DspKernels kAvx2Kernels;
+#endif
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp::Detail
@@ -0,0 +1,136 @@
+#include "dsp_kernels_internal.hpp"
+
+#if MUSIC_PLAYER_DSP_X86
+
+#include <emmintrin.h>
+
+// SSE2 is part of x86-64, so this file needs no target attribute. SSE2 has
+// no byte shuffle, so the packed 24-bit conversions stay scalar here.
+
+namespace AutosarMusicPlayer::Bsw::Dsp::Detail {
+
+namespace {
+
+constexpr std::size_t kWidth = 4U;
+
+void Int16ToFloat(const std::int16_t* in, float* out, std::size_t samples) {
+    const __m128 scale = _mm_set1_ps(kScale16);
+    std::size_t i = 0U;
+    for (; i + 2U * kWidth <= samples; i += 2U * kWidth) {
+        const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        // Duplicate each int16 into both halves of a lane, then shift the
+        // sign back down.
+        const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+        const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+        _mm_storeu_ps(out + i + kWidth, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+    }
+    Int16ToFloatScalar(in + i, out + i, samples - i);
+}
+
+void FloatToInt16(const float* in, std::int16_t* out, std::size_t samples) {
+    const __m128 fullScale = _mm_set1_ps(kFullScale16);
+    const __m128 lo = _mm_set1_ps(-kFullScale16);
+    const __m128 hi = _mm_set1_ps(kFullScale16 - 1.0F);
+    std::size_t i = 0U;
+    for (; i + 2U * kWidth <= samples; i += 2U * kWidth) {
+        const __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i), fullScale), lo), hi);
+        const __m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i + kWidth), fullScale), lo), hi);
+        const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+    }
+    FloatToInt16Scalar(in + i, out + i, samples - i);
+}
+
+void Deinterleave2(const float* in, float* left, float* right, std::size_t frames) {
+    std::size_t i = 0U;
+    for (; i + kWidth <= frames; i += kWidth) {
+        const __m128 a = _mm_loadu_ps(in + 2U * i);
+        const __m128 b = _mm_loadu_ps(in + 2U * i + kWidth);
+        _mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    Deinterleave2Scalar(in + 2U * i, left + i, right + i, frames - i);
+}
+
+void Interleave2(const float* left, const float* right, float* out, std::size_t frames) {
+    std::size_t i = 0U;
+    for (; i + kWidth <= frames; i += kWidth) {
+        const __m128 l = _mm_loadu_ps(left + i);
+        const __m128 r = _mm_loadu_ps(right + i);
+        _mm_storeu_ps(out + 2U * i, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(out + 2U * i + kWidth, _mm_unpackhi_ps(l, r));
+    }
+    Interleave2Scalar(left + i, right + i, out + 2U * i, frames - i);
+}
+
+void GainRamp(float* samples, std::size_t frames, std::uint16_t channels, float startGain, float endGain) {
+    if (frames == 0U || channels == 0U) {
+        return;
+    }
+    const float step = (endGain - startGain) / static_cast<float>(frames);
+    // Frame of each lane relative to the vector's first sample; only
+    // power-of-two channel counts keep that pattern fixed.
+    if ((channels & (channels - 1U)) != 0U || frames > 0x7FFFFFFFU) {
+        GainRampScalar(samples, 0U, frames, channels, startGain, step);
+        return;
+    }
+
+    const std::size_t total = frames * channels;
+    const auto shift = static_cast<unsigned>(__builtin_ctz(channels)); // i / channels
+    const __m128i laneFrame = _mm_set_epi32(3 / channels, 2 / channels, 1 / channels, 0);
+    const __m128 start = _mm_set1_ps(startGain);
+    const __m128 stepVec = _mm_set1_ps(step);
+    const __m128 lo = _mm_set1_ps(-1.0F);
+    const __m128 hi = _mm_set1_ps(1.0F);
+    std::size_t i = 0U;
+    for (; i + kWidth <= total; i += kWidth) {
+        const __m128i frame = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i >> shift)), laneFrame);
+        const __m128 gain = _mm_add_ps(start, _mm_mul_ps(stepVec, _mm_cvtepi32_ps(frame)));
+        const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(samples + i), gain);
+        _mm_storeu_ps(samples + i, _mm_min_ps(_mm_max_ps(scaled, lo), hi));
+    }
+    // i is a multiple of kWidth and so, for a power-of-two channel count,
+    // on a frame boundary.
+    GainRampScalar(samples, i / channels, frames, channels, startGain, step);
+}
+
+inline __m128 Product(const float* a, const float* b, std::size_t i) {
+    return _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+}
+
+float Dot(const float* a, const float* b, std::size_t n) {
+    // Four registers stand in for the sixteen lanes of the reference.
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    __m128 sum2 = _mm_setzero_ps();
+    __m128 sum3 = _mm_setzero_ps();
+    std::size_t i = 0U;
+    for (; i + 2U * kDotLanes <= n; i += 2U * kDotLanes) {
+        sum0 = _mm_add_ps(sum0, Product(a, b, i));
+        sum1 = _mm_add_ps(sum1, Product(a, b, i + kWidth));
+        sum2 = _mm_add_ps(sum2, Product(a, b, i + 2U * kWidth));
+        sum3 = _mm_add_ps(sum3, Product(a, b, i + 3U * kWidth));
+    }
+    if (i + kDotLanes <= n) {
+        sum0 = _mm_add_ps(sum0, Product(a, b, i));
+        sum1 = _mm_add_ps(sum1, Product(a, b, i + kWidth));
+        i += kDotLanes;
+    }
+    float lanes[kDotLanes];
+    _mm_storeu_ps(lanes, _mm_add_ps(sum0, sum2));
+    _mm_storeu_ps(lanes + kWidth, _mm_add_ps(sum1, sum3));
+    return DotTail(a, b, i, n, ReduceLanes(lanes));
+}
+
+} // namespace
+
+const DspKernels kSse2Kernels{
+    DspIsa::Sse2,       Int16ToFloat,  FloatToInt16, Int24ToFloatScalar,
+    FloatToInt24Scalar, Deinterleave2, Interleave2,  GainRamp,
+    Dot,
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp::Detail
+
+#endif
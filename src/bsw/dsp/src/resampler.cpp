@@ -0,0 +1,291 @@
+#include "resampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+
+namespace AutosarMusicPlayer::Bsw::Dsp {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr std::size_t kTapMultiple = 8U; ///< Rows stay a whole number of AVX2 vectors
+
+struct TierSpec {
+    std::size_t taps;
+    double attenuationDb;
+    std::size_t interpolatedPhases;
+};
+
+// Indexed by ResamplerQuality. The error of interpolating linearly between
+// rows falls by 12 dB with every doubling of the phase count; the counts
+// below keep it under each tier's stopband.
+constexpr TierSpec kTiers[] = {
+    {24U, 70.0, 64U},
+    {64U, 100.0, 256U},
+    {160U, 120.0, 512U},
+};
+
+/**
+ * @brief Zeroth-order modified Bessel function of the first kind, from its
+ *        power series
+ */
+double BesselI0(double x) {
+    const double quarterSquare = x * x / 4.0;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; term > sum * 1e-17; ++k) {
+        term *= quarterSquare / (static_cast<double>(k) * static_cast<double>(k));
+        sum += term;
+    }
+    return sum;
+}
+
+double Sinc(double x) {
+    return std::fabs(x) < 1e-12 ? 1.0 : std::sin(kPi * x) / (kPi * x);
+}
+
+/**
+ * @brief Kaiser-windowed sinc lowpass for output phases r / phases
+ *
+ * The stopband starts at the lower of the two Nyquist frequencies and the
+ * Kaiser formulas give the transition band the tier's tap count allows.
+ * Each row is normalized to unity DC gain, so the gain does not wobble
+ * from one phase to the next.
+ */
+ResamplerFilterBank Design(std::uint64_t up, std::uint64_t down, const TierSpec& spec, bool interpolated) {
+    const double stretch = std::max(1.0, static_cast<double>(down) / static_cast<double>(up));
+    const auto minTaps = static_cast<std::size_t>(std::ceil(static_cast<double>(spec.taps) * stretch));
+
+    ResamplerFilterBank bank;
+    bank.taps = (minTaps + kTapMultiple - 1U) / kTapMultiple * kTapMultiple;
+    bank.phases = interpolated ? spec.interpolatedPhases : up;
+    bank.interpolated = interpolated;
+
+    // Transition width in cycles per sample of the lower rate
+    const double transition = (spec.attenuationDb - 8.0) / (2.285 * 2.0 * kPi * static_cast<double>(spec.taps));
+    const double cutoff = (0.5 - transition / 2.0) / stretch; // cycles per input sample
+    const double beta = 0.1102 * (spec.attenuationDb - 8.7);
+    const double windowNorm = 1.0 / BesselI0(beta);
+    const double half = static_cast<double>(bank.taps / 2U);
+
+    const std::size_t rows = bank.phases + (interpolated ? 1U : 0U);
+    bank.coefficients.resize(rows * bank.taps);
+    std::vector<double> row(bank.taps);
+    for (std::size_t r = 0U; r < rows; ++r) {
+        const double frac = static_cast<double>(r) / static_cast<double>(bank.phases);
+        double sum = 0.0;
+        for (std::size_t j = 0U; j < bank.taps; ++j) {
+            // Distance from the output instant back to tap j's input sample
+            const double tau = frac + half - 1.0 - static_cast<double>(j);
+            const double x = tau / half;
+            const double window = std::fabs(x) < 1.0 ? BesselI0(beta * std::sqrt(1.0 - x * x)) * windowNorm : 0.0;
+            row[j] = 2.0 * cutoff * Sinc(2.0 * cutoff * tau) * window;
+            sum += row[j];
+        }
+        float* const out = bank.coefficients.data() + r * bank.taps;
+        for (std::size_t j = 0U; j < bank.taps; ++j) {
+            out[j] = static_cast<float>(row[j] / sum);
+        }
+    }
+    return bank;
+}
+
+/**
+ * @brief The bank for L/M at @p quality, designed on first use
+ *
+ * A player meets only a handful of ratios, so banks stay cached for good;
+ * past kMaxCachedBanks they are designed for each caller instead.
+ */
+std::shared_ptr<const ResamplerFilterBank> BankFor(std::uint64_t up, std::uint64_t down, ResamplerQuality quality) {
+    struct Entry {
+        std::uint64_t up;
+        std::uint64_t down;
+        ResamplerQuality quality;
+        std::shared_ptr<const ResamplerFilterBank> bank;
+    };
+    constexpr std::size_t kMaxCachedBanks = 16U;
+    static std::mutex mutex;
+    static std::vector<Entry> cache;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    for (const Entry& entry : cache) {
+        if (entry.up == up && entry.down == down && entry.quality == quality) {
+            return entry.bank;
+        }
+    }
+
+    const bool interpolated = up > Resampler::kMaxPolyphasePhases;
+    auto bank = std::make_shared<const ResamplerFilterBank>(
+        Design(up, down, kTiers[static_cast<std::size_t>(quality)], interpolated));
+    if (cache.size() < kMaxCachedBanks) {
+        cache.push_back(Entry{up, down, quality, bank});
+    }
+    return bank;
+}
+
+} // namespace
+
+Common::AppError Resampler::Configure(const ResamplerConfig& config, const DspKernels& kernels) {
+    channels_ = 0U;
+    bank_.reset();
+    history_.clear();
+
+    const auto inRange = [](std::uint32_t rate) { return rate >= kMinRate && rate <= kMaxRate; };
+    if (!inRange(config.inputRate) || !inRange(config.outputRate) || config.channels == 0U ||
+        config.quality > ResamplerQuality::High ||
+        config.inputRate > std::uint64_t{config.outputRate} * kMaxDecimation) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    const std::uint32_t divisor = std::gcd(config.inputRate, config.outputRate);
+    config_ = config;
+    kernels_ = &kernels;
+    upFactor_ = config.outputRate / divisor;
+    downFactor_ = config.inputRate / divisor;
+
+    if (upFactor_ == downFactor_) {
+        mode_ = ResamplerMode::Passthrough;
+        capacity_ = 0U;
+    } else {
+        bank_ = BankFor(upFactor_, downFactor_, config.quality);
+        mode_ = bank_->interpolated ? ResamplerMode::Interpolated : ResamplerMode::Polyphase;
+        capacity_ = bank_->taps + kBlockFrames;
+        history_.assign(capacity_ * config.channels, 0.0F);
+    }
+    channels_ = config.channels;
+    Reset();
+    return Common::AppError::Ok;
+}
+
+void Resampler::Reset() {
+    std::fill(history_.begin(), history_.end(), 0.0F);
+    // Zeros before the first sample: output 0 is centred on input 0.
+    fill_ = bank_ ? bank_->taps / 2U - 1U : 0U;
+    base_ = 0U;
+    phase_ = 0U;
+    consumed_ = 0U;
+    produced_ = 0U;
+}
+
+ResamplerResult Resampler::Process(const float* input, std::size_t inputFrames, float* output,
+                                   std::size_t outputFrames) {
+    ResamplerResult result;
+    if (!IsConfigured()) {
+        return result;
+    }
+
+    if (mode_ == ResamplerMode::Passthrough) {
+        const std::size_t frames = std::min(inputFrames, outputFrames);
+        std::memcpy(output, input, frames * channels_ * sizeof(float));
+        consumed_ += frames;
+        produced_ += frames;
+        return ResamplerResult{frames, frames};
+    }
+
+    while (result.outputFrames < outputFrames) {
+        if (base_ + bank_->taps <= fill_) {
+            EmitFrame(output + result.outputFrames * channels_);
+            ++result.outputFrames;
+            continue;
+        }
+        if (result.inputFrames == inputFrames) {
+            break;
+        }
+        result.inputFrames += Append(input + result.inputFrames * channels_, inputFrames - result.inputFrames);
+    }
+    consumed_ += result.inputFrames;
+    return result;
+}
+
+std::size_t Resampler::Flush(float* output, std::size_t outputFrames) {
+    if (!IsConfigured() || mode_ == ResamplerMode::Passthrough) {
+        return 0U;
+    }
+
+    const std::uint64_t owed = OutputFramesFor(consumed_);
+    std::size_t written = 0U;
+    while (written < outputFrames && produced_ < owed) {
+        if (base_ + bank_->taps <= fill_) {
+            EmitFrame(output + written * channels_);
+            ++written;
+        } else {
+            (void)Append(nullptr, kBlockFrames);
+        }
+    }
+    return written;
+}
+
+std::uint64_t Resampler::OutputFramesFor(std::uint64_t inputFrames) const noexcept {
+    // Outputs fall at n * M / L, and every one before the end of the input counts.
+    return (inputFrames * upFactor_ + downFactor_ - 1U) / downFactor_;
+}
+
+std::size_t Resampler::Append(const float* input, std::size_t frames) {
+    if (capacity_ - fill_ < kBlockFrames) {
+        // Drop what the filter has moved past; fewer than taps frames remain.
+        const std::size_t shift = std::min(base_, fill_);
+        for (std::uint16_t ch = 0U; ch < channels_; ++ch) {
+            float* const plane = history_.data() + ch * capacity_;
+            std::memmove(plane, plane + shift, (fill_ - shift) * sizeof(float));
+        }
+        fill_ -= shift;
+        base_ -= shift;
+    }
+
+    const std::size_t count = std::min({frames, kBlockFrames, capacity_ - fill_});
+    float* const first = history_.data() + fill_;
+    if (input == nullptr) {
+        for (std::uint16_t ch = 0U; ch < channels_; ++ch) {
+            std::fill_n(first + ch * capacity_, count, 0.0F);
+        }
+    } else if (channels_ == 2U) {
+        kernels_->deinterleave2(input, first, first + capacity_, count);
+    } else {
+        for (std::size_t i = 0U; i < count; ++i) {
+            for (std::uint16_t ch = 0U; ch < channels_; ++ch) {
+                first[ch * capacity_ + i] = input[i * channels_ + ch];
+            }
+        }
+    }
+    fill_ += count;
+    return count;
+}
+
+void Resampler::EmitFrame(float* output) {
+    const std::size_t taps = bank_->taps;
+    const float* const history = history_.data() + base_;
+
+    if (mode_ == ResamplerMode::Polyphase) {
+        const float* const row = bank_->coefficients.data() + phase_ * taps;
+        for (std::uint16_t ch = 0U; ch < channels_; ++ch) {
+            output[ch] = kernels_->dot(history + ch * capacity_, row, taps);
+        }
+    } else {
+        // Between bank rows r and r + 1, a fraction t of the way
+        const std::uint64_t position = phase_ * bank_->phases;
+        const float* const row = bank_->coefficients.data() + (position / upFactor_) * taps;
+        const auto t = static_cast<float>(static_cast<double>(position % upFactor_) / static_cast<double>(upFactor_));
+        for (std::uint16_t ch = 0U; ch < channels_; ++ch) {
+            const float* const x = history + ch * capacity_;
+            const float a = kernels_->dot(x, row, taps);
+            const float b = kernels_->dot(x, row + taps, taps);
+            output[ch] = a + t * (b - a);
+        }
+    }
+    Advance();
+}
+
+void Resampler::Advance() noexcept {
+    // M / L is at most kMaxDecimation: a few subtractions beat a division.
+    phase_ += downFactor_;
+    while (phase_ >= upFactor_) {
+        phase_ -= upFactor_;
+        ++base_;
+    }
+    ++produced_;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Dsp
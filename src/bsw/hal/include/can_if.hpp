@@ -6,16 +6,47 @@
 
 namespace AutosarMusicPlayer::Bsw::Hal {
 
+/**
+ * @brief Largest 11-bit identifier; anything above is sent as a 29-bit one
+ */
+constexpr std::uint32_t kCanMaxStandardId = 0x7FFU;
+
 struct CanFrame {
     std::uint32_t id{};
     std::uint8_t dlc{};
     std::uint8_t data[8]{};
 };
 
+/**
+ * @brief Worst-case length of a classic CAN data frame on the wire, in bits,
+ *        including stuff bits and interframe space
+ */
+[[nodiscard]] constexpr std::uint32_t CanFrameBits(std::uint32_t id, std::uint8_t dlc) noexcept {
+    const std::uint32_t dataBits = 8U * (dlc > 8U ? 8U : dlc);
+    const std::uint32_t stuffed = (id > kCanMaxStandardId ? 54U : 34U) + dataBits;
+    const std::uint32_t unstuffed = (id > kCanMaxStandardId ? 67U : 47U) + dataBits;
+    return unstuffed + (stuffed - 1U) / 4U;
+}
+
+/**
+ * @brief Receive callback of a CAN driver
+ *
+ * RxIndication() runs in the receive interrupt (or whatever stands in for
+ * it): implementations must not block, allocate or take locks.
+ */
+class ICanRxIndication {
+public:
+    virtual ~ICanRxIndication() = default;
+    virtual void RxIndication(const CanFrame& frame) = 0;
+};
+
 class ICanIf {
 public:
     virtual ~ICanIf() = default;
 
+    /**
+     * @return Busy if no transmit buffer is free; the caller retries later
+     */
     virtual Common::AppError Transmit(const CanFrame& frame) = 0;
 };
 
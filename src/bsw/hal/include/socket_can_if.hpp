@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+
+#include "can_if.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Hal {
+
+/**
+ * @brief ICanIf on a Linux SocketCAN raw socket, e.g. a vcan interface
+ *        for host testing:
+ *
+ *     ip link add dev vcan0 type vcan && ip link set up vcan0
+ *
+ * Other sockets on the same interface see the transmitted frames (kernel
+ * loopback), so a second SocketCanIf can act as the receiving node. The
+ * socket is non-blocking: a full transmit queue is reported as Busy.
+ * Elsewhere than Linux, Open() returns Unsupported.
+ */
+class SocketCanIf final : public ICanIf {
+public:
+    SocketCanIf() = default;
+    ~SocketCanIf() override;
+
+    SocketCanIf(const SocketCanIf&) = delete;
+    SocketCanIf& operator=(const SocketCanIf&) = delete;
+    SocketCanIf(SocketCanIf&&) = delete;
+    SocketCanIf& operator=(SocketCanIf&&) = delete;
+
+    /**
+     * @return NotFound if there is no such interface, IoError if the socket
+     *         cannot be created or bound, Busy if already open
+     */
+    Common::AppError Open(const char* interfaceName);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return fd_ >= 0;
+    }
+
+    Common::AppError Transmit(const CanFrame& frame) override;
+
+    /**
+     * @brief Take one received frame, if any
+     * @return NotReady when nothing is queued
+     */
+    Common::AppError Receive(CanFrame& frame);
+
+    /**
+     * @brief Hand every queued frame to @p indication, standing in for the
+     *        receive interrupt
+     * @return Frames delivered
+     */
+    std::size_t PollRx(ICanRxIndication& indication);
+
+private:
+    int fd_{-1};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Hal
@@ -0,0 +1,121 @@
+#include "socket_can_if.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace AutosarMusicPlayer::Bsw::Hal {
+
+SocketCanIf::~SocketCanIf() {
+    Close();
+}
+
+std::size_t SocketCanIf::PollRx(ICanRxIndication& indication) {
+    std::size_t count = 0U;
+    CanFrame frame;
+    while (Receive(frame) == Common::AppError::Ok) {
+        indication.RxIndication(frame);
+        ++count;
+    }
+    return count;
+}
+
+#if defined(__linux__)
+
+Common::AppError SocketCanIf::Open(const char* interfaceName) {
+    if (interfaceName == nullptr) {
+        return Common::AppError::InvalidArgument;
+    }
+    if (IsOpen()) {
+        return Common::AppError::Busy;
+    }
+
+    const unsigned index = if_nametoindex(interfaceName);
+    if (index == 0U) {
+        return Common::AppError::NotFound;
+    }
+
+    const int fd = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK, CAN_RAW);
+    if (fd < 0) {
+        return Common::AppError::IoError;
+    }
+
+    sockaddr_can address{};
+    address.can_family = AF_CAN;
+    address.can_ifindex = static_cast<int>(index);
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        (void)close(fd);
+        return Common::AppError::IoError;
+    }
+
+    fd_ = fd;
+    return Common::AppError::Ok;
+}
+
+void SocketCanIf::Close() {
+    if (IsOpen()) {
+        (void)close(fd_);
+        fd_ = -1;
+    }
+}
+
+Common::AppError SocketCanIf::Transmit(const CanFrame& frame) {
+    if (!IsOpen()) {
+        return Common::AppError::NotReady;
+    }
+
+    can_frame raw{};
+    raw.can_id = frame.id > kCanMaxStandardId ? ((frame.id & CAN_EFF_MASK) | CAN_EFF_FLAG) : frame.id;
+    raw.can_dlc = std::min<std::uint8_t>(frame.dlc, 8U);
+    std::memcpy(raw.data, frame.data, raw.can_dlc);
+
+    if (write(fd_, &raw, sizeof(raw)) == static_cast<ssize_t>(sizeof(raw))) {
+        return Common::AppError::Ok;
+    }
+    return (errno == EAGAIN || errno == ENOBUFS) ? Common::AppError::Busy : Common::AppError::IoError;
+}
+
+Common::AppError SocketCanIf::Receive(CanFrame& frame) {
+    if (!IsOpen()) {
+        return Common::AppError::NotReady;
+    }
+
+    can_frame raw{};
+    if (read(fd_, &raw, sizeof(raw)) != static_cast<ssize_t>(sizeof(raw))) {
+        return errno == EAGAIN ? Common::AppError::NotReady : Common::AppError::IoError;
+    }
+
+    frame.id = (raw.can_id & CAN_EFF_FLAG) != 0U ? (raw.can_id & CAN_EFF_MASK) : (raw.can_id & CAN_SFF_MASK);
+    frame.dlc = std::min<std::uint8_t>(raw.can_dlc, 8U);
+    std::memcpy(frame.data, raw.data, frame.dlc);
+    return Common::AppError::Ok;
+}
+
+#else
+
+Common::AppError SocketCanIf::Open(const char* /*interfaceName*/) {
+    return Common::AppError::Unsupported;
+}
+
+void SocketCanIf::Close() {}
+
+Common::AppError SocketCanIf::Transmit(const CanFrame& /*frame*/) {
+    return Common::AppError::NotReady;
+}
+
+Common::AppError SocketCanIf::Receive(CanFrame& /*frame*/) {
+    return Common::AppError::NotReady;
+}
+
+#endif
+
+} // namespace AutosarMusicPlayer::Bsw::Hal
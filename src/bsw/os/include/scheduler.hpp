@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "app_error_codes.hpp"
+
+namespace AutosarMusicPlayer::Bsw::Os {
+
+/**
+ * @brief One task of the ECU configuration (see generated/os/Os_Cfg.h)
+ */
+struct TaskConfig {
+    const char* name;
+    std::uint32_t periodUs;   ///< 0 for an event-triggered task
+    std::uint32_t deadlineUs; ///< Relative to release; 0 means the period (none for event tasks)
+    std::uint8_t core;        ///< Worker thread, pinned to this CPU when possible
+};
+
+using TaskId = std::uint16_t;
+
+/**
+ * @brief Timing of one task since Start(); all times in nanoseconds
+ */
+struct TaskStats {
+    std::uint64_t activations{0U};
+    std::uint64_t deadlineMisses{0U}; ///< Late completions plus releases skipped by an overrun
+    std::uint64_t maxJitterNs{0U};    ///< Release (or activation) to start
+    std::uint64_t totalJitterNs{0U};
+    std::uint64_t maxExecutionNs{0U};
+};
+
+/**
+ * @brief OS-like host for the SW-C runnables on plain threads
+ *
+ * Each task runs its runnables in the order they were added, either
+ * periodically or when activated. Tasks mapped to the same core share one
+ * worker thread and run in rate-monotonic order: event tasks first, then
+ * by increasing period. Releases are absolute (start + n * period), so
+ * lateness does not accumulate; a task that overruns whole periods skips
+ * those releases and each one counts as a deadline miss.
+ *
+ * Configure (AddRunnable) before Start(); ActivateTask() and Stats() may be
+ * called from any thread at any time.
+ */
+class Scheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Runnable = std::function<void()>;
+
+    Scheduler(const TaskConfig* tasks, std::size_t count);
+
+    template <std::size_t N>
+    explicit Scheduler(const std::array<TaskConfig, N>& tasks) : Scheduler(tasks.data(), N) {}
+
+    ~Scheduler();
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    Scheduler& operator=(Scheduler&&) = delete;
+
+    /**
+     * @return NotFound if no task has this name
+     */
+    Common::AppError FindTask(std::string_view name, TaskId& id) const;
+
+    /**
+     * @return InvalidArgument for an unknown task or empty runnable, Busy
+     *         while running
+     */
+    Common::AppError AddRunnable(TaskId task, Runnable runnable);
+
+    /**
+     * @brief Request one run of an event-triggered task
+     *
+     * Activations arriving before the task started are merged; jitter is
+     * measured from the latest. Lock-free unless the worker is idle.
+     *
+     * @return InvalidArgument for an unknown or periodic task
+     */
+    Common::AppError ActivateTask(TaskId task);
+
+    /**
+     * @brief Start one worker thread per configured core
+     * @return Busy if already running
+     */
+    Common::AppError Start();
+
+    /**
+     * @brief Stop the workers; a task that is running completes first
+     */
+    void Stop();
+
+    [[nodiscard]] TaskStats Stats(TaskId task) const;
+
+    [[nodiscard]] std::size_t TaskCount() const noexcept {
+        return tasks_.size();
+    }
+
+    /**
+     * @brief Workers whose CPU affinity was set; the rest float
+     */
+    [[nodiscard]] std::size_t PinnedWorkers() const noexcept {
+        return pinnedWorkers_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Task {
+        TaskConfig config;
+        std::vector<Runnable> runnables;
+        Clock::time_point nextRelease; ///< Worker thread only
+        std::atomic<bool> pending{false};
+        std::atomic<std::int64_t> activatedAtNs{0};
+
+        std::atomic<std::uint64_t> activations{0U};
+        std::atomic<std::uint64_t> deadlineMisses{0U};
+        std::atomic<std::uint64_t> maxJitterNs{0U};
+        std::atomic<std::uint64_t> totalJitterNs{0U};
+        std::atomic<std::uint64_t> maxExecutionNs{0U};
+    };
+
+    struct Worker {
+        std::uint8_t core{0U};
+        std::vector<Task*> tasks; ///< Highest priority first
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::atomic<bool> activated{false};
+        std::atomic<bool> sleeping{false};
+    };
+
+    void WorkerLoop(Worker& worker);
+
+    /**
+     * @brief Run @p task's runnables for the release at @p release and
+     *        record its timing
+     * @return Completion time
+     */
+    Clock::time_point RunTask(Task& task, Clock::time_point release);
+
+    std::vector<std::unique_ptr<Task>> tasks_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<std::size_t> pinnedWorkers_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Bsw::Os
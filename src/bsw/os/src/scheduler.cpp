@@ -0,0 +1,240 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace AutosarMusicPlayer::Bsw::Os {
+
+namespace {
+
+std::int64_t ToNs(Scheduler::Clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+std::uint64_t ElapsedNs(Scheduler::Clock::time_point from, Scheduler::Clock::time_point to) {
+    return to > from ? static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count())
+                     : 0U;
+}
+
+void UpdateMax(std::atomic<std::uint64_t>& max, std::uint64_t value) {
+    // Single writer (the task's worker), so no CAS loop is needed.
+    if (value > max.load(std::memory_order_relaxed)) {
+        max.store(value, std::memory_order_relaxed);
+    }
+}
+
+bool PinToCore(std::thread& thread, std::uint8_t core) {
+#if defined(__linux__)
+    const unsigned cpus = std::max(1U, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cpus, &set);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)core;
+    return false;
+#endif
+}
+
+} // namespace
+
+Scheduler::Scheduler(const TaskConfig* tasks, std::size_t count) {
+    tasks_.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        auto task = std::make_unique<Task>();
+        task->config = tasks[i];
+        if (task->config.deadlineUs == 0U) {
+            task->config.deadlineUs = task->config.periodUs;
+        }
+
+        const auto it = std::find_if(workers_.begin(), workers_.end(),
+                                     [&](const auto& worker) { return worker->core == tasks[i].core; });
+        Worker* worker = nullptr;
+        if (it == workers_.end()) {
+            workers_.push_back(std::make_unique<Worker>());
+            worker = workers_.back().get();
+            worker->core = tasks[i].core;
+        } else {
+            worker = it->get();
+        }
+        worker->tasks.push_back(task.get());
+        tasks_.push_back(std::move(task));
+    }
+
+    // Rate-monotonic: event tasks (period 0) first, then shortest period.
+    for (auto& worker : workers_) {
+        std::stable_sort(worker->tasks.begin(), worker->tasks.end(), [](const Task* a, const Task* b) {
+            return a->config.periodUs < b->config.periodUs;
+        });
+    }
+}
+
+Scheduler::~Scheduler() {
+    Stop();
+}
+
+Common::AppError Scheduler::FindTask(std::string_view name, TaskId& id) const {
+    for (std::size_t i = 0U; i < tasks_.size(); ++i) {
+        if (name == tasks_[i]->config.name) {
+            id = static_cast<TaskId>(i);
+            return Common::AppError::Ok;
+        }
+    }
+    return Common::AppError::NotFound;
+}
+
+Common::AppError Scheduler::AddRunnable(TaskId task, Runnable runnable) {
+    if (task >= tasks_.size() || !runnable) {
+        return Common::AppError::InvalidArgument;
+    }
+    if (running_.load()) {
+        return Common::AppError::Busy;
+    }
+
+    tasks_[task]->runnables.push_back(std::move(runnable));
+    return Common::AppError::Ok;
+}
+
+Common::AppError Scheduler::ActivateTask(TaskId task) {
+    if (task >= tasks_.size() || tasks_[task]->config.periodUs != 0U) {
+        return Common::AppError::InvalidArgument;
+    }
+
+    Task& t = *tasks_[task];
+    t.activatedAtNs.store(ToNs(Clock::now()), std::memory_order_relaxed);
+    t.pending.store(true, std::memory_order_release);
+
+    const auto it = std::find_if(workers_.begin(), workers_.end(),
+                                 [&](const auto& worker) { return worker->core == t.config.core; });
+    Worker& worker = **it;
+    worker.activated.store(true, std::memory_order_seq_cst);
+    if (worker.sleeping.load(std::memory_order_seq_cst)) {
+        const std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.wake.notify_one();
+    }
+    return Common::AppError::Ok;
+}
+
+Common::AppError Scheduler::Start() {
+    if (running_.exchange(true)) {
+        return Common::AppError::Busy;
+    }
+
+    const Clock::time_point start = Clock::now();
+    for (auto& task : tasks_) {
+        task->nextRelease = start;
+        task->activations.store(0U, std::memory_order_relaxed);
+        task->deadlineMisses.store(0U, std::memory_order_relaxed);
+        task->maxJitterNs.store(0U, std::memory_order_relaxed);
+        task->totalJitterNs.store(0U, std::memory_order_relaxed);
+        task->maxExecutionNs.store(0U, std::memory_order_relaxed);
+    }
+
+    pinnedWorkers_.store(0U, std::memory_order_relaxed);
+    for (auto& worker : workers_) {
+        Worker& w = *worker;
+        w.thread = std::thread([this, &w]() { WorkerLoop(w); });
+        if (PinToCore(w.thread, w.core)) {
+            pinnedWorkers_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+    return Common::AppError::Ok;
+}
+
+void Scheduler::Stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    for (auto& worker : workers_) {
+        {
+            const std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->wake.notify_one();
+        }
+        worker->thread.join();
+    }
+}
+
+TaskStats Scheduler::Stats(TaskId task) const {
+    TaskStats stats;
+    if (task >= tasks_.size()) {
+        return stats;
+    }
+
+    const Task& t = *tasks_[task];
+    stats.activations = t.activations.load(std::memory_order_relaxed);
+    stats.deadlineMisses = t.deadlineMisses.load(std::memory_order_relaxed);
+    stats.maxJitterNs = t.maxJitterNs.load(std::memory_order_relaxed);
+    stats.totalJitterNs = t.totalJitterNs.load(std::memory_order_relaxed);
+    stats.maxExecutionNs = t.maxExecutionNs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void Scheduler::WorkerLoop(Worker& worker) {
+    while (running_.load()) {
+        // Clear before scanning: an activation from now on either is seen by
+        // the scan or keeps the wait below from sleeping.
+        worker.activated.store(false, std::memory_order_seq_cst);
+
+        Clock::time_point nextWake = Clock::time_point::max();
+        for (Task* task : worker.tasks) {
+            if (task->config.periodUs == 0U) {
+                if (task->pending.exchange(false, std::memory_order_acquire)) {
+                    const Clock::time_point activatedAt{std::chrono::duration_cast<Clock::duration>(
+                        std::chrono::nanoseconds(task->activatedAtNs.load(std::memory_order_relaxed)))};
+                    (void)RunTask(*task, activatedAt);
+                }
+                continue;
+            }
+
+            const std::chrono::microseconds period(task->config.periodUs);
+            if (Clock::now() >= task->nextRelease) {
+                const Clock::time_point finished = RunTask(*task, task->nextRelease);
+                task->nextRelease += period;
+                while (task->nextRelease + period <= finished) {
+                    // Overran a whole period: that release never ran.
+                    task->nextRelease += period;
+                    task->deadlineMisses.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+            nextWake = std::min(nextWake, task->nextRelease);
+        }
+
+        std::unique_lock<std::mutex> lock(worker.mutex);
+        worker.sleeping.store(true, std::memory_order_seq_cst);
+        const auto wakeUp = [&]() { return worker.activated.load(std::memory_order_seq_cst) || !running_.load(); };
+        if (nextWake == Clock::time_point::max()) {
+            worker.wake.wait(lock, wakeUp);
+        } else {
+            (void)worker.wake.wait_until(lock, nextWake, wakeUp);
+        }
+        worker.sleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+Scheduler::Clock::time_point Scheduler::RunTask(Task& task, Clock::time_point release) {
+    const Clock::time_point started = Clock::now();
+    for (auto& runnable : task.runnables) {
+        runnable();
+    }
+    const Clock::time_point finished = Clock::now();
+
+    const std::uint64_t jitter = ElapsedNs(release, started);
+    task.activations.fetch_add(1U, std::memory_order_relaxed);
+    task.totalJitterNs.fetch_add(jitter, std::memory_order_relaxed);
+    UpdateMax(task.maxJitterNs, jitter);
+    UpdateMax(task.maxExecutionNs, ElapsedNs(started, finished));
+
+    if (task.config.deadlineUs != 0U && finished > release + std::chrono::microseconds(task.config.deadlineUs)) {
+        task.deadlineMisses.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return finished;
+}
+
+} // namespace AutosarMusicPlayer::Bsw::Os
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Rte_Type.h"
+#include "app_types.hpp"
+#include "event_bus.hpp"
+#include "template_helpers.hpp"
+
+namespace AutosarMusicPlayer::Common {
+
+// Topics exchanged between the SW-Cs.
+
+struct PlaylistChangedEvent {};
+
+struct SongChangedEvent {
+    SongId id;
+};
+
+struct PlaybackStateChangedEvent {
+    Rte_PlaybackStateType state;
+    Rte_SequenceCounterType sequence;
+};
+
+using AppTopics = TypeList<PlaylistChangedEvent, SongChangedEvent, PlaybackStateChangedEvent>;
+
+constexpr std::size_t kMaxTopicSubscribers = 8U;
+
+using AppEventBus = EventBus<AppTopics, kMaxTopicSubscribers>;
+
+/**
+ * @brief RTE port (like Rte::StaticRtePort) publishing the SW-C
+ *        notifications on an AppEventBus
+ */
+class AppEventBusPort {
+public:
+    explicit AppEventBusPort(const AppEventBus& bus) noexcept : bus_(&bus) {}
+
+    void NotifySongChanged(Rte_SongIdType newSongId) const {
+        bus_->Publish(SongChangedEvent{newSongId});
+    }
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) const {
+        bus_->Publish(PlaybackStateChangedEvent{state, sequence});
+    }
+
+private:
+    const AppEventBus* bus_;
+};
+
+} // namespace AutosarMusicPlayer::Common
@@ -13,6 +13,13 @@ struct SongInfo {
     std::uint32_t durationSeconds{};
 };
 
+// Capacity of the heap-free playlist on the smallest ECU target.
 constexpr std::uint32_t kMaxPlaylistSize = 200U;
 
+// Default upper bound for the growable playlist (large USB libraries).
+constexpr std::uint32_t kMaxLibrarySize = 262144U;
+
+// Title bytes kept per song by fixed-capacity storage.
+constexpr std::uint32_t kMaxTitleLength = 63U;
+
 } // namespace AutosarMusicPlayer::Common
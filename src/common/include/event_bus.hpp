@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "app_error_codes.hpp"
+#include "static_vector.hpp"
+#include "template_helpers.hpp"
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief How an event of type T is handed to subscribers
+ *
+ * Small trivially copyable events go by value (in registers); anything
+ * larger by const reference, so the bus never copies it.
+ */
+template <typename T>
+using EventParam = std::conditional_t<std::is_trivially_copyable_v<T> && sizeof(T) <= 2U * sizeof(void*), T, const T&>;
+
+template <typename TopicList, std::size_t MaxSubscribers>
+class EventBus;
+
+/**
+ * @brief Typed publish/subscribe bus with a compile-time topic list
+ *
+ * Every topic (an event type) has its own inline array of at most
+ * MaxSubscribers subscribers. A subscriber is a context pointer plus a
+ * function pointer, so publishing is a loop of direct calls with no
+ * allocation and no virtual dispatch; member-function handlers are bound
+ * through a generated thunk that the compiler can inline into it.
+ * Publishing or subscribing to a type that is not a topic is a compile
+ * error.
+ *
+ * Not synchronised: subscribe and publish from one thread, or subscribe
+ * everything before publishing starts.
+ *
+ * @tparam Topics Event types; each at most once
+ * @tparam MaxSubscribers Capacity per topic
+ */
+template <typename... Topics, std::size_t MaxSubscribers>
+class EventBus<TypeList<Topics...>, MaxSubscribers> {
+public:
+    template <typename Topic>
+    using Handler = void (*)(void* context, EventParam<Topic> event);
+
+    /**
+     * @brief Subscribe @p handler with @p context to @p Topic
+     * @return InvalidArgument for a null handler, Busy if the topic is full;
+     *         subscribing the same pair twice is a no-op
+     */
+    template <typename Topic>
+    AppError Subscribe(Handler<Topic> handler, void* context) {
+        if (handler == nullptr) {
+            return AppError::InvalidArgument;
+        }
+
+        auto& subscribers = SubscribersOf<Topic>();
+        const Subscriber<Topic> subscriber{context, handler};
+        if (std::find(subscribers.begin(), subscribers.end(), subscriber) != subscribers.end()) {
+            return AppError::Ok;
+        }
+        if (subscribers.full()) {
+            return AppError::Busy;
+        }
+
+        subscribers.push_back(subscriber);
+        return AppError::Ok;
+    }
+
+    /**
+     * @brief Subscribe @p object's @p Method, e.g.
+     *        bus.Subscribe<SongChangedEvent, &Hmi::OnSongChanged>(hmi)
+     */
+    template <typename Topic, auto Method, typename C>
+    AppError Subscribe(C& object) {
+        return Subscribe<Topic>(&MemberThunk<Topic, Method, C>, &object);
+    }
+
+    template <typename Topic>
+    void Unsubscribe(Handler<Topic> handler, void* context) {
+        auto& subscribers = SubscribersOf<Topic>();
+        const Subscriber<Topic> subscriber{context, handler};
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), subscriber), subscribers.end());
+    }
+
+    template <typename Topic, auto Method, typename C>
+    void Unsubscribe(C& object) {
+        Unsubscribe<Topic>(&MemberThunk<Topic, Method, C>, &object);
+    }
+
+    /**
+     * @brief Deliver @p event to the subscribers of its topic in subscription order
+     */
+    template <typename Topic>
+    void Publish(const Topic& event) const {
+        for (const auto& subscriber : SubscribersOf<Topic>()) {
+            subscriber.handler(subscriber.context, event);
+        }
+    }
+
+    template <typename Topic>
+    [[nodiscard]] std::size_t SubscriberCount() const noexcept {
+        return SubscribersOf<Topic>().size();
+    }
+
+private:
+    template <typename Topic>
+    struct Subscriber {
+        void* context{nullptr};
+        Handler<Topic> handler{nullptr};
+
+        bool operator==(const Subscriber& other) const noexcept {
+            return context == other.context && handler == other.handler;
+        }
+    };
+
+    template <typename Topic>
+    using SubscriberList = StaticVector<Subscriber<Topic>, MaxSubscribers>;
+
+    template <typename Topic, auto Method, typename C>
+    static void MemberThunk(void* context, EventParam<Topic> event) {
+        (static_cast<C*>(context)->*Method)(event);
+    }
+
+    template <typename Topic>
+    SubscriberList<Topic>& SubscribersOf() noexcept {
+        static_assert(IsOneOfV<Topic, Topics...>, "Topic is not declared in this bus's TypeList");
+        return std::get<SubscriberList<Topic>>(subscribers_);
+    }
+
+    template <typename Topic>
+    const SubscriberList<Topic>& SubscribersOf() const noexcept {
+        static_assert(IsOneOfV<Topic, Topics...>, "Topic is not declared in this bus's TypeList");
+        return std::get<SubscriberList<Topic>>(subscribers_);
+    }
+
+    std::tuple<SubscriberList<Topics>...> subscribers_;
+};
+
+} // namespace AutosarMusicPlayer::Common
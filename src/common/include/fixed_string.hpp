@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief String with inline, fixed-size storage (no heap)
+ *
+ * Longer input is truncated to N bytes. Truncation never splits a UTF-8
+ * sequence, so the stored text is always valid if the input was.
+ *
+ * Mirrors the small part of the std::string interface used by storage
+ * policies (assign/data/size/clear).
+ *
+ * @tparam N Maximum length in bytes (excluding terminator)
+ */
+template <std::size_t N>
+class FixedString {
+public:
+    FixedString() = default;
+
+    explicit FixedString(std::string_view text) noexcept {
+        assign(text.data(), text.size());
+    }
+
+    void assign(const char* text, std::size_t length) noexcept {
+        length = TruncatedLength(text, length);
+        for (std::size_t i = 0U; i < length; ++i) {
+            chars_[i] = text[i];
+        }
+        chars_[length] = '\0';
+        size_ = length;
+    }
+
+    void clear() noexcept {
+        chars_[0U] = '\0';
+        size_ = 0U;
+    }
+
+    [[nodiscard]] const char* data() const noexcept {
+        return chars_.data();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept {
+        return N;
+    }
+
+    [[nodiscard]] std::string_view View() const noexcept {
+        return std::string_view(chars_.data(), size_);
+    }
+
+    /**
+     * @brief The part of @p text a FixedString<N> would keep
+     */
+    [[nodiscard]] static std::string_view Truncated(std::string_view text) noexcept {
+        return text.substr(0U, TruncatedLength(text.data(), text.size()));
+    }
+
+private:
+    static std::size_t TruncatedLength(const char* text, std::size_t length) noexcept {
+        constexpr unsigned char kContinuationMask = 0xC0U;
+        constexpr unsigned char kContinuationBits = 0x80U;
+
+        if (length <= N) {
+            return length;
+        }
+        std::size_t cut = N;
+        // Back off over UTF-8 continuation bytes so a code point is not split.
+        while (cut > 0U && (static_cast<unsigned char>(text[cut]) & kContinuationMask) == kContinuationBits) {
+            --cut;
+        }
+        return cut;
+    }
+
+    std::array<char, N + 1U> chars_{};
+    std::size_t size_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Common
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Bounded lock-free multi-producer/single-consumer queue
+ *
+ * A ring of Capacity cells, each with a sequence number telling whether it
+ * is free for the producer of a given round or holds a value for the
+ * consumer (D. Vyukov's bounded queue). Producers claim a cell with one CAS
+ * on the tail; the single consumer needs no read-modify-write at all.
+ * Storage is inline, nothing is allocated.
+ *
+ * @tparam T Element type; default-constructible and move-assignable
+ * @tparam Capacity Number of cells, a power of two
+ */
+template <typename T, std::size_t Capacity>
+class MpscQueue {
+    static_assert(Capacity >= 2U && (Capacity & (Capacity - 1U)) == 0U, "Capacity must be a power of two");
+
+public:
+    MpscQueue() noexcept {
+        for (std::size_t i = 0U; i < Capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+    ~MpscQueue() = default;
+
+    /**
+     * @brief Append @p value; false if the queue is full. Any thread.
+     */
+    bool TryPush(T value) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[tail & kMask];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == tail) {
+                if (tail_.compare_exchange_weak(tail, tail + 1U, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(tail + 1U, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < tail) {
+                return false;
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Take the oldest element into @p out; false if empty. Consumer thread only.
+     */
+    bool TryPop(T& out) {
+        Cell& cell = cells_[head_ & kMask];
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1U) {
+            return false;
+        }
+        out = std::move(cell.value);
+        cell.sequence.store(head_ + Capacity, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    static constexpr std::size_t CapacityValue() noexcept {
+        return Capacity;
+    }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1U;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{0U};
+        T value{};
+    };
+
+    std::array<Cell, Capacity> cells_;
+    alignas(64) std::atomic<std::size_t> tail_{0U};
+    alignas(64) std::size_t head_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Common
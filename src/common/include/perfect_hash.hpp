@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "template_helpers.hpp"
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Collision-free hash of a fixed set of strings, built at compile time
+ *
+ * Each key's HashFnv1a is mixed with a seed and reduced to one of kSlots
+ * slots (a power of two, at least twice the key count); the constructor
+ * tries seeds until every key has a slot of its own. A lookup is then one
+ * hash, one table read and one string compare, with no probing. Declare
+ * the table constexpr and assert on IsPerfect(), which is false only if no
+ * seed worked, e.g. because two keys are equal:
+ *
+ *     constexpr PerfectHash<3U> kHash{{"play", "pause", "stop"}};
+ *     static_assert(kHash.IsPerfect(), "keys collide");
+ *
+ * @tparam N Number of keys
+ */
+template <std::size_t N>
+class PerfectHash {
+    static_assert(N > 0U, "PerfectHash needs at least one key");
+
+public:
+    static constexpr std::size_t kNotFound = N;
+
+    constexpr explicit PerfectHash(const std::array<std::string_view, N>& keys) noexcept : keys_(keys) {
+        for (std::size_t seed = 0U; seed < kMaxSeeds; ++seed) {
+            if (TryBuild(seed)) {
+                seed_ = seed;
+                perfect_ = true;
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr bool IsPerfect() const noexcept {
+        return perfect_;
+    }
+
+    /**
+     * @return Index of @p key in the key array, or kNotFound
+     */
+    [[nodiscard]] constexpr std::size_t Find(std::string_view key) const noexcept {
+        const std::size_t index = slots_[Slot(key, seed_)];
+        return index != kNotFound && keys_[index] == key ? index : kNotFound;
+    }
+
+    static constexpr std::size_t SlotCount() noexcept {
+        return kSlots;
+    }
+
+private:
+    static constexpr std::size_t SlotsFor(std::size_t keys) noexcept {
+        std::size_t slots = 2U;
+        while (slots < 2U * keys) {
+            slots *= 2U;
+        }
+        return slots;
+    }
+
+    static constexpr std::size_t kSlots = SlotsFor(N);
+    static constexpr std::size_t kMaxSeeds = 1024U;
+
+    static constexpr std::size_t Slot(std::string_view key, std::size_t seed) noexcept {
+        // Multiplicative mix so every seed reshuffles all the slot bits.
+        const std::size_t mixed = (HashFnv1a(key) ^ seed) * std::size_t{0x9E3779B97F4A7C15ULL};
+        return (mixed >> 32U) & (kSlots - 1U);
+    }
+
+    constexpr bool TryBuild(std::size_t seed) noexcept {
+        for (auto& slot : slots_) {
+            slot = kNotFound;
+        }
+        for (std::size_t i = 0U; i < N; ++i) {
+            std::size_t& slot = slots_[Slot(keys_[i], seed)];
+            if (slot != kNotFound) {
+                return false;
+            }
+            slot = i;
+        }
+        return true;
+    }
+
+    std::array<std::string_view, N> keys_;
+    std::array<std::size_t, kSlots> slots_{};
+    std::size_t seed_{0U};
+    bool perfect_{false};
+};
+
+} // namespace AutosarMusicPlayer::Common
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Last-is-best value shared by one writer with any number of readers
+ *
+ * A sequence counter guards a copy of the value held in atomic words: the
+ * writer makes the counter odd, stores the words and makes it even again,
+ * and a reader retries if the counter was odd or moved while it copied.
+ * Store() is wait-free and constant time; Load() never blocks the writer
+ * and completes on the first attempt unless it overlaps a Store().
+ *
+ * The words are stored with release and loaded with acquire semantics
+ * rather than relying on fences, which keeps the protocol visible to the
+ * thread sanitizer.
+ *
+ * @tparam T Trivially copyable value type
+ */
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "Seqlock values are copied bytewise");
+
+public:
+    Seqlock() noexcept = default;
+
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+    Seqlock(Seqlock&&) = delete;
+    Seqlock& operator=(Seqlock&&) = delete;
+    ~Seqlock() = default;
+
+    /**
+     * @brief Publish @p value. Writer thread only.
+     */
+    void Store(const T& value) noexcept {
+        std::array<std::uint64_t, kWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1U, std::memory_order_relaxed);
+        for (std::size_t i = 0U; i < kWords; ++i) {
+            words_[i].store(words[i], std::memory_order_release);
+        }
+        sequence_.store(sequence + 2U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy the latest value into @p out. Any thread.
+     * @return False, leaving @p out untouched, if nothing was stored yet
+     */
+    bool Load(T& out) const noexcept {
+        std::array<std::uint64_t, kWords> words{};
+        for (;;) {
+            const std::uint64_t before = sequence_.load(std::memory_order_acquire);
+            if ((before & 1U) != 0U) {
+                continue;
+            }
+            for (std::size_t i = 0U; i < kWords; ++i) {
+                words[i] = words_[i].load(std::memory_order_acquire);
+            }
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                if (before == 0U) {
+                    return false;
+                }
+                std::memcpy(&out, words.data(), sizeof(T));
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Number of completed Store() calls
+     */
+    [[nodiscard]] std::uint64_t Version() const noexcept {
+        return sequence_.load(std::memory_order_acquire) / 2U;
+    }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1U) / sizeof(std::uint64_t);
+
+    alignas(64) std::atomic<std::uint64_t> sequence_{0U};
+    std::array<std::atomic<std::uint64_t>, kWords> words_{};
+};
+
+} // namespace AutosarMusicPlayer::Common
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Single-writer cell publishing immutable, refcounted snapshots (RCU)
+ *
+ * The writer replaces the current value with Store(); any thread takes a
+ * std::shared_ptr to the current value with Load() and may keep it for as
+ * long as it likes. Neither side takes a lock:
+ * - Load() announces the node it is about to copy from in a hazard slot,
+ *   checks that the node is still current and only then bumps the refcount
+ * - Store() swaps in a new node and frees replaced nodes once no hazard
+ *   slot names them; the values themselves live on as long as a reader
+ *   holds a reference
+ *
+ * Only kMaxConcurrentLoads Load() calls can be inside their few
+ * instructions of hazard window at once; a further one spins until a slot
+ * frees up. Store() must not be called concurrently with itself, and no
+ * Load() may run during destruction.
+ *
+ * (std::atomic_load on shared_ptr would do the same, but libstdc++
+ * implements it with a mutex pool.)
+ *
+ * @tparam T Snapshot type; readers only ever see const T
+ */
+template <typename T>
+class SnapshotCell {
+public:
+    static constexpr std::size_t kMaxConcurrentLoads = 16U;
+
+    SnapshotCell() = default;
+
+    explicit SnapshotCell(std::shared_ptr<const T> initial) {
+        Store(std::move(initial));
+    }
+
+    ~SnapshotCell() {
+        delete current_.load(std::memory_order_relaxed);
+        for (Node* node : retired_) {
+            delete node;
+        }
+    }
+
+    SnapshotCell(const SnapshotCell&) = delete;
+    SnapshotCell& operator=(const SnapshotCell&) = delete;
+    SnapshotCell(SnapshotCell&&) = delete;
+    SnapshotCell& operator=(SnapshotCell&&) = delete;
+
+    /**
+     * @brief Current snapshot (nullptr before the first Store); any thread
+     */
+    [[nodiscard]] std::shared_ptr<const T> Load() const {
+        for (std::size_t slot = 0U;; slot = (slot + 1U) % kMaxConcurrentLoads) {
+            Node* node = current_.load(std::memory_order_seq_cst);
+            if (node == nullptr) {
+                return nullptr;
+            }
+
+            Node* expected = nullptr;
+            if (!hazards_[slot].compare_exchange_strong(expected, node, std::memory_order_seq_cst)) {
+                continue;
+            }
+
+            // A node that is still current after being announced cannot
+            // have been freed by the writer.
+            std::shared_ptr<const T> value;
+            if (current_.load(std::memory_order_seq_cst) == node) {
+                value = node->value;
+            }
+            hazards_[slot].store(nullptr, std::memory_order_release);
+            if (value != nullptr) {
+                return value;
+            }
+        }
+    }
+
+    /**
+     * @brief Publish @p value; writer thread only
+     */
+    void Store(std::shared_ptr<const T> value) {
+        Node* previous = current_.exchange(new Node{std::move(value)}, std::memory_order_seq_cst);
+        if (previous != nullptr) {
+            retired_.push_back(previous);
+        }
+        Reclaim();
+    }
+
+    /**
+     * @brief Replaced nodes that a reader may still be copying from
+     */
+    [[nodiscard]] std::size_t PendingReclaim() const noexcept {
+        return retired_.size();
+    }
+
+private:
+    struct Node {
+        std::shared_ptr<const T> value;
+    };
+
+    void Reclaim() {
+        std::size_t kept = 0U;
+        for (Node* node : retired_) {
+            bool announced = false;
+            for (const auto& hazard : hazards_) {
+                announced = announced || hazard.load(std::memory_order_seq_cst) == node;
+            }
+            if (announced) {
+                retired_[kept++] = node;
+            } else {
+                delete node;
+            }
+        }
+        retired_.resize(kept);
+    }
+
+    std::atomic<Node*> current_{nullptr};
+    mutable std::array<std::atomic<Node*>, kMaxConcurrentLoads> hazards_{};
+
+    // Writer-only.
+    std::vector<Node*> retired_;
+};
+
+} // namespace AutosarMusicPlayer::Common
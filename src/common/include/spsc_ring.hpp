@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring
+ *
+ * Each side owns one index and only reads the other's; both push and pop
+ * are wait-free, a handful of instructions with no read-modify-write, so
+ * the producer may be an interrupt handler. Each side also keeps a cached
+ * copy of the other's index and reloads it only when the ring looks full
+ * (or empty), so in steady state the two sides do not share cache lines.
+ *
+ * @tparam T Trivially copyable element type
+ * @tparam Capacity Number of slots, a power of two
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2U && (Capacity & (Capacity - 1U)) == 0U, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing elements are copied into slots");
+
+public:
+    SpscRing() noexcept = default;
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+    SpscRing(SpscRing&&) = delete;
+    SpscRing& operator=(SpscRing&&) = delete;
+    ~SpscRing() = default;
+
+    /**
+     * @brief Append @p value; false if the ring is full. Producer only.
+     */
+    bool TryPush(const T& value) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ == Capacity) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ == Capacity) {
+                return false;
+            }
+        }
+        slots_[tail & kMask] = value;
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest element into @p out; false if empty. Consumer only.
+     */
+    bool TryPop(T& out) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tailCache_) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head == tailCache_) {
+                return false;
+            }
+        }
+        out = slots_[head & kMask];
+        head_.store(head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    static constexpr std::size_t CapacityValue() noexcept {
+        return Capacity;
+    }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1U;
+
+    std::array<T, Capacity> slots_{};
+    alignas(64) std::atomic<std::size_t> tail_{0U};
+    std::size_t headCache_{0U}; ///< Producer's view of head_
+    alignas(64) std::atomic<std::size_t> head_{0U};
+    std::size_t tailCache_{0U}; ///< Consumer's view of tail_
+};
+
+} // namespace AutosarMusicPlayer::Common
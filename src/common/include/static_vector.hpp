@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Fixed-capacity vector with inline storage (no heap)
+ *
+ * Mirrors the subset of the std::vector interface used by the ASW
+ * containers, so storage policies can swap one for the other without
+ * touching the algorithms. Capacity is a compile-time constant; growing
+ * past it is a precondition violation, so callers check size() first.
+ *
+ * Elements past size() are kept default-constructed, which keeps the
+ * implementation free of placement new at the cost of requiring T to be
+ * default-constructible and move-assignable.
+ *
+ * @tparam T Element type
+ * @tparam N Capacity
+ */
+template <typename T, std::size_t N>
+class StaticVector {
+public:
+    static_assert(std::is_default_constructible<T>::value, "StaticVector requires default-constructible T");
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    StaticVector() = default;
+
+    StaticVector(size_type count, const T& value) {
+        assign(count, value);
+    }
+
+    // ========================================================================
+    // Capacity
+    // ========================================================================
+
+    [[nodiscard]] static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    [[nodiscard]] static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        return size_ == N;
+    }
+
+    /**
+     * @brief No-op; storage is always fully reserved
+     */
+    void reserve(size_type /*count*/) const noexcept {}
+
+    // ========================================================================
+    // Element Access
+    // ========================================================================
+
+    [[nodiscard]] T& operator[](size_type pos) noexcept {
+        return data_[pos];
+    }
+
+    [[nodiscard]] const T& operator[](size_type pos) const noexcept {
+        return data_[pos];
+    }
+
+    [[nodiscard]] T& front() noexcept {
+        return data_[0U];
+    }
+
+    [[nodiscard]] const T& front() const noexcept {
+        return data_[0U];
+    }
+
+    [[nodiscard]] T& back() noexcept {
+        return data_[size_ - 1U];
+    }
+
+    [[nodiscard]] const T& back() const noexcept {
+        return data_[size_ - 1U];
+    }
+
+    [[nodiscard]] T* data() noexcept {
+        return data_.data();
+    }
+
+    [[nodiscard]] const T* data() const noexcept {
+        return data_.data();
+    }
+
+    // ========================================================================
+    // Iterators
+    // ========================================================================
+
+    [[nodiscard]] iterator begin() noexcept {
+        return data_.data();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return data_.data();
+    }
+
+    [[nodiscard]] iterator end() noexcept {
+        return data_.data() + size_;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return data_.data() + size_;
+    }
+
+    // ========================================================================
+    // Modifiers
+    // ========================================================================
+
+    void push_back(const T& value) {
+        data_[size_] = value;
+        ++size_;
+    }
+
+    void push_back(T&& value) {
+        data_[size_] = std::move(value);
+        ++size_;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        data_[size_] = T(std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    void pop_back() {
+        --size_;
+        data_[size_] = T{};
+    }
+
+    void clear() {
+        for (size_type i = 0U; i < size_; ++i) {
+            data_[i] = T{};
+        }
+        size_ = 0U;
+    }
+
+    void resize(size_type count) {
+        resize(count, T{});
+    }
+
+    void resize(size_type count, const T& value) {
+        while (size_ > count) {
+            pop_back();
+        }
+        while (size_ < count) {
+            push_back(value);
+        }
+    }
+
+    void assign(size_type count, const T& value) {
+        clear();
+        resize(count, value);
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto offset = static_cast<size_type>(first - begin());
+        const auto count = static_cast<size_type>(last - first);
+        iterator dest = begin() + offset;
+        std::move(dest + count, end(), dest);
+        for (size_type i = 0U; i < count; ++i) {
+            pop_back();
+        }
+        return dest;
+    }
+
+private:
+    std::array<T, N> data_{};
+    size_type size_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Common
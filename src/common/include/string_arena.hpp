@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Append-only storage for many small strings
+ *
+ * Strings are copied back to back into large blocks, so storing N titles
+ * costs about N / (BlockSize / average length) allocations instead of N,
+ * and the bytes of consecutive titles share cache lines. Blocks never move:
+ * a view returned by Store stays valid until Clear() or destruction, also
+ * across moves of the arena.
+ *
+ * Individual strings cannot be freed; owners that replace strings track
+ * the dead bytes themselves and rebuild into a fresh arena when worthwhile.
+ */
+class StringArena {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 16U * 1024U;
+
+    explicit StringArena(std::size_t blockSize = kDefaultBlockSize) noexcept : blockSize_(blockSize) {}
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+    StringArena(StringArena&&) noexcept = default;
+    StringArena& operator=(StringArena&&) noexcept = default;
+    ~StringArena() = default;
+
+    /**
+     * @brief Copy @p text into the arena and return a view of the copy
+     */
+    [[nodiscard]] std::string_view Store(std::string_view text) {
+        if (text.empty()) {
+            return std::string_view{};
+        }
+
+        if (text.size() > blockSize_ / 4U) {
+            // Oversized strings get a block of their own, so they do not
+            // waste the tail of the current block.
+            largeBlocks_.push_back(Block{Allocate(text.size()), text.size()});
+            return Copy(largeBlocks_.back().data.get(), text);
+        }
+
+        if (current_ == blocks_.size() || blockSize_ - used_ < text.size()) {
+            NextBlock();
+        }
+
+        char* dst = blocks_[current_].data.get() + used_;
+        used_ += text.size();
+        return Copy(dst, text);
+    }
+
+    /**
+     * @brief Drop every string; all views returned so far dangle afterwards
+     */
+    void Clear() noexcept {
+        blocks_.clear();
+        largeBlocks_.clear();
+        current_ = 0U;
+        used_ = 0U;
+        bytesStored_ = 0U;
+    }
+
+    /**
+     * @brief Like Clear, but keep the shared blocks and fill them again
+     *
+     * Storing no more than before then allocates nothing.
+     */
+    void Reset() noexcept {
+        largeBlocks_.clear();
+        current_ = 0U;
+        used_ = 0U;
+        bytesStored_ = 0U;
+    }
+
+    /**
+     * @brief Total bytes of all strings stored since the last Clear
+     */
+    [[nodiscard]] std::size_t BytesStored() const noexcept {
+        return bytesStored_;
+    }
+
+    /**
+     * @brief Bytes held in blocks, including unused block tails
+     */
+    [[nodiscard]] std::size_t BytesReserved() const noexcept {
+        std::size_t total = 0U;
+        for (const auto& block : blocks_) {
+            total += block.capacity;
+        }
+        for (const auto& block : largeBlocks_) {
+            total += block.capacity;
+        }
+        return total;
+    }
+
+    [[nodiscard]] std::size_t BlockCount() const noexcept {
+        return blocks_.size() + largeBlocks_.size();
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        std::size_t capacity{0U};
+    };
+
+    static std::unique_ptr<char[]> Allocate(std::size_t size) {
+        // Not value-initialised: every byte is written before it is read.
+        return std::unique_ptr<char[]>(new char[size]);
+    }
+
+    // Move on to the next kept block, or allocate one.
+    void NextBlock() {
+        if (current_ < blocks_.size()) {
+            ++current_;
+        }
+        if (current_ == blocks_.size()) {
+            blocks_.push_back(Block{Allocate(blockSize_), blockSize_});
+        }
+        used_ = 0U;
+    }
+
+    std::string_view Copy(char* dst, std::string_view text) noexcept {
+        std::memcpy(dst, text.data(), text.size());
+        bytesStored_ += text.size();
+        return std::string_view(dst, text.size());
+    }
+
+    std::vector<Block> blocks_;      ///< Shared blocks; filled in order
+    std::vector<Block> largeBlocks_; ///< One string each
+    std::size_t blockSize_;
+    std::size_t current_{0U}; ///< Block being filled; blocks_.size() before the first
+    std::size_t used_{0U};    ///< Bytes used in blocks_[current_]
+    std::size_t bytesStored_{0U};
+};
+
+} // namespace AutosarMusicPlayer::Common
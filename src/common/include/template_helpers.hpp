@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string_view>
 #include <type_traits>
 
 namespace AutosarMusicPlayer::Common {
@@ -143,7 +144,19 @@ struct FunctionTraits<R (C::*)(Args...) const> {
  * Useful for converting string comparisons to integer comparisons
  */
 constexpr std::size_t HashFnv1a(const char* str, std::size_t hash = 14695981039346656037ULL) noexcept {
-    return (*str == '\0') ? hash : HashFnv1a(str + 1, (hash ^ static_cast<std::size_t>(*str)) * 1099511628211ULL);
+    return (*str == '\0') ? hash
+                           : HashFnv1a(str + 1, (hash ^ static_cast<unsigned char>(*str)) * std::size_t{1099511628211U});
+}
+
+/**
+ * @brief FNV-1a over a string that need not be null-terminated; equal to
+ *        HashFnv1a(const char*) for the same characters
+ */
+constexpr std::size_t HashFnv1a(std::string_view str, std::size_t hash = 14695981039346656037ULL) noexcept {
+    for (const char c : str) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * std::size_t{1099511628211U};
+    }
+    return hash;
 }
 
 /**
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "app_types.hpp"
+#include "string_arena.hpp"
+
+namespace AutosarMusicPlayer::Common {
+
+/**
+ * @brief Track metadata whose title points into a TrackList's arena
+ */
+struct TrackEntry {
+    SongId id{};
+    std::string_view title{};
+    std::uint32_t durationSeconds{};
+};
+
+/**
+ * @brief Track list handed from a media source to the playlist
+ *
+ * Each title is copied exactly once, into an arena owned by the list, and
+ * travels onwards as a string_view. Clear() keeps the entry capacity and
+ * the title blocks, so a list owned by a long-lived component is reused
+ * across refreshes without allocating once it has seen the largest library.
+ *
+ * Entry titles are valid until Clear() or destruction of the list.
+ */
+class TrackList {
+public:
+    using const_iterator = std::vector<TrackEntry>::const_iterator;
+
+    TrackList() = default;
+
+    void Reserve(std::size_t count) {
+        entries_.reserve(count);
+    }
+
+    void Add(SongId id, std::string_view title, std::uint32_t durationSeconds) {
+        entries_.push_back(TrackEntry{id, titles_.Store(title), durationSeconds});
+    }
+
+    void Clear() noexcept {
+        entries_.clear();
+        titles_.Reset();
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return entries_.size();
+    }
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return entries_.empty();
+    }
+
+    [[nodiscard]] const TrackEntry& operator[](std::size_t pos) const noexcept {
+        return entries_[pos];
+    }
+
+    [[nodiscard]] const TrackEntry* Data() const noexcept {
+        return entries_.data();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return entries_.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return entries_.end();
+    }
+
+    /**
+     * @brief Bytes of title text held by the list
+     */
+    [[nodiscard]] std::size_t TitleBytes() const noexcept {
+        return titles_.BytesStored();
+    }
+
+private:
+    std::vector<TrackEntry> entries_;
+    StringArena titles_;
+};
+
+} // namespace AutosarMusicPlayer::Common
@@ -0,0 +1,83 @@
+#include "alloc_counter.hpp"
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> g_allocations{0U};
+std::atomic<std::size_t> g_bytes{0U};
+std::atomic<std::size_t> g_liveBytes{0U};
+
+void* CountedAlloc(std::size_t size) {
+    void* ptr = std::malloc(size == 0U ? 1U : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    g_allocations.fetch_add(1U, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    g_liveBytes.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed);
+    return ptr;
+}
+
+void CountedFree(void* ptr) noexcept {
+    if (ptr != nullptr) {
+        g_liveBytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+        std::free(ptr);
+    }
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    return CountedAlloc(size);
+}
+
+void* operator new[](std::size_t size) {
+    return CountedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    CountedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    CountedFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    CountedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+    CountedFree(ptr);
+}
+
+namespace AutosarMusicPlayer::Test::Bench {
+
+AllocStats CurrentAllocStats() noexcept {
+    return AllocStats{g_allocations.load(std::memory_order_relaxed), g_bytes.load(std::memory_order_relaxed),
+                      g_liveBytes.load(std::memory_order_relaxed)};
+}
+
+std::size_t ResidentBytes() noexcept {
+    std::FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (statm == nullptr) {
+        return 0U;
+    }
+    unsigned long totalPages = 0U;
+    unsigned long residentPages = 0U;
+    const int fields = std::fscanf(statm, "%lu %lu", &totalPages, &residentPages);
+    std::fclose(statm);
+    if (fields != 2) {
+        return 0U;
+    }
+    return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+} // namespace AutosarMusicPlayer::Test::Bench
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+
+namespace AutosarMusicPlayer::Test::Bench {
+
+/**
+ * @brief Heap traffic seen by the replaced global operator new/delete
+ *
+ * Only meaningful inside the benchmark binary, which links alloc_counter.cpp.
+ */
+struct AllocStats {
+    std::size_t allocations{0U};
+    std::size_t bytes{0U};     ///< Requested bytes, cumulative
+    std::size_t liveBytes{0U}; ///< Usable bytes currently allocated
+};
+
+/**
+ * @brief Totals since process start; subtract two snapshots to measure a region
+ */
+[[nodiscard]] AllocStats CurrentAllocStats() noexcept;
+
+/**
+ * @brief Resident set size of the process in bytes (0 where unsupported)
+ */
+[[nodiscard]] std::size_t ResidentBytes() noexcept;
+
+} // namespace AutosarMusicPlayer::Test::Bench
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include "Com_Cfg.h"
+#include "bsw_mocks/loopback_can_if.hpp"
+#include "com.hpp"
+
+using AutosarMusicPlayer::Bsw::Com::Com;
+using AutosarMusicPlayer::Bsw::Com::PduConfig;
+using AutosarMusicPlayer::Test::Mocks::LoopbackCanIf;
+namespace Com_Cfg = AutosarMusicPlayer::Com_Cfg;
+
+namespace {
+
+constexpr int kSimulatedMs = 10000;
+constexpr int kStateChangeEveryMs = 2;
+
+/**
+ * Bus-load and latency report: ten simulated seconds of the generated
+ * configuration, main function every millisecond, with the playback state
+ * toggling every 2 ms (a user hammering play/pause, or a flapping source).
+ * The argument overrides the status PDU's minimum delay, in ms; 20 is the
+ * generated value. The wall time is the cost of the COM layer itself.
+ */
+void BM_Com_StatusStorm(benchmark::State& state) {
+    auto pdus = Com_Cfg::kTxPdus;
+    pdus[Com_Cfg::kPduMusicPlayerStatus].minDelayUs = static_cast<std::uint32_t>(state.range(0)) * 1000U;
+
+    AutosarMusicPlayer::Bsw::Com::BusLoadReport report;
+    AutosarMusicPlayer::Bsw::Com::PduStats stats;
+    for (auto _ : state) {
+        LoopbackCanIf bus;
+        bus.frames.reserve(kSimulatedMs);
+        Com com(bus, pdus, Com_Cfg::kTxSignals, Com_Cfg::kCanBitrate);
+
+        const Com::Clock::time_point start{};
+        for (int ms = 0; ms < kSimulatedMs; ++ms) {
+            const auto now = start + std::chrono::milliseconds(ms);
+            if (ms % kStateChangeEveryMs == 0) {
+                (void)com.SendSignal(Com_Cfg::kSigPlaybackState, static_cast<std::uint32_t>((ms / 2) % 2 + 1), now);
+            }
+            (void)com.SendSignal(Com_Cfg::kSigElapsedTimeMs, static_cast<std::uint32_t>(ms), now);
+            com.MainFunctionTx(now);
+        }
+        report = com.BusLoad();
+        stats = com.Stats(Com_Cfg::kPduMusicPlayerStatus);
+        benchmark::DoNotOptimize(bus.frames.data());
+    }
+
+    state.counters["busLoadPct"] = report.load * 100.0;
+    state.counters["frames"] = static_cast<double>(report.frames);
+    state.counters["statusFrames"] = static_cast<double>(stats.transmitted);
+    state.counters["coalesced"] = static_cast<double>(stats.coalesced);
+    state.counters["maxLatencyUs"] = static_cast<double>(stats.maxLatencyUs);
+    state.counters["avgLatencyUs"] = stats.latencySamples == 0U
+                                         ? 0.0
+                                         : static_cast<double>(stats.totalLatencyUs) /
+                                               static_cast<double>(stats.latencySamples);
+}
+BENCHMARK(BM_Com_StatusStorm)->Arg(0)->Arg(20)->Unit(benchmark::kMicrosecond);
+
+} // namespace
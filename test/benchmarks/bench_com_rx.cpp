@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Com_Cfg.h"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "com_rx.hpp"
+#include "playback_command_receiver.hpp"
+
+using AutosarMusicPlayer::Asw::Playback::PlaybackCommandReceiver;
+using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
+using AutosarMusicPlayer::Bsw::Com::ComRx;
+using AutosarMusicPlayer::Bsw::Hal::CanFrame;
+using AutosarMusicPlayer::Bsw::Hal::CanFrameBits;
+namespace Com_Cfg = AutosarMusicPlayer::Com_Cfg;
+
+namespace {
+
+constexpr std::uint32_t kBitrate = 1000000U;
+constexpr int kSimulatedMs = 10;
+
+/**
+ * Simulated 1 Mbit/s bus at 100 % load: back-to-back one-byte frames
+ * (65 bits worst case), one in eight addressed to us, the rest traffic of
+ * other ECUs spread over 48 ids. Frames carry sequence numbers so the
+ * button frames alternate Play/Pause presses with releases in between.
+ */
+class SimulatedBus {
+public:
+    static constexpr std::uint32_t kFrameBits = CanFrameBits(0x1A0U, 1U);
+
+    CanFrame Next() {
+        CanFrame frame;
+        frame.dlc = 1U;
+        if ((sequence_ % 8U) == 0U) {
+            frame.id = 0x1A0U;
+            const std::uint32_t press = (sequence_ / 8U) % 4U;
+            frame.data[0] = press == 1U ? 1U : (press == 3U ? 2U : 0U);
+        } else {
+            frame.id = 0x200U + (sequence_ * 7U) % 48U;
+            frame.data[0] = static_cast<std::uint8_t>(sequence_);
+        }
+        ++sequence_;
+        return frame;
+    }
+
+private:
+    std::uint32_t sequence_{0U};
+};
+
+/**
+ * Throughput of the receive path, interrupt callback to playback command,
+ * driven as the system runs it: a millisecond of bus traffic lands in the
+ * ring, then the 1 ms task runs MainFunctionRx(). The cpuPctAtFullBus
+ * counter is the share of one core this takes at full bus load.
+ */
+void BM_ComRx_FullBus1Mbit(benchmark::State& state) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager(codec, nullptr);
+    PlaybackCommandReceiver receiver(manager);
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, receiver);
+    SimulatedBus bus;
+
+    // Fractional frames carry over from one millisecond to the next.
+    std::uint64_t bitsOnBus = 0U;
+    std::uint64_t frames = 0U;
+    for (auto _ : state) {
+        for (int ms = 0; ms < kSimulatedMs; ++ms) {
+            bitsOnBus += kBitrate / 1000U;
+            while (bitsOnBus >= SimulatedBus::kFrameBits) {
+                bitsOnBus -= SimulatedBus::kFrameBits;
+                rx.RxIndication(bus.Next());
+                ++frames;
+            }
+            benchmark::DoNotOptimize(rx.MainFunctionRx());
+        }
+    }
+
+    const auto stats = rx.Stats();
+    state.SetItemsProcessed(static_cast<std::int64_t>(frames));
+    state.counters["busFramesPerSec"] = static_cast<double>(kBitrate) / SimulatedBus::kFrameBits;
+    // CPU time over simulated bus time, in percent.
+    const double simulatedSeconds = static_cast<double>(frames) * SimulatedBus::kFrameBits / kBitrate;
+    state.counters["cpuPctAtFullBus"] = benchmark::Counter(simulatedSeconds / 100.0,
+                                                           benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["commands"] = static_cast<double>(receiver.CommandsIssued());
+    state.counters["overruns"] = static_cast<double>(stats.overruns);
+}
+BENCHMARK(BM_ComRx_FullBus1Mbit);
+
+/**
+ * Latency of one button press from the receive interrupt to the playback
+ * manager's state change, excluding the wait for the 1 ms task.
+ */
+void BM_ComRx_PressToPlaybackCommand(benchmark::State& state) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager(codec, nullptr);
+    PlaybackCommandReceiver receiver(manager);
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, receiver);
+
+    std::array<CanFrame, 2U> presses{};
+    for (std::size_t i = 0U; i < presses.size(); ++i) {
+        presses[i].id = 0x1A0U;
+        presses[i].dlc = 1U;
+        presses[i].data[0] = static_cast<std::uint8_t>(i + 1U); // Play, Pause
+    }
+
+    std::size_t next = 0U;
+    for (auto _ : state) {
+        rx.RxIndication(presses[next]);
+        (void)rx.MainFunctionRx();
+        next ^= 1U;
+    }
+    benchmark::DoNotOptimize(manager.State());
+    state.counters["commands"] = static_cast<double>(receiver.CommandsIssued());
+}
+BENCHMARK(BM_ComRx_PressToPlaybackCommand);
+
+} // namespace
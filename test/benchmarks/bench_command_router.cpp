@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "alloc_counter.hpp"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "command_router.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Hmi::CommandRouter;
+using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Test::Bench::AllocStats;
+using AutosarMusicPlayer::Test::Bench::CurrentAllocStats;
+
+namespace {
+
+// A console session: every command succeeds in this order.
+constexpr std::array<std::string_view, 8U> kLines{
+    "play", "select 12", "next", "pause", "previous", "play", "select 3", "stop",
+};
+
+struct Setup {
+    Setup() {
+        for (SongId id = 1U; id <= 32U; ++id) {
+            (void)playlist.AddSong({id, "Song " + std::to_string(id), 180U});
+        }
+    }
+
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager{codec, nullptr};
+    Playlist playlist;
+};
+
+void ReportAllocations(benchmark::State& state, const AllocStats& before) {
+    const AllocStats after = CurrentAllocStats();
+    state.counters["allocs_per_cmd"] = static_cast<double>(after.allocations - before.allocations) /
+                                       static_cast<double>(state.iterations());
+}
+
+void BM_CommandRouter_PerfectHash(benchmark::State& state) {
+    Setup setup;
+    CommandRouter router(setup.manager, setup.playlist);
+
+    std::size_t next = 0U;
+    const AllocStats before = CurrentAllocStats();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(router.Execute(kLines[next]));
+        next = (next + 1U) % kLines.size();
+    }
+    ReportAllocations(state, before);
+}
+BENCHMARK(BM_CommandRouter_PerfectHash);
+
+/**
+ * Reference: the usual string-keyed table of std::function handlers, with
+ * the name and argument copied into std::strings for lookup and parsing.
+ */
+void BM_CommandRouter_UnorderedMapBaseline(benchmark::State& state) {
+    Setup setup;
+    PlaybackManager& manager = setup.manager;
+    Playlist& playlist = setup.playlist;
+    const std::unordered_map<std::string, std::function<AppError(const std::string&)>> handlers{
+        {"play", [&](const std::string&) { return manager.Play(); }},
+        {"pause", [&](const std::string&) { return manager.Pause(); }},
+        {"stop", [&](const std::string&) { return manager.Stop(); }},
+        {"next", [&](const std::string&) { return playlist.Next(); }},
+        {"previous", [&](const std::string&) { return playlist.Previous(); }},
+        {"select",
+         [&](const std::string& argument) {
+             char* end = nullptr;
+             const unsigned long id = std::strtoul(argument.c_str(), &end, 10);
+             return (argument.empty() || *end != '\0') ? AppError::InvalidArgument
+                                                       : playlist.SetCurrentSong(static_cast<SongId>(id));
+         }},
+    };
+
+    std::size_t next = 0U;
+    const AllocStats before = CurrentAllocStats();
+    for (auto _ : state) {
+        const std::string_view line = kLines[next];
+        const std::size_t blank = line.find(' ');
+        const std::string name(line.substr(0U, blank));
+        const std::string argument(blank == std::string_view::npos ? std::string_view{} : line.substr(blank + 1U));
+        const auto it = handlers.find(name);
+        benchmark::DoNotOptimize(it == handlers.end() ? AppError::NotFound : it->second(argument));
+        next = (next + 1U) % kLines.size();
+    }
+    ReportAllocations(state, before);
+}
+BENCHMARK(BM_CommandRouter_UnorderedMapBaseline);
+
+/**
+ * Lookup alone, no dispatch: perfect hash against unordered_map::find.
+ */
+void BM_CommandRouter_LookupOnly(benchmark::State& state) {
+    std::size_t next = 0U;
+    for (auto _ : state) {
+        const std::string_view line = kLines[next];
+        benchmark::DoNotOptimize(AutosarMusicPlayer::Asw::Hmi::kCommandHash.Find(line.substr(0U, line.find(' '))));
+        next = (next + 1U) % kLines.size();
+    }
+}
+BENCHMARK(BM_CommandRouter_LookupOnly);
+
+void BM_CommandRouter_LookupOnlyUnorderedMap(benchmark::State& state) {
+    const std::unordered_map<std::string, std::size_t> table{
+        {"play", 0U}, {"pause", 1U}, {"stop", 2U}, {"next", 3U}, {"previous", 4U}, {"select", 5U},
+    };
+    std::size_t next = 0U;
+    for (auto _ : state) {
+        const std::string_view line = kLines[next];
+        const auto it = table.find(std::string(line.substr(0U, line.find(' '))));
+        benchmark::DoNotOptimize(it);
+        next = (next + 1U) % kLines.size();
+    }
+}
+BENCHMARK(BM_CommandRouter_LookupOnlyUnorderedMap);
+
+/**
+ * A 64-command script in one call: one playlist transaction.
+ */
+void BM_CommandRouter_Script(benchmark::State& state) {
+    Setup setup;
+    CommandRouter router(setup.manager, setup.playlist);
+
+    std::string script;
+    for (std::size_t i = 0U; i < 64U; ++i) {
+        script.append(kLines[i % kLines.size()]);
+        script.push_back('\n');
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(router.ExecuteScript(script));
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_CommandRouter_Script);
+
+} // namespace
@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dsp_kernels.hpp"
+
+using AutosarMusicPlayer::Bsw::Dsp::DspIsa;
+using AutosarMusicPlayer::Bsw::Dsp::DspKernels;
+using AutosarMusicPlayer::Bsw::Dsp::KernelsFor;
+
+namespace {
+
+// One 10 ms stereo period at 48 kHz, a typical call size
+constexpr std::size_t kFrames = 480U;
+constexpr std::size_t kSamples = 2U * kFrames;
+
+/**
+ * @brief Kernels for the ISA in range(0), or nullptr after skipping
+ */
+const DspKernels* Select(benchmark::State& state) {
+    const auto isa = static_cast<DspIsa>(state.range(0));
+    const DspKernels* kernels = KernelsFor(isa);
+    if (kernels == nullptr) {
+        state.SkipWithError("ISA not supported here");
+        return nullptr;
+    }
+    state.SetLabel(AutosarMusicPlayer::Bsw::Dsp::ToString(isa));
+    return kernels;
+}
+
+std::vector<float> Signal() {
+    std::vector<float> signal(kSamples);
+    for (std::size_t i = 0U; i < kSamples; ++i) {
+        signal[i] = static_cast<float>(static_cast<int>(i % 200U) - 100) / 90.0F;
+    }
+    return signal;
+}
+
+void Finish(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kSamples));
+}
+
+void BM_Dsp_Int16ToFloat(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    std::vector<std::int16_t> in(kSamples);
+    KernelsFor(DspIsa::Scalar)->floatToInt16(Signal().data(), in.data(), kSamples);
+    std::vector<float> out(kSamples);
+    for (auto _ : state) {
+        kernels->int16ToFloat(in.data(), out.data(), kSamples);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    Finish(state);
+}
+
+void BM_Dsp_FloatToInt16(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    const std::vector<float> in = Signal();
+    std::vector<std::int16_t> out(kSamples);
+    for (auto _ : state) {
+        kernels->floatToInt16(in.data(), out.data(), kSamples);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    Finish(state);
+}
+
+void BM_Dsp_Int24ToFloat(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    std::vector<std::uint8_t> in(3U * kSamples);
+    KernelsFor(DspIsa::Scalar)->floatToInt24(Signal().data(), in.data(), kSamples);
+    std::vector<float> out(kSamples);
+    for (auto _ : state) {
+        kernels->int24ToFloat(in.data(), out.data(), kSamples);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    Finish(state);
+}
+
+void BM_Dsp_FloatToInt24(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    const std::vector<float> in = Signal();
+    std::vector<std::uint8_t> out(3U * kSamples);
+    for (auto _ : state) {
+        kernels->floatToInt24(in.data(), out.data(), kSamples);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    Finish(state);
+}
+
+void BM_Dsp_Deinterleave2(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    const std::vector<float> in = Signal();
+    std::vector<float> left(kFrames);
+    std::vector<float> right(kFrames);
+    for (auto _ : state) {
+        kernels->deinterleave2(in.data(), left.data(), right.data(), kFrames);
+        benchmark::DoNotOptimize(left.data());
+        benchmark::DoNotOptimize(right.data());
+        benchmark::ClobberMemory();
+    }
+    Finish(state);
+}
+
+void BM_Dsp_Interleave2(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    const std::vector<float> signal = Signal();
+    std::vector<float> out(kSamples);
+    for (auto _ : state) {
+        kernels->interleave2(signal.data(), signal.data() + kFrames, out.data(), kFrames);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    Finish(state);
+}
+
+void BM_Dsp_GainRamp(benchmark::State& state) {
+    const DspKernels* kernels = Select(state);
+    if (kernels == nullptr) {
+        return;
+    }
+    std::vector<float> samples = Signal();
+    for (auto _ : state) {
+        // Up then down: the combined gain never drops below one, so the
+        // samples cannot decay into denormals over the iterations.
+        kernels->gainRamp(samples.data(), kFrames, 2U, 0.5F, 2.0F);
+        kernels->gainRamp(samples.data(), kFrames, 2U, 2.0F, 0.5F);
+        benchmark::DoNotOptimize(samples.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * static_cast<std::int64_t>(kSamples));
+}
+
+#define DSP_BENCHMARK(fn)                                                                                            \
+    BENCHMARK(fn)                                                                                                    \
+        ->ArgName("isa")                                                                                             \
+        ->Arg(static_cast<int>(DspIsa::Scalar))                                                                     \
+        ->Arg(static_cast<int>(DspIsa::Sse2))                                                                       \
+        ->Arg(static_cast<int>(DspIsa::Avx2))
+
+DSP_BENCHMARK(BM_Dsp_Int16ToFloat);
+DSP_BENCHMARK(BM_Dsp_FloatToInt16);
+DSP_BENCHMARK(BM_Dsp_Int24ToFloat);
+DSP_BENCHMARK(BM_Dsp_FloatToInt24);
+DSP_BENCHMARK(BM_Dsp_Deinterleave2);
+DSP_BENCHMARK(BM_Dsp_Interleave2);
+DSP_BENCHMARK(BM_Dsp_GainRamp);
+
+} // namespace
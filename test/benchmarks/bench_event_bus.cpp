@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "app_events.hpp"
+#include "playlist_observer.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::IPlaylistObserver;
+using AutosarMusicPlayer::Common::AppEventBus;
+using AutosarMusicPlayer::Common::SongChangedEvent;
+using AutosarMusicPlayer::Common::SongId;
+
+namespace {
+
+/**
+ * Subscriber doing the same small amount of work on either path. Real
+ * subscribers are of different classes (HMI, view, snapshot publisher), so
+ * the benchmark alternates two, which also keeps the compiler from
+ * speculatively devirtualizing the observer loop.
+ */
+template <int Kind>
+class Listener final : public IPlaylistObserver {
+public:
+    void OnPlaylistChanged() override {}
+
+    void OnSongChanged(SongId newSongId) override {
+        sum += newSongId + Kind;
+    }
+
+    void OnSong(SongChangedEvent event) {
+        sum += event.id + Kind;
+    }
+
+    std::uint64_t sum{0U};
+};
+
+struct Listeners {
+    explicit Listeners(std::size_t count) : a((count + 1U) / 2U), b(count / 2U) {}
+
+    template <typename Fn>
+    void ForEach(Fn&& fn) {
+        for (std::size_t i = 0U; i < a.size(); ++i) {
+            fn(a[i]);
+            if (i < b.size()) {
+                fn(b[i]);
+            }
+        }
+    }
+
+    std::vector<Listener<0>> a;
+    std::vector<Listener<1>> b;
+};
+
+/**
+ * The bus: per-topic inline array, thunk calls.
+ */
+void BM_EventBus_FanOut(benchmark::State& state) {
+    const auto fanOut = static_cast<std::size_t>(state.range(0));
+    Listeners listeners(fanOut);
+    AppEventBus bus;
+    listeners.ForEach([&](auto& listener) {
+        using L = std::remove_reference_t<decltype(listener)>;
+        (void)bus.Subscribe<SongChangedEvent, &L::OnSong>(listener);
+    });
+
+    SongId id = 0U;
+    for (auto _ : state) {
+        bus.Publish(SongChangedEvent{++id});
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(listeners.a.front().sum);
+}
+BENCHMARK(BM_EventBus_FanOut)->Arg(1)->Arg(4)->Arg(8);
+
+/**
+ * Reference: the Playlist notification loop, a vector of observer pointers
+ * with a null check and a virtual call each.
+ */
+void BM_EventBus_FanOutObserverLoopBaseline(benchmark::State& state) {
+    const auto fanOut = static_cast<std::size_t>(state.range(0));
+    Listeners listeners(fanOut);
+    std::vector<IPlaylistObserver*> observers;
+    listeners.ForEach([&](auto& listener) { observers.push_back(&listener); });
+    benchmark::DoNotOptimize(observers.data());
+
+    SongId id = 0U;
+    for (auto _ : state) {
+        ++id;
+        for (auto* obs : observers) {
+            if (obs != nullptr) {
+                obs->OnSongChanged(id);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(listeners.a.front().sum);
+}
+BENCHMARK(BM_EventBus_FanOutObserverLoopBaseline)->Arg(1)->Arg(4)->Arg(8);
+
+} // namespace
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bsw_mocks/pcm_test_streams.hpp"
+#include "gapless_pcm_source.hpp"
+#include "pcm_sinks.hpp"
+#include "pcm_stream_engine.hpp"
+
+using AutosarMusicPlayer::Bsw::Audio::GaplessPcmSource;
+using AutosarMusicPlayer::Bsw::Audio::NullPcmSink;
+using AutosarMusicPlayer::Bsw::Audio::PcmEngineConfig;
+using AutosarMusicPlayer::Bsw::Audio::PcmStreamEngine;
+using AutosarMusicPlayer::Test::Mocks::CountingPcmSource;
+
+namespace {
+
+constexpr std::size_t kFrames = 480U; // one 10 ms period
+
+/**
+ * Track change the old way: Stop() and Start() on the engine, i.e. join
+ * both threads, drop what is buffered, decode the new track's first four
+ * periods and start the threads again. Nothing reaches the sink meanwhile,
+ * and the up to 40 ms of the old track still in the ring are lost.
+ */
+void BM_TrackChange_StopStart(benchmark::State& state) {
+    CountingPcmSource source(2U, ~std::uint64_t{0U});
+    NullPcmSink sink;
+    PcmStreamEngine engine(source, sink, PcmEngineConfig{});
+    (void)engine.Start();
+
+    for (auto _ : state) {
+        (void)engine.Stop();
+        (void)engine.Start();
+    }
+    (void)engine.Stop();
+}
+BENCHMARK(BM_TrackChange_StopStart)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Gapless: the decoder reads one period across the boundary of two
+ * tracks; the following track was pre-rolled when it was queued.
+ */
+void BM_TrackChange_Gapless(benchmark::State& state) {
+    std::vector<float> period(2U * kFrames);
+    GaplessPcmSource stream(2U);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        CountingPcmSource first(2U, kFrames / 2U);
+        CountingPcmSource second(2U, 10U * kFrames);
+        stream.Begin(first);
+        (void)stream.QueueNext(second);
+        (void)stream.Read(period.data(), 1U); // pre-rolls the second track
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(stream.Read(period.data(), kFrames));
+    }
+}
+BENCHMARK(BM_TrackChange_Gapless)->Unit(benchmark::kMicrosecond);
+
+} // namespace
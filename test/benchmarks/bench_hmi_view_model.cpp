@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "hmi_view_model.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Hmi::HmiFrame;
+using AutosarMusicPlayer::Asw::Hmi::HmiViewModel;
+using AutosarMusicPlayer::Asw::Playlist::IPlaylistObserver;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr std::size_t kSongs = 2000U;
+constexpr std::size_t kVisibleRows = 12U;
+constexpr int kEventsPerTick = 1000;
+
+/**
+ * Stands in for the renderer: formats every row it is given.
+ */
+class RenderingDisplay final : public AutosarMusicPlayer::Asw::Hmi::IHmiDisplay {
+public:
+    void OnFrame(const HmiFrame& frame) override {
+        for (const auto& row : frame.rows) {
+            Render(row.position, row.song.has_value() ? row.song->title : std::string_view{});
+        }
+    }
+
+    void Render(std::size_t position, std::string_view title) {
+        line.assign(std::to_string(position));
+        line.append(". ");
+        line.append(title);
+        ++rowsRendered;
+    }
+
+    std::string line;
+    std::size_t rowsRendered{0U};
+};
+
+/**
+ * Reference: redraw the visible window on every playlist event.
+ */
+class RedrawPerEvent final : public IPlaylistObserver {
+public:
+    RedrawPerEvent(Playlist& playlist, RenderingDisplay& display) : playlist_(playlist), display_(display) {
+        (void)playlist_.RegisterObserver(this);
+    }
+    ~RedrawPerEvent() override {
+        playlist_.UnregisterObserver(this);
+    }
+    RedrawPerEvent(const RedrawPerEvent&) = delete;
+    RedrawPerEvent& operator=(const RedrawPerEvent&) = delete;
+    RedrawPerEvent(RedrawPerEvent&&) = delete;
+    RedrawPerEvent& operator=(RedrawPerEvent&&) = delete;
+
+    void OnPlaylistChanged() override {}
+    void OnSongChanged(SongId /*newSongId*/) override {
+        Redraw();
+    }
+    void OnSongsUpdated(std::size_t /*first*/, std::size_t /*count*/) override {
+        Redraw();
+    }
+
+private:
+    void Redraw() {
+        for (std::size_t row = 0U; row < kVisibleRows; ++row) {
+            const auto song = playlist_.At(row);
+            display_.Render(row, song.has_value() ? song->title : std::string_view{});
+        }
+    }
+
+    Playlist& playlist_;
+    RenderingDisplay& display_;
+};
+
+void Populate(Playlist& playlist) {
+    std::vector<SongInfo> songs;
+    for (std::size_t i = 0U; i < kSongs; ++i) {
+        songs.push_back(SongInfo{static_cast<SongId>(i + 1U), "Track " + std::to_string(i), 200U});
+    }
+    (void)playlist.AddSongs(songs);
+}
+
+// A metadata refresh touching songs all over the list, some visible.
+void Storm(Playlist& playlist, const std::vector<std::vector<SongInfo>>& updates) {
+    for (int i = 0; i < kEventsPerTick; ++i) {
+        const auto& update = updates[static_cast<std::size_t>(i) % updates.size()];
+        (void)playlist.UpdateSongs(update.front().id - 1U, update);
+    }
+}
+
+std::vector<std::vector<SongInfo>> MakeUpdates() {
+    std::vector<std::vector<SongInfo>> updates;
+    for (std::size_t i = 0U; i < kSongs; i += 7U) {
+        updates.push_back({SongInfo{static_cast<SongId>(i + 1U), "Track " + std::to_string(i), 201U}});
+    }
+    return updates;
+}
+
+/**
+ * 1000 events, then one display tick.
+ */
+void BM_HmiViewModel_EventStormPerTick(benchmark::State& state) {
+    Playlist playlist;
+    Populate(playlist);
+    RenderingDisplay display;
+    HmiViewModel model(playlist, display, kVisibleRows);
+    const auto updates = MakeUpdates();
+
+    for (auto _ : state) {
+        Storm(playlist, updates);
+        benchmark::DoNotOptimize(model.Tick());
+    }
+    state.counters["rows_per_tick"] =
+        static_cast<double>(display.rowsRendered) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_HmiViewModel_EventStormPerTick);
+
+void BM_HmiViewModel_EventStormRedrawPerEventBaseline(benchmark::State& state) {
+    Playlist playlist;
+    Populate(playlist);
+    RenderingDisplay display;
+    RedrawPerEvent redraw(playlist, display);
+    const auto updates = MakeUpdates();
+
+    for (auto _ : state) {
+        Storm(playlist, updates);
+    }
+    state.counters["rows_per_tick"] =
+        static_cast<double>(display.rowsRendered) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_HmiViewModel_EventStormRedrawPerEventBaseline);
+
+} // namespace
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Rte_MusicPlayerApp.h"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "playback_manager.hpp"
+
+using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Test::Mocks::MockAudioCodec;
+
+namespace {
+
+/**
+ * RTE receiver that keeps the latest state and counts its traffic.
+ */
+class CountingRte final : public AutosarMusicPlayer::Rte::IRteMusicPlayerApp {
+public:
+    void NotifySongChanged(Rte_SongIdType /*newSongId*/) override {}
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) override {
+        latest = state;
+        lastSequence = sequence;
+        ++calls;
+    }
+
+    Rte_PlaybackStateType latest{Rte_PlaybackStateType::Stopped};
+    Rte_SequenceCounterType lastSequence{0U};
+    std::uint64_t calls{0U};
+};
+
+// Commands as they arrive from steering wheel, HMI and diagnostics at once:
+// mostly repeats of the current command.
+std::vector<std::uint8_t> MakeStorm() {
+    std::vector<std::uint8_t> commands(4096U);
+    std::uint32_t seed = 7U;
+    std::uint8_t last = 0U;
+    for (auto& command : commands) {
+        seed = seed * 1664525U + 1013904223U;
+        if ((seed >> 24U) % 8U == 0U) {
+            last = static_cast<std::uint8_t>((seed >> 16U) % 3U);
+        }
+        command = last;
+    }
+    return commands;
+}
+
+AppError Run(PlaybackManager& mgr, std::uint8_t command) {
+    switch (command) {
+    case 0U: return mgr.Play();
+    case 1U: return mgr.Pause();
+    default: return mgr.Stop();
+    }
+}
+
+/**
+ * Command storm with transition-only, typed notifications.
+ */
+void BM_PlaybackState_CommandStorm(benchmark::State& state) {
+    MockAudioCodec codec;
+    CountingRte rte;
+    PlaybackManager mgr(codec, &rte);
+    const auto commands = MakeStorm();
+
+    std::size_t i = 0U;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Run(mgr, commands[i++ % commands.size()]));
+    }
+    state.counters["rte_per_cmd"] =
+        static_cast<double>(rte.calls) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_PlaybackState_CommandStorm);
+
+/**
+ * Reference: the previous behaviour, a notification after every command
+ * with the state name, which the receiver copied into a std::string.
+ */
+void BM_PlaybackState_CommandStormNotifyAlwaysBaseline(benchmark::State& state) {
+    MockAudioCodec codec;
+    PlaybackManager mgr(codec, nullptr);
+    const auto commands = MakeStorm();
+
+    std::vector<std::string> received;
+    std::uint64_t calls = 0U;
+    std::size_t i = 0U;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Run(mgr, commands[i++ % commands.size()]));
+        received.emplace_back(mgr.StateName());
+        ++calls;
+        if (received.size() == 1024U) {
+            received.clear();
+        }
+    }
+    state.counters["rte_per_cmd"] = static_cast<double>(calls) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_PlaybackState_CommandStormNotifyAlwaysBaseline);
+
+} // namespace
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+// Per-operation cost should stay flat across this whole range.
+void PlaylistSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(200)->Arg(1000)->Arg(10000)->Arg(100000);
+}
+
+void FillPlaylist(Playlist& playlist, std::int64_t count) {
+    for (std::int64_t i = 1; i <= count; ++i) {
+        const auto id = static_cast<SongId>(i);
+        const AppError res = playlist.AddSong(SongInfo{id, "Track " + std::to_string(i), 180U});
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+// Cheap deterministic id sequence so lookups do not walk memory in order.
+SongId NextId(std::uint32_t& state, std::int64_t count) {
+    state = state * 1664525U + 1013904223U;
+    return (state % static_cast<std::uint32_t>(count)) + 1U;
+}
+
+void BM_Playlist_AddSong(benchmark::State& state) {
+    const std::int64_t count = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Playlist playlist(static_cast<std::size_t>(count));
+        state.ResumeTiming();
+        FillPlaylist(playlist, count);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Playlist_AddSong)->Apply(PlaylistSizes);
+
+void BM_Playlist_SetCurrentSong(benchmark::State& state) {
+    const std::int64_t count = state.range(0);
+    Playlist playlist(static_cast<std::size_t>(count));
+    FillPlaylist(playlist, count);
+
+    std::uint32_t rng = 1U;
+    for (auto _ : state) {
+        const AppError res = playlist.SetCurrentSong(NextId(rng, count));
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Playlist_SetCurrentSong)->Apply(PlaylistSizes);
+
+void BM_Playlist_GetCurrentSong(benchmark::State& state) {
+    const std::int64_t count = state.range(0);
+    Playlist playlist(static_cast<std::size_t>(count));
+    FillPlaylist(playlist, count);
+    (void)playlist.SetCurrentSong(static_cast<SongId>(count));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(playlist.GetCurrentSong());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Playlist_GetCurrentSong)->Apply(PlaylistSizes);
+
+void BM_Playlist_ContainsRandom(benchmark::State& state) {
+    const std::int64_t count = state.range(0);
+    Playlist playlist(static_cast<std::size_t>(count));
+    FillPlaylist(playlist, count);
+
+    std::uint32_t rng = 7U;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(playlist.Contains(NextId(rng, count)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Playlist_ContainsRandom)->Apply(PlaylistSizes);
+
+} // namespace
@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "playlist_event_dispatcher.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::IPlaylistObserver;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistEventDispatcher;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr SongId kLibrarySize = 1000U;
+
+/**
+ * Observer that takes 50us per event, like an HMI redrawing synchronously.
+ */
+class SlowObserver final : public IPlaylistObserver {
+public:
+    void OnPlaylistChanged() override {
+        Spin();
+    }
+    void OnSongChanged(SongId /*newSongId*/) override {
+        Spin();
+    }
+
+private:
+    static void Spin() {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(50);
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }
+};
+
+void FillLibrary(Playlist& playlist) {
+    std::vector<SongInfo> songs;
+    for (SongId id = 1U; id <= kLibrarySize; ++id) {
+        songs.push_back(SongInfo{id, "Track " + std::to_string(id), 200U});
+    }
+    (void)playlist.AddSongs(songs);
+}
+
+// One add, one removal and one song change: three coarse events.
+void Mutate(Playlist& playlist, SongId& id) {
+    (void)playlist.AddSong(SongInfo{id, "New", 200U});
+    (void)playlist.RemoveSong(id);
+    (void)playlist.SetCurrentSong(1U + id % kLibrarySize);
+    ++id;
+}
+
+/**
+ * Slow observer registered directly: every mutation waits for it.
+ */
+void BM_PlaylistDispatch_Synchronous(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    SlowObserver slow;
+    (void)playlist.RegisterObserver(&slow);
+
+    SongId id = kLibrarySize + 1U;
+    for (auto _ : state) {
+        Mutate(playlist, id);
+    }
+}
+BENCHMARK(BM_PlaylistDispatch_Synchronous)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Slow observer behind the dispatcher, pumped (untimed) every 256
+ * mutations as a display tick would.
+ */
+void BM_PlaylistDispatch_DeferredPump(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    PlaylistEventDispatcher dispatcher;
+    SlowObserver slow;
+    (void)playlist.RegisterObserver(&dispatcher);
+    (void)dispatcher.RegisterObserver(&slow);
+
+    SongId id = kLibrarySize + 1U;
+    for (auto _ : state) {
+        Mutate(playlist, id);
+        if (id % 256U == 0U) {
+            state.PauseTiming();
+            (void)dispatcher.Pump();
+            state.ResumeTiming();
+        }
+    }
+    state.counters["coalesced"] =
+        benchmark::Counter(static_cast<double>(dispatcher.Coalesced()) / static_cast<double>(dispatcher.Posted()));
+}
+BENCHMARK(BM_PlaylistDispatch_DeferredPump)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Slow observer behind the dispatcher's own consumer thread.
+ */
+void BM_PlaylistDispatch_DeferredThread(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    PlaylistEventDispatcher dispatcher;
+    SlowObserver slow;
+    (void)playlist.RegisterObserver(&dispatcher);
+    (void)dispatcher.RegisterObserver(&slow);
+    (void)dispatcher.Start();
+
+    SongId id = kLibrarySize + 1U;
+    for (auto _ : state) {
+        Mutate(playlist, id);
+    }
+    dispatcher.Stop();
+    state.counters["coalesced"] =
+        benchmark::Counter(static_cast<double>(dispatcher.Coalesced()) / static_cast<double>(dispatcher.Posted()));
+}
+BENCHMARK(BM_PlaylistDispatch_DeferredThread)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+/**
+ * Reference: the same mutations with no observer at all.
+ */
+void BM_PlaylistDispatch_NoObserver(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+
+    SongId id = kLibrarySize + 1U;
+    for (auto _ : state) {
+        Mutate(playlist, id);
+    }
+}
+BENCHMARK(BM_PlaylistDispatch_NoObserver)->Unit(benchmark::kMicrosecond);
+
+} // namespace
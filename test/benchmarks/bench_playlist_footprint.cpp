@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "app_types.hpp"
+#include "media_source_strategy.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::StaticPlaylist;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+using AutosarMusicPlayer::Test::Bench::AllocStats;
+using AutosarMusicPlayer::Test::Bench::CurrentAllocStats;
+
+namespace {
+
+// Titles sized like typical tag data, short enough to fit the fixed policy.
+std::string MakeTitle(std::int64_t i) {
+    return "Artist " + std::to_string(i % 97) + " - Track " + std::to_string(i);
+}
+
+template <typename PlaylistT>
+void Fill(PlaylistT& playlist, std::int64_t count) {
+    for (std::int64_t i = 1; i <= count; ++i) {
+        const AppError res = playlist.AddSong(SongInfo{static_cast<SongId>(i), MakeTitle(i), 180U});
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+/**
+ * Heap traffic (including growth reallocations) for building a library of
+ * range(0) songs.
+ * Reports bytes_per_song so the layout overhead can be compared with the
+ * fixed variant's sizeof.
+ */
+void BM_Footprint_DynamicPlaylist(benchmark::State& state) {
+    const std::int64_t count = state.range(0);
+    AllocStats used{};
+    for (auto _ : state) {
+        const AllocStats before = CurrentAllocStats();
+        auto playlist = std::make_unique<Playlist>();
+        Fill(*playlist, count);
+        const AllocStats after = CurrentAllocStats();
+        used = AllocStats{after.allocations - before.allocations, after.bytes - before.bytes, 0U};
+        benchmark::DoNotOptimize(playlist.get());
+    }
+    state.counters["heap_allocs"] = static_cast<double>(used.allocations);
+    state.counters["heap_bytes"] = static_cast<double>(used.bytes);
+    state.counters["bytes_per_song"] = static_cast<double>(used.bytes) / static_cast<double>(count);
+}
+BENCHMARK(BM_Footprint_DynamicPlaylist)->Arg(200)->Arg(10000)->Arg(250000)->Iterations(1);
+
+/**
+ * The fixed variant is one heap block for the object itself (made here only
+ * because it is too large for a benchmark thread's stack); filling it must
+ * not allocate at all.
+ */
+void BM_Footprint_StaticPlaylist(benchmark::State& state) {
+    const auto count = static_cast<std::int64_t>(AutosarMusicPlayer::Common::kMaxPlaylistSize);
+    std::size_t fillAllocs = 0U;
+    for (auto _ : state) {
+        auto playlist = std::make_unique<StaticPlaylist>();
+        const AllocStats before = CurrentAllocStats();
+        for (std::int64_t i = 1; i <= count; ++i) {
+            // Short enough for std::string's inline buffer, so only the playlist is measured.
+            const AppError res = playlist->AddSong(SongInfo{static_cast<SongId>(i), "Track", 180U});
+            benchmark::DoNotOptimize(res);
+        }
+        fillAllocs = CurrentAllocStats().allocations - before.allocations;
+        benchmark::DoNotOptimize(playlist.get());
+    }
+    state.counters["sizeof"] = static_cast<double>(sizeof(StaticPlaylist));
+    state.counters["fill_allocs"] = static_cast<double>(fillAllocs);
+}
+BENCHMARK(BM_Footprint_StaticPlaylist)->Iterations(1);
+
+// Hands out the same library on every scan; the titles are built up front
+// so only the refresh itself is measured.
+class FixedLibrarySource final : public AutosarMusicPlayer::Asw::MediaSource::IMediaSourceStrategy {
+public:
+    explicit FixedLibrarySource(std::int64_t count) {
+        for (std::int64_t i = 1; i <= count; ++i) {
+            titles_.push_back(MakeTitle(i));
+        }
+    }
+
+    const char* Name() const override { return "Fixed"; }
+    AppError Activate() override { return AppError::Ok; }
+    AppError Deactivate() override { return AppError::Ok; }
+
+    AppError GetAvailableTracks(AutosarMusicPlayer::Common::TrackList& outTracks) override {
+        outTracks.Clear();
+        for (std::size_t i = 0U; i < titles_.size(); ++i) {
+            outTracks.Add(static_cast<SongId>(i + 1U), titles_[i], 180U);
+        }
+        return AppError::Ok;
+    }
+
+private:
+    std::vector<std::string> titles_;
+};
+
+/**
+ * Rescanning an unchanged source into a StaticPlaylist. After the first
+ * scan has sized the handler's track list, a rescan should not allocate.
+ */
+void BM_Footprint_StaticPlaylistRescan(benchmark::State& state) {
+    const auto count = static_cast<std::int64_t>(AutosarMusicPlayer::Common::kMaxPlaylistSize);
+    auto playlist = std::make_unique<StaticPlaylist>();
+    AutosarMusicPlayer::Asw::MediaSource::MediaSourceHandler handler;
+    handler.SetStrategy(std::make_unique<FixedLibrarySource>(count));
+    benchmark::DoNotOptimize(handler.RefreshPlaylist(*playlist));
+
+    const AllocStats before = CurrentAllocStats();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handler.RefreshPlaylist(*playlist));
+    }
+    state.counters["allocs_per_rescan"] = static_cast<double>(CurrentAllocStats().allocations - before.allocations) /
+                                          static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_Footprint_StaticPlaylistRescan);
+
+} // namespace
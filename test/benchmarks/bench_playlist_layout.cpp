@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+
+// Iteration cost of the slot-map Playlist against the former
+// std::vector<std::unique_ptr<Song>> layout. The legacy layout is rebuilt
+// here with interleaved allocations and a shuffled order to mimic a heap
+// that has seen a few rescans. When Google Benchmark is built with libpfm,
+// run with --benchmark_perf_counters=CACHE-MISSES to see misses per song.
+
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::SongStorage;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr double kCacheLineBytes = 64.0;
+
+void LayoutSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(200)->Arg(10000)->Arg(100000);
+}
+
+SongInfo MakeSong(std::int64_t i) {
+    return SongInfo{static_cast<SongId>(i), "Artist - Track title " + std::to_string(i), 180U};
+}
+
+struct LegacySong {
+    explicit LegacySong(SongInfo i) : info(std::move(i)) {}
+    SongInfo info;
+};
+
+std::vector<std::unique_ptr<LegacySong>> MakeLegacy(std::int64_t count) {
+    std::vector<std::unique_ptr<LegacySong>> songs;
+    std::vector<std::unique_ptr<std::string>> noise;
+    songs.reserve(static_cast<std::size_t>(count));
+    for (std::int64_t i = 1; i <= count; ++i) {
+        songs.push_back(std::make_unique<LegacySong>(MakeSong(i)));
+        noise.push_back(std::make_unique<std::string>(static_cast<std::size_t>(i % 97) + 16U, 'x'));
+    }
+    std::mt19937 rng(42U);
+    std::shuffle(songs.begin(), songs.end(), rng);
+    return songs;
+}
+
+void FillPlaylist(Playlist& playlist, std::int64_t count) {
+    for (std::int64_t i = 1; i <= count; ++i) {
+        (void)playlist.AddSong(MakeSong(i));
+    }
+}
+
+void BM_Layout_Legacy_SumDurations(benchmark::State& state) {
+    const auto songs = MakeLegacy(state.range(0));
+    for (auto _ : state) {
+        std::uint64_t total = 0U;
+        for (const auto& song : songs) {
+            total += song->info.durationSeconds;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["cache_lines_per_song"] =
+        (sizeof(std::unique_ptr<LegacySong>) + sizeof(LegacySong)) / kCacheLineBytes;
+}
+BENCHMARK(BM_Layout_Legacy_SumDurations)->Apply(LayoutSizes);
+
+void BM_Layout_SlotMap_SumDurations(benchmark::State& state) {
+    Playlist playlist(static_cast<std::size_t>(state.range(0)));
+    FillPlaylist(playlist, state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(playlist.TotalDurationSeconds());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["cache_lines_per_song"] = sizeof(SongStorage::HotRecord) / kCacheLineBytes;
+}
+BENCHMARK(BM_Layout_SlotMap_SumDurations)->Apply(LayoutSizes);
+
+void BM_Layout_Legacy_VisitTitles(benchmark::State& state) {
+    const auto songs = MakeLegacy(state.range(0));
+    for (auto _ : state) {
+        std::size_t chars = 0U;
+        for (const auto& song : songs) {
+            chars += song->info.title.size();
+        }
+        benchmark::DoNotOptimize(chars);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Layout_Legacy_VisitTitles)->Apply(LayoutSizes);
+
+void BM_Layout_SlotMap_VisitTitles(benchmark::State& state) {
+    Playlist playlist(static_cast<std::size_t>(state.range(0)));
+    FillPlaylist(playlist, state.range(0));
+    for (auto _ : state) {
+        std::size_t chars = 0U;
+        playlist.ForEachSong([&chars](const SongView& song) { chars += song.title.size(); });
+        benchmark::DoNotOptimize(chars);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Layout_SlotMap_VisitTitles)->Apply(LayoutSizes);
+
+void BM_Layout_SlotMap_RemoveFront(benchmark::State& state) {
+    const std::int64_t count = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Playlist playlist(static_cast<std::size_t>(count));
+        FillPlaylist(playlist, count);
+        state.ResumeTiming();
+        for (std::int64_t i = 1; i <= 100; ++i) {
+            benchmark::DoNotOptimize(playlist.RemoveSong(static_cast<SongId>(i)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+BENCHMARK(BM_Layout_SlotMap_RemoveFront)->Apply(LayoutSizes);
+
+} // namespace
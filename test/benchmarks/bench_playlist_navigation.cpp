@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::PlaybackOrder;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::RepeatMode;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr std::int64_t kLibrarySize = 100000;
+
+void FillLibrary(Playlist& playlist) {
+    std::vector<SongInfo> songs;
+    songs.reserve(static_cast<std::size_t>(kLibrarySize));
+    for (std::int64_t i = 1; i <= kLibrarySize; ++i) {
+        const auto id = static_cast<SongId>(i);
+        songs.push_back(SongInfo{id, "Track " + std::to_string(id), 200U});
+    }
+    const AppError res = playlist.AddSongs(songs);
+    benchmark::DoNotOptimize(res);
+}
+
+/**
+ * Next() with repeat on a 100k playlist; range(0) selects shuffle.
+ */
+void BM_PlaylistNavigation_Next(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    playlist.SetRepeatMode(RepeatMode::All);
+    playlist.SetPlaybackOrder(state.range(0) != 0 ? PlaybackOrder::Shuffle : PlaybackOrder::Sequential);
+
+    for (auto _ : state) {
+        const AppError res = playlist.Next();
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetLabel(state.range(0) != 0 ? "shuffle" : "sequential");
+}
+BENCHMARK(BM_PlaylistNavigation_Next)->Arg(0)->Arg(1);
+
+/**
+ * Reference: finding the current song's position by linear search, which
+ * callers had to do before Next() existed.
+ */
+void BM_PlaylistNavigation_LinearNextBaseline(benchmark::State& state) {
+    std::vector<SongId> order(static_cast<std::size_t>(kLibrarySize));
+    std::iota(order.begin(), order.end(), 1U);
+
+    SongId current = 1U;
+    for (auto _ : state) {
+        const auto it = std::find(order.begin(), order.end(), current);
+        const auto next = it + 1 == order.end() ? order.begin() : it + 1;
+        current = *next;
+        benchmark::DoNotOptimize(current);
+    }
+}
+BENCHMARK(BM_PlaylistNavigation_LinearNextBaseline);
+
+/**
+ * Adding a song to and removing the current song from a shuffled 100k
+ * playlist, so the shuffle order is spliced both ways each iteration.
+ */
+void BM_PlaylistNavigation_ShuffleEdit(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    playlist.SetPlaybackOrder(PlaybackOrder::Shuffle);
+
+    auto id = static_cast<SongId>(kLibrarySize + 1);
+    for (auto _ : state) {
+        (void)playlist.AddSong(SongInfo{id++, "New", 200U});
+        const auto current = playlist.GetCurrentSong();
+        (void)playlist.RemoveSong(current->id);
+    }
+    benchmark::DoNotOptimize(playlist.Size());
+}
+BENCHMARK(BM_PlaylistNavigation_ShuffleEdit);
+
+/**
+ * Dealing a fresh shuffle order for 100k songs, against shuffling a copy of
+ * the id list with std::shuffle.
+ */
+void BM_PlaylistNavigation_Reshuffle(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+
+    std::uint64_t seed = 0U;
+    for (auto _ : state) {
+        playlist.SetShuffleSeed(++seed);
+    }
+}
+BENCHMARK(BM_PlaylistNavigation_Reshuffle)->Unit(benchmark::kMillisecond);
+
+void BM_PlaylistNavigation_StdShuffleBaseline(benchmark::State& state) {
+    std::vector<SongId> order(static_cast<std::size_t>(kLibrarySize));
+    std::mt19937 rng(1U);
+    for (auto _ : state) {
+        std::iota(order.begin(), order.end(), 1U);
+        std::shuffle(order.begin(), order.end(), rng);
+        benchmark::DoNotOptimize(order.data());
+    }
+}
+BENCHMARK(BM_PlaylistNavigation_StdShuffleBaseline)->Unit(benchmark::kMillisecond);
+
+} // namespace
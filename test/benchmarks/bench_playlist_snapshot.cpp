@@ -0,0 +1,179 @@
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "playlist_snapshot.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistSnapshotPublisher;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr std::size_t kLibrarySize = 100000U;
+constexpr std::size_t kRowsPerRead = 20U;
+
+std::vector<SongInfo> MakeSongs(SongId first, std::size_t count, const std::string& suffix) {
+    std::vector<SongInfo> songs;
+    songs.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        const auto id = static_cast<SongId>(first + i);
+        songs.push_back(SongInfo{id, "Track " + std::to_string(id) + suffix, 200U});
+    }
+    return songs;
+}
+
+/**
+ * One rescan as the media thread does it: drop and re-add a tenth of the
+ * library and retitle another tenth, inside one UpdateScope.
+ */
+void Rescan(Playlist& playlist, std::uint32_t generation) {
+    const Playlist::UpdateScope scope(playlist);
+    const std::string suffix = " r" + std::to_string(generation);
+    const std::size_t chunk = kLibrarySize / 10U;
+
+    std::vector<SongId> dropped;
+    for (std::size_t i = 0U; i < chunk; ++i) {
+        dropped.push_back(playlist.At(playlist.Size() - chunk + i)->id);
+    }
+    (void)playlist.RemoveRange(playlist.Size() - chunk, chunk);
+    std::vector<SongInfo> readded;
+    for (const SongId id : dropped) {
+        readded.push_back(SongInfo{id, "Track " + std::to_string(id) + suffix, 200U});
+    }
+    (void)playlist.InsertSongs((generation * 7919U) % playlist.Size(), readded);
+
+    const std::size_t first = (generation * 104729U) % (playlist.Size() - chunk);
+    std::vector<SongInfo> retitled;
+    for (std::size_t i = 0U; i < chunk; ++i) {
+        const SongId id = playlist.At(first + i)->id;
+        retitled.push_back(SongInfo{id, "Track " + std::to_string(id) + suffix, 200U});
+    }
+    (void)playlist.UpdateSongs(first, retitled);
+}
+
+// Times the calling thread gave up the CPU to wait (Linux).
+long VoluntaryWaits() {
+    rusage usage{};
+    (void)getrusage(RUSAGE_THREAD, &usage);
+    return usage.ru_nvcsw;
+}
+
+/**
+ * Runs the reader loop while a writer thread rescans continuously; reports
+ * mean time per read, p99 and max read latency, and how often the reader
+ * had to wait. On a single core the max includes preemption by the writer;
+ * waits only count blocking.
+ */
+template <typename Read, typename Write>
+void MeasureReads(benchmark::State& state, Read&& read, Write&& write) {
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (std::uint32_t generation = 1U; !done.load(std::memory_order_relaxed); ++generation) {
+            write(generation);
+        }
+    });
+
+    std::vector<double> latencies;
+    const long waitsBefore = VoluntaryWaits();
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        read();
+        const auto stop = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+    }
+    const long waits = VoluntaryWaits() - waitsBefore;
+    done.store(true);
+    writer.join();
+
+    state.counters["waits"] = static_cast<double>(waits);
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p99_us"] = latencies[latencies.size() * 99U / 100U];
+    state.counters["max_us"] = latencies.back();
+}
+
+/**
+ * HMI read (current song plus a 20-row window) from a snapshot.
+ */
+void BM_PlaylistSnapshot_ReadDuringRescan(benchmark::State& state) {
+    Playlist playlist;
+    (void)playlist.AddSongs(MakeSongs(1U, kLibrarySize, ""));
+    PlaylistSnapshotPublisher publisher(playlist);
+
+    std::size_t row = 0U;
+    MeasureReads(
+        state,
+        [&]() {
+            const auto snapshot = publisher.Acquire();
+            benchmark::DoNotOptimize(snapshot->GetCurrentSong());
+            row = (row + 4099U) % (snapshot->Size() - kRowsPerRead);
+            for (std::size_t i = 0U; i < kRowsPerRead; ++i) {
+                benchmark::DoNotOptimize(snapshot->At(row + i));
+            }
+        },
+        [&](std::uint32_t generation) { Rescan(playlist, generation); });
+}
+BENCHMARK(BM_PlaylistSnapshot_ReadDuringRescan)->Iterations(200000)->UseRealTime();
+
+/**
+ * Same read through the coarse mutex the HMI used before: it waits for
+ * the whole rescan.
+ */
+void BM_PlaylistSnapshot_MutexBaseline(benchmark::State& state) {
+    Playlist playlist;
+    (void)playlist.AddSongs(MakeSongs(1U, kLibrarySize, ""));
+    std::mutex mutex;
+
+    std::size_t row = 0U;
+    MeasureReads(
+        state,
+        [&]() {
+            const std::lock_guard<std::mutex> lock(mutex);
+            benchmark::DoNotOptimize(playlist.GetCurrentSong());
+            row = (row + 4099U) % (playlist.Size() - kRowsPerRead);
+            for (std::size_t i = 0U; i < kRowsPerRead; ++i) {
+                benchmark::DoNotOptimize(playlist.At(row + i));
+            }
+        },
+        [&](std::uint32_t generation) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            Rescan(playlist, generation);
+        });
+}
+BENCHMARK(BM_PlaylistSnapshot_MutexBaseline)->Iterations(200000)->UseRealTime();
+
+/**
+ * Writer-side cost of one rescan with the publisher attached, against the
+ * same rescan without it.
+ */
+void BM_PlaylistSnapshot_RescanCost(benchmark::State& state) {
+    Playlist playlist;
+    (void)playlist.AddSongs(MakeSongs(1U, kLibrarySize, ""));
+    std::unique_ptr<PlaylistSnapshotPublisher> publisher;
+    if (state.range(0) != 0) {
+        publisher = std::make_unique<PlaylistSnapshotPublisher>(playlist);
+    }
+
+    std::uint32_t generation = 0U;
+    for (auto _ : state) {
+        Rescan(playlist, ++generation);
+    }
+    state.SetLabel(state.range(0) != 0 ? "with publisher" : "plain");
+}
+BENCHMARK(BM_PlaylistSnapshot_RescanCost)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+} // namespace
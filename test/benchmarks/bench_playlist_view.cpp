@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "playlist_view.hpp"
+#include "title_folding.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::AppendFolded;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistView;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr std::int64_t kLibrarySize = 100000;
+
+// Titles in scrambled order so the sorted view is not just append-only.
+std::string TitleFor(std::uint32_t n) {
+    const std::uint32_t scrambled = n * 2654435761U;
+    return "Track " + std::to_string(scrambled % 1000003U) + " - Artist " + std::to_string(n % 97U);
+}
+
+void FillLibrary(Playlist& playlist, std::int64_t count) {
+    std::vector<SongInfo> songs;
+    songs.reserve(static_cast<std::size_t>(count));
+    for (std::int64_t i = 1; i <= count; ++i) {
+        const auto id = static_cast<SongId>(i);
+        songs.push_back(SongInfo{id, TitleFor(id), id % 600U});
+    }
+    const AppError res = playlist.AddSongs(songs);
+    benchmark::DoNotOptimize(res);
+}
+
+/**
+ * One song added to and removed from a 100k library with a title-sorted
+ * view attached. Only the add plus the view update are timed.
+ */
+void BM_PlaylistView_InsertOne(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist, kLibrarySize);
+    PlaylistView view(playlist, PlaylistView::Order::Title);
+    benchmark::DoNotOptimize(view.Size());
+
+    auto id = static_cast<SongId>(kLibrarySize + 1);
+    for (auto _ : state) {
+        const AppError res = playlist.AddSong(SongInfo{id, TitleFor(id), 200U});
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(view.Size());
+
+        state.PauseTiming();
+        (void)playlist.RemoveSong(id);
+        benchmark::DoNotOptimize(view.Size());
+        ++id;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_PlaylistView_InsertOne);
+
+/**
+ * Same as InsertOne but for removal.
+ */
+void BM_PlaylistView_RemoveOne(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist, kLibrarySize);
+    PlaylistView view(playlist, PlaylistView::Order::Title);
+    benchmark::DoNotOptimize(view.Size());
+
+    auto id = static_cast<SongId>(kLibrarySize + 1);
+    for (auto _ : state) {
+        state.PauseTiming();
+        (void)playlist.AddSong(SongInfo{id, TitleFor(id), 200U});
+        benchmark::DoNotOptimize(view.Size());
+        state.ResumeTiming();
+
+        const AppError res = playlist.RemoveSong(id);
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(view.Size());
+        ++id;
+    }
+}
+BENCHMARK(BM_PlaylistView_RemoveOne);
+
+/**
+ * Reference: what re-sorting the whole library on every change costs, even
+ * with the folded keys already computed.
+ */
+void BM_PlaylistView_FullResortBaseline(benchmark::State& state) {
+    std::vector<std::string> keys;
+    for (std::int64_t i = 1; i <= kLibrarySize; ++i) {
+        std::string folded;
+        AppendFolded(TitleFor(static_cast<std::uint32_t>(i)), folded);
+        keys.push_back(std::move(folded));
+    }
+
+    std::vector<std::uint32_t> permutation(keys.size());
+    for (auto _ : state) {
+        for (std::uint32_t i = 0U; i < permutation.size(); ++i) {
+            permutation[i] = i;
+        }
+        std::sort(permutation.begin(), permutation.end(),
+                  [&keys](std::uint32_t lhs, std::uint32_t rhs) { return keys[lhs] < keys[rhs]; });
+        benchmark::DoNotOptimize(permutation.data());
+    }
+}
+BENCHMARK(BM_PlaylistView_FullResortBaseline)->Unit(benchmark::kMillisecond);
+
+/**
+ * Visible-window query: 20 rows at a random position of a 100k view.
+ */
+void BM_PlaylistView_Window(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist, kLibrarySize);
+    PlaylistView view(playlist, PlaylistView::Order::Title);
+    benchmark::DoNotOptimize(view.Size());
+
+    std::vector<SongView> rows;
+    std::uint32_t seed = 1U;
+    for (auto _ : state) {
+        seed = seed * 1664525U + 1013904223U;
+        const std::size_t first = seed % static_cast<std::uint32_t>(kLibrarySize);
+        benchmark::DoNotOptimize(view.Window(first, 20U, rows));
+    }
+}
+BENCHMARK(BM_PlaylistView_Window);
+
+} // namespace
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <ctime>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "resampler.hpp"
+
+using AutosarMusicPlayer::Bsw::Dsp::DspIsa;
+using AutosarMusicPlayer::Bsw::Dsp::KernelsFor;
+using AutosarMusicPlayer::Bsw::Dsp::Resampler;
+using AutosarMusicPlayer::Bsw::Dsp::ResamplerConfig;
+using AutosarMusicPlayer::Bsw::Dsp::ResamplerQuality;
+
+namespace {
+
+constexpr std::uint16_t kChannels = 2U;
+
+/**
+ * @brief One 10 ms period from @p inputRate to @p outputRate per iteration,
+ *        stereo, with the kernels of the ISA in range(0) and the tier in
+ *        range(1)
+ *
+ * "core_pct_per_ch" is the share of one core a channel costs in real time:
+ * CPU time over the duration of the audio, per channel, in percent.
+ */
+void Resample(benchmark::State& state, std::uint32_t inputRate, std::uint32_t outputRate) {
+    const auto isa = static_cast<DspIsa>(state.range(0));
+    const auto quality = static_cast<ResamplerQuality>(state.range(1));
+    if (KernelsFor(isa) == nullptr) {
+        state.SkipWithError("ISA not supported here");
+        return;
+    }
+
+    Resampler resampler;
+    if (resampler.Configure(ResamplerConfig{inputRate, outputRate, kChannels, quality}, *KernelsFor(isa)) !=
+        AutosarMusicPlayer::Common::AppError::Ok) {
+        state.SkipWithError("Configure failed");
+        return;
+    }
+
+    const std::size_t inputFrames = inputRate / 100U;
+    std::vector<float> input(inputFrames * kChannels);
+    for (std::size_t i = 0U; i < input.size(); ++i) {
+        input[i] = 0.5F * static_cast<float>(std::sin(0.05 * static_cast<double>(i / kChannels)));
+    }
+    std::vector<float> output((outputRate / 100U + 1U) * kChannels);
+
+    const std::clock_t start = std::clock();
+    for (auto _ : state) {
+        const auto result = resampler.Process(input.data(), inputFrames, output.data(), output.size() / kChannels);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    const double cpuSeconds = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+
+    const char* const tiers[] = {"Low", "Medium", "High"};
+    state.SetLabel(std::string(AutosarMusicPlayer::Bsw::Dsp::ToString(isa)) + "/" +
+                   tiers[static_cast<std::size_t>(quality)] + "/" + std::to_string(resampler.Taps()) + " taps");
+    const double audioSeconds = static_cast<double>(state.iterations()) * 0.01 * kChannels;
+    state.counters["core_pct_per_ch"] = 100.0 * cpuSeconds / audioSeconds;
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(outputRate / 100U * kChannels));
+}
+
+void BM_Resample_44k1To48k(benchmark::State& state) {
+    Resample(state, 44100U, 48000U);
+}
+
+void BM_Resample_48kTo44k1(benchmark::State& state) {
+    Resample(state, 48000U, 44100U);
+}
+
+// Interpolated mode: no per-phase bank for 47999/44100
+void BM_Resample_44k1To47k999(benchmark::State& state) {
+    Resample(state, 44100U, 47999U);
+}
+
+void Tiers(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"isa", "quality"});
+    for (const DspIsa isa : {DspIsa::Scalar, DspIsa::Sse2, DspIsa::Avx2}) {
+        for (const ResamplerQuality quality : {ResamplerQuality::Low, ResamplerQuality::Medium, ResamplerQuality::High}) {
+            bench->Args({static_cast<int>(isa), static_cast<int>(quality)});
+        }
+    }
+}
+
+BENCHMARK(BM_Resample_44k1To48k)->Apply(Tiers);
+BENCHMARK(BM_Resample_48kTo44k1)->Apply(Tiers);
+BENCHMARK(BM_Resample_44k1To47k999)->Apply(Tiers);
+
+} // namespace
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "Rte_MusicPlayerApp.h"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "hmi_controller.hpp"
+#include "playback_manager.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Hmi::BasicHmiController;
+using AutosarMusicPlayer::Asw::Playback::BasicPlaybackManager;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Rte::IRteMusicPlayerApp;
+using AutosarMusicPlayer::Rte::StaticRtePort;
+using AutosarMusicPlayer::Rte::VirtualRtePort;
+using AutosarMusicPlayer::Test::Mocks::MockAudioCodec;
+
+namespace {
+
+/**
+ * What a generated RTE does with the calls: write the sender/receiver
+ * buffers. No virtual functions; used through StaticRtePort.
+ */
+class BufferRte {
+public:
+    void NotifySongChanged(Rte_SongIdType newSongId) {
+        songId = newSongId;
+    }
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) {
+        playbackState = state;
+        stateSequence = sequence;
+    }
+
+    Rte_SongIdType songId{0U};
+    Rte_PlaybackStateType playbackState{Rte_PlaybackStateType::Stopped};
+    Rte_SequenceCounterType stateSequence{0U};
+};
+
+/**
+ * The same RTE behind IRteMusicPlayerApp; used through VirtualRtePort.
+ */
+class VirtualBufferRte final : public IRteMusicPlayerApp {
+public:
+    void NotifySongChanged(Rte_SongIdType newSongId) override {
+        buffers.NotifySongChanged(newSongId);
+    }
+
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) override {
+        buffers.NotifyPlaybackStateChanged(state, sequence);
+    }
+
+    BufferRte buffers;
+};
+
+/**
+ * An interface pointer whose dynamic type the optimizer cannot see, as when
+ * the RTE is linked from another translation unit.
+ */
+IRteMusicPlayerApp* Opaque(VirtualBufferRte& rte) {
+    IRteMusicPlayerApp* rteIf = &rte;
+    benchmark::DoNotOptimize(rteIf);
+    return rteIf;
+}
+
+/**
+ * HmiController::OnSongChanged: the song-change notification path.
+ */
+void BM_RteBinding_SongChangedVirtual(benchmark::State& state) {
+    Playlist playlist;
+    VirtualBufferRte rte;
+    BasicHmiController<VirtualRtePort> hmi(playlist, Opaque(rte));
+
+    AutosarMusicPlayer::Common::SongId id = 0U;
+    for (auto _ : state) {
+        hmi.OnSongChanged(++id);
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(rte.buffers.songId);
+}
+BENCHMARK(BM_RteBinding_SongChangedVirtual);
+
+void BM_RteBinding_SongChangedStatic(benchmark::State& state) {
+    using Port = StaticRtePort<BufferRte>;
+    Playlist playlist;
+    BufferRte rte;
+    BasicHmiController<Port> hmi(playlist, Port(rte));
+
+    AutosarMusicPlayer::Common::SongId id = 0U;
+    for (auto _ : state) {
+        hmi.OnSongChanged(++id);
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(rte.songId);
+}
+BENCHMARK(BM_RteBinding_SongChangedStatic);
+
+/**
+ * Play/Pause through the PlaybackManager: every command is a transition and
+ * so one state notification.
+ */
+template <typename Manager>
+void TogglePlayPause(benchmark::State& state, Manager& mgr) {
+    bool playing = false;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(playing ? mgr.Pause() : mgr.Play());
+        playing = !playing;
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_RteBinding_PlayPauseVirtual(benchmark::State& state) {
+    MockAudioCodec codec;
+    VirtualBufferRte rte;
+    BasicPlaybackManager<VirtualRtePort> mgr(codec, Opaque(rte));
+    TogglePlayPause(state, mgr);
+    benchmark::DoNotOptimize(rte.buffers.stateSequence);
+}
+BENCHMARK(BM_RteBinding_PlayPauseVirtual);
+
+void BM_RteBinding_PlayPauseStatic(benchmark::State& state) {
+    using Port = StaticRtePort<BufferRte>;
+    MockAudioCodec codec;
+    BufferRte rte;
+    BasicPlaybackManager<Port> mgr(codec, Port(rte));
+    TogglePlayPause(state, mgr);
+    benchmark::DoNotOptimize(rte.stateSequence);
+}
+BENCHMARK(BM_RteBinding_PlayPauseStatic);
+
+} // namespace
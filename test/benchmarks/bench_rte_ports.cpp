@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "Rte_MusicPlayerApp_Ports.h"
+
+using AutosarMusicPlayer::Rte::MusicPlayerAppRte;
+
+namespace {
+
+void BM_RtePorts_WriteSongId(benchmark::State& state) {
+    MusicPlayerAppRte rte;
+    Rte_SongIdType id = 0U;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rte.Write_PpCurrentSong_SongId(++id));
+    }
+}
+BENCHMARK(BM_RtePorts_WriteSongId);
+
+void BM_RtePorts_ReadSongId(benchmark::State& state) {
+    MusicPlayerAppRte rte;
+    (void)rte.Write_PpCurrentSong_SongId(42U);
+    Rte_SongIdType id = 0U;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rte.Read_PpCurrentSong_SongId(&id));
+        benchmark::DoNotOptimize(id);
+    }
+}
+BENCHMARK(BM_RtePorts_ReadSongId);
+
+void BM_RtePorts_WriteStatus(benchmark::State& state) {
+    MusicPlayerAppRte rte;
+    Rte_PlaybackStatusType status{Rte_PlaybackStateType::Playing, 0U};
+    for (auto _ : state) {
+        ++status.sequence;
+        benchmark::DoNotOptimize(rte.Write_PpPlaybackStatus_Status(status));
+    }
+}
+BENCHMARK(BM_RtePorts_WriteStatus);
+
+void BM_RtePorts_ReadStatus(benchmark::State& state) {
+    MusicPlayerAppRte rte;
+    (void)rte.Write_PpPlaybackStatus_Status(Rte_PlaybackStatusType{Rte_PlaybackStateType::Playing, 1U});
+    Rte_PlaybackStatusType status{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rte.Read_PpPlaybackStatus_Status(&status));
+        benchmark::DoNotOptimize(status);
+    }
+}
+BENCHMARK(BM_RtePorts_ReadStatus);
+
+void BM_RtePorts_SendReceiveEvent(benchmark::State& state) {
+    MusicPlayerAppRte rte;
+    Rte_PlaybackStatusType status{Rte_PlaybackStateType::Playing, 0U};
+    for (auto _ : state) {
+        ++status.sequence;
+        benchmark::DoNotOptimize(rte.Send_PpPlaybackEvents_Status(status));
+        benchmark::DoNotOptimize(rte.Receive_PpPlaybackEvents_Status(&status));
+    }
+}
+BENCHMARK(BM_RtePorts_SendReceiveEvent);
+
+/**
+ * Reference: the status guarded by a mutex, uncontended.
+ */
+void BM_RtePorts_ReadStatusMutexBaseline(benchmark::State& state) {
+    std::mutex mutex;
+    Rte_PlaybackStatusType shared{Rte_PlaybackStateType::Playing, 1U};
+    Rte_PlaybackStatusType status{};
+    for (auto _ : state) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            status = shared;
+        }
+        benchmark::DoNotOptimize(status);
+    }
+}
+BENCHMARK(BM_RtePorts_ReadStatusMutexBaseline);
+
+} // namespace
@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "title_folding.hpp"
+#include "title_search_index.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::AppendFolded;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Asw::Playlist::TitleSearchIndex;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr std::int64_t kLibrarySize = 100000;
+constexpr std::size_t kTopK = 20U;
+
+// Keystrokes of a user typing "beat" into the search box.
+const char* const kTyping[] = {"b", "be", "bea", "beat"};
+
+const char* const kWords[] = {"Love", "Night", "Beat", "Blue", "Heart", "Dance", "Fire", "Dream",
+                              "Rain", "Road", "Star", "Beach", "City", "Gold", "Soul", "Time"};
+
+std::string TitleFor(std::uint32_t n) {
+    const std::uint32_t scrambled = n * 2654435761U;
+    return std::string(kWords[scrambled % 16U]) + " " + kWords[(scrambled >> 8U) % 16U] + " " +
+           std::to_string(scrambled % 100003U);
+}
+
+void FillLibrary(Playlist& playlist) {
+    std::vector<SongInfo> songs;
+    songs.reserve(static_cast<std::size_t>(kLibrarySize));
+    for (std::int64_t i = 1; i <= kLibrarySize; ++i) {
+        const auto id = static_cast<SongId>(i);
+        songs.push_back(SongInfo{id, TitleFor(id), 200U});
+    }
+    const AppError res = playlist.AddSongs(songs);
+    benchmark::DoNotOptimize(res);
+}
+
+/**
+ * Top-20 word-prefix query per keystroke against 100k titles.
+ */
+void BM_TitleSearch_Prefix(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    TitleSearchIndex index(playlist);
+
+    const char* const query = kTyping[state.range(0)];
+    std::vector<SongId> results;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.FindPrefix(query, kTopK, results));
+    }
+    state.SetLabel(query);
+}
+BENCHMARK(BM_TitleSearch_Prefix)->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Same keystrokes as a substring query.
+ */
+void BM_TitleSearch_Substring(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    TitleSearchIndex index(playlist);
+
+    const char* const query = kTyping[state.range(0)];
+    std::vector<SongId> results;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.FindSubstring(query, kTopK, results));
+    }
+    state.SetLabel(query);
+}
+BENCHMARK(BM_TitleSearch_Substring)->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Reference: folding and scanning every title per keystroke.
+ */
+void BM_TitleSearch_LinearScanBaseline(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+
+    std::string folded;
+    std::vector<SongId> results;
+    for (auto _ : state) {
+        results.clear();
+        playlist.ForEachSong([&](const SongView& song) {
+            folded.clear();
+            AppendFolded(song.title, folded);
+            if (folded.find("beat") != std::string::npos) {
+                results.push_back(song.id);
+            }
+        });
+        benchmark::DoNotOptimize(results.data());
+    }
+}
+BENCHMARK(BM_TitleSearch_LinearScanBaseline)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Index upkeep: one song added to and removed from a 100k library.
+ */
+void BM_TitleSearch_AddRemoveOne(benchmark::State& state) {
+    Playlist playlist;
+    FillLibrary(playlist);
+    TitleSearchIndex index(playlist);
+
+    auto id = static_cast<SongId>(kLibrarySize + 1);
+    for (auto _ : state) {
+        (void)playlist.AddSong(SongInfo{id, TitleFor(id), 200U});
+        (void)playlist.RemoveSong(id);
+        ++id;
+    }
+    benchmark::DoNotOptimize(index.Size());
+}
+BENCHMARK(BM_TitleSearch_AddRemoveOne)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "app_types.hpp"
+#include "playlist.hpp"
+#include "song_index.hpp"
+#include "track_list.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::SongIndex;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+using AutosarMusicPlayer::Common::TrackList;
+using AutosarMusicPlayer::Test::Bench::AllocStats;
+using AutosarMusicPlayer::Test::Bench::CurrentAllocStats;
+using AutosarMusicPlayer::Test::Bench::ResidentBytes;
+
+namespace {
+
+// Stand-in for the mass-storage driver's directory cache. Names are longer
+// than the std::string small-buffer, like real file names.
+const std::vector<std::string>& DirectoryCache(std::size_t count) {
+    static std::vector<std::string> names;
+    if (names.size() < count) {
+        names.clear();
+        for (std::size_t i = 0U; i < count; ++i) {
+            names.push_back("Artist " + std::to_string(i % 211U) + " - Album " + std::to_string(i % 17U) +
+                            " - Track " + std::to_string(i) + ".wav");
+        }
+    }
+    return names;
+}
+
+// Playlist layout as it was before titles moved into an arena: the same
+// hot records, order and index, but one heap string per song.
+struct LegacyStorage {
+    struct HotRecord {
+        SongId id;
+        std::uint32_t durationSeconds;
+    };
+
+    void Add(SongInfo song) {
+        const auto slot = static_cast<std::uint32_t>(hot.size());
+        hot.push_back(HotRecord{song.id, song.durationSeconds});
+        titles.push_back(std::move(song.title));
+        order.push_back(slot);
+        index.Insert(song.id, slot);
+    }
+
+    std::vector<HotRecord> hot;
+    std::vector<std::string> titles;
+    std::vector<std::uint32_t> order;
+    SongIndex index;
+};
+
+void ReportFootprint(benchmark::State& state, const AllocStats& before, const AllocStats& after,
+                     std::size_t rssBefore, std::size_t rssAfter) {
+    const auto count = static_cast<double>(state.range(0));
+    state.counters["allocs"] = static_cast<double>(after.allocations - before.allocations);
+    state.counters["allocs_per_title"] = static_cast<double>(after.allocations - before.allocations) / count;
+    state.counters["retained_bytes"] = static_cast<double>(after.liveBytes - before.liveBytes);
+    state.counters["rss_delta"] = static_cast<double>(rssAfter > rssBefore ? rssAfter - rssBefore : 0U);
+}
+
+/**
+ * Previous flow: the driver hands out std::string names, the source copies
+ * them into SongInfo, the playlist keeps one std::string per song.
+ */
+void BM_TitleStorage_Legacy(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto& cache = DirectoryCache(count);
+    for (auto _ : state) {
+        const std::size_t rssBefore = ResidentBytes();
+        const AllocStats before = CurrentAllocStats();
+
+        auto storage = std::make_unique<LegacyStorage>();
+        {
+            std::vector<std::string> files(cache.begin(), cache.begin() + static_cast<std::ptrdiff_t>(count));
+            std::vector<SongInfo> tracks;
+            tracks.reserve(files.size());
+            SongId nextId = 1U;
+            for (const auto& name : files) {
+                SongInfo info;
+                info.id = nextId++;
+                info.title = name;
+                info.durationSeconds = 180U;
+                tracks.push_back(std::move(info));
+            }
+            storage->hot.reserve(tracks.size());
+            storage->titles.reserve(tracks.size());
+            storage->order.reserve(tracks.size());
+            storage->index.Reserve(tracks.size());
+            for (auto& track : tracks) {
+                storage->Add(std::move(track));
+            }
+        }
+
+        const AllocStats after = CurrentAllocStats();
+        ReportFootprint(state, before, after, rssBefore, ResidentBytes());
+        benchmark::DoNotOptimize(storage.get());
+    }
+}
+BENCHMARK(BM_TitleStorage_Legacy)->Arg(10000)->Arg(100000)->Iterations(1);
+
+/**
+ * Current flow: the driver hands out views, the source copies each title
+ * once into its TrackList arena, the playlist packs titles into its own
+ * arena.
+ */
+void BM_TitleStorage_Arena(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto& cache = DirectoryCache(count);
+    for (auto _ : state) {
+        const std::size_t rssBefore = ResidentBytes();
+        const AllocStats before = CurrentAllocStats();
+
+        auto playlist = std::make_unique<Playlist>();
+        {
+            std::vector<std::string_view> files(cache.begin(), cache.begin() + static_cast<std::ptrdiff_t>(count));
+            TrackList tracks;
+            tracks.Reserve(files.size());
+            SongId nextId = 1U;
+            for (const auto name : files) {
+                tracks.Add(nextId++, name, 180U);
+            }
+            const AppError res = playlist->AddSongs(tracks);
+            benchmark::DoNotOptimize(res);
+        }
+
+        const AllocStats after = CurrentAllocStats();
+        ReportFootprint(state, before, after, rssBefore, ResidentBytes());
+        benchmark::DoNotOptimize(playlist.get());
+    }
+}
+BENCHMARK(BM_TitleStorage_Arena)->Arg(10000)->Arg(100000)->Iterations(1);
+
+} // namespace
@@ -0,0 +1,185 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bsw_mocks/wav_test_files.hpp"
+#include "wav_reader.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+using AutosarMusicPlayer::Bsw::Audio::ParseWavHeader;
+using AutosarMusicPlayer::Bsw::Audio::PcmBlock;
+using AutosarMusicPlayer::Bsw::Audio::WavInfo;
+using AutosarMusicPlayer::Bsw::Audio::WavReader;
+using AutosarMusicPlayer::Common::AppError;
+
+namespace {
+
+constexpr std::size_t kFileBytes = std::size_t{64} << 20U; // ~6 minutes of 48 kHz stereo PCM16
+constexpr std::size_t kReadBufferBytes = std::size_t{64} << 10U;
+constexpr std::size_t kBlockFrames = kReadBufferBytes / 4U;
+
+const std::string& TestFile() {
+    static const std::string path = [] {
+        std::string name = "/tmp/bench_wav_reader.wav";
+        AutosarMusicPlayer::Test::Mocks::WavFileBuilder builder;
+        builder.samples.resize(kFileBytes);
+        for (std::size_t i = 0U; i < builder.samples.size(); ++i) {
+            builder.samples[i] = static_cast<std::uint8_t>(i * 131U);
+        }
+        (void)AutosarMusicPlayer::Test::Mocks::WriteBinaryFile(name, builder.Build());
+        return name;
+    }();
+    return path;
+}
+
+/**
+ * @brief Evict the file from the page cache, so the next pass reads the disk
+ */
+void DropFromPageCache(const std::string& path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        (void)posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        (void)close(fd);
+    }
+}
+
+/**
+ * @brief Read syscalls of this process so far (the kernel's own count)
+ */
+std::uint64_t ReadSyscalls() {
+    std::FILE* io = std::fopen("/proc/self/io", "r");
+    if (io == nullptr) {
+        return 0U;
+    }
+    unsigned long long count = 0U;
+    char line[64];
+    while (std::fgets(line, sizeof(line), io) != nullptr) {
+        if (std::sscanf(line, "syscr: %llu", &count) == 1) {
+            break;
+        }
+    }
+    (void)std::fclose(io);
+    return count;
+}
+
+std::uint64_t PageFaults() {
+    rusage usage{};
+    (void)getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::uint64_t>(usage.ru_minflt + usage.ru_majflt);
+}
+
+/**
+ * @brief Stand-in for the decoder: touch every sample once
+ */
+std::int64_t SumPcm16(const std::uint8_t* data, std::size_t bytes) {
+    std::int64_t sum = 0;
+    for (std::size_t i = 0U; i + 1U < bytes; i += 2U) {
+        std::int16_t sample = 0;
+        std::memcpy(&sample, data + i, sizeof(sample));
+        sum += sample;
+    }
+    return sum;
+}
+
+/**
+ * The same pass through the file with the baseline: read() into a 64 KiB
+ * buffer, i.e. a copy from the page cache plus one syscall per buffer.
+ */
+void BM_WavRead_BufferedRead(benchmark::State& state) {
+    const bool cold = state.range(0) != 0;
+    const std::string& path = TestFile();
+    std::vector<std::uint8_t> buffer(kReadBufferBytes);
+    std::uint64_t syscalls = 0U;
+    std::uint64_t faults = 0U;
+
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            DropFromPageCache(path);
+            state.ResumeTiming();
+        }
+        const std::uint64_t readsBefore = ReadSyscalls();
+        const std::uint64_t faultsBefore = PageFaults();
+
+        const int fd = open(path.c_str(), O_RDONLY);
+        std::int64_t sum = 0;
+        ssize_t got = read(fd, buffer.data(), buffer.size());
+        WavInfo info;
+        if (got <= 0 || ParseWavHeader(buffer.data(), static_cast<std::size_t>(got), info) != AppError::Ok) {
+            state.SkipWithError("header");
+            break;
+        }
+        std::size_t offset = info.dataOffset;
+        while (got > 0) {
+            sum += SumPcm16(buffer.data() + offset, static_cast<std::size_t>(got) - offset);
+            offset = 0U;
+            got = read(fd, buffer.data(), buffer.size());
+        }
+        (void)close(fd);
+        benchmark::DoNotOptimize(sum);
+
+        // The /proc read above is a syscall of its own; open and close are two more.
+        syscalls += ReadSyscalls() - readsBefore - 1U + 2U;
+        faults += PageFaults() - faultsBefore;
+    }
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["syscalls"] = static_cast<double>(syscalls) / iterations;
+    state.counters["faults"] = static_cast<double>(faults) / iterations;
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(kFileBytes));
+}
+BENCHMARK(BM_WavRead_BufferedRead)->ArgName("cold")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+/**
+ * WavReader: map, parse, walk the data chunk in 64 KiB views. Syscalls are
+ * open, fstat, mmap, close, munmap plus the read-ahead advice.
+ */
+void BM_WavRead_MappedReader(benchmark::State& state) {
+    const bool cold = state.range(0) != 0;
+    const std::string& path = TestFile();
+    std::uint64_t syscalls = 0U;
+    std::uint64_t faults = 0U;
+
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            DropFromPageCache(path);
+            state.ResumeTiming();
+        }
+        const std::uint64_t faultsBefore = PageFaults();
+
+        WavReader reader;
+        if (reader.Open(path.c_str()) != AppError::Ok) {
+            state.SkipWithError("open");
+            break;
+        }
+        std::int64_t sum = 0;
+        for (PcmBlock block = reader.NextBlock(kBlockFrames); block.frames != 0U;
+             block = reader.NextBlock(kBlockFrames)) {
+            sum += SumPcm16(block.data, block.frames * reader.Info().bytesPerFrame);
+        }
+        benchmark::DoNotOptimize(sum);
+        syscalls += 5U + reader.ReadAheadCalls();
+        reader.Close();
+        faults += PageFaults() - faultsBefore;
+    }
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["syscalls"] = static_cast<double>(syscalls) / iterations;
+    state.counters["faults"] = static_cast<double>(faults) / iterations;
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(kFileBytes));
+}
+BENCHMARK(BM_WavRead_MappedReader)->ArgName("cold")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "playlist.hpp"
+
+namespace AutosarMusicPlayer::Test::Mocks {
+
+class MockPlaylistObserver final : public Asw::Playlist::IPlaylistObserver {
+public:
+    void OnPlaylistChanged() override {
+        ++playlistChangedCalls;
+    }
+
+    void OnSongChanged(Common::SongId newSongId) override {
+        songChanged.push_back(newSongId);
+    }
+
+    void OnSongsInserted(std::size_t first, std::size_t count) override {
+        inserted.push_back(Range{first, count});
+    }
+
+    void OnSongsRemoved(std::size_t first, std::size_t count) override {
+        removed.push_back(Range{first, count});
+    }
+
+    void OnSongsUpdated(std::size_t first, std::size_t count) override {
+        updated.push_back(Range{first, count});
+    }
+
+    struct Range {
+        std::size_t first;
+        std::size_t count;
+    };
+
+    std::uint32_t playlistChangedCalls{0};
+    std::vector<Common::SongId> songChanged;
+    std::vector<Range> inserted;
+    std::vector<Range> removed;
+    std::vector<Range> updated;
+};
+
+} // namespace AutosarMusicPlayer::Test::Mocks
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "can_if.hpp"
+
+namespace AutosarMusicPlayer::Test::Mocks {
+
+/**
+ * @brief Virtual CAN bus: every transmitted frame is looped back into
+ *        `frames`, in order, as a receiving node would see it
+ *
+ * `freeMailboxes` limits how many frames are accepted before Transmit()
+ * reports Busy (a full controller); -1 accepts everything.
+ */
+class LoopbackCanIf final : public Bsw::Hal::ICanIf {
+public:
+    Common::AppError Transmit(const Bsw::Hal::CanFrame& frame) override {
+        if (freeMailboxes == 0) {
+            ++refused;
+            return Common::AppError::Busy;
+        }
+        if (freeMailboxes > 0) {
+            --freeMailboxes;
+        }
+        frames.push_back(frame);
+        return Common::AppError::Ok;
+    }
+
+    [[nodiscard]] std::size_t CountOf(std::uint32_t id) const {
+        std::size_t count = 0U;
+        for (const auto& frame : frames) {
+            count += frame.id == id ? 1U : 0U;
+        }
+        return count;
+    }
+
+    std::vector<Bsw::Hal::CanFrame> frames;
+    int freeMailboxes{-1};
+    std::size_t refused{0U};
+};
+
+} // namespace AutosarMusicPlayer::Test::Mocks
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "pcm_types.hpp"
+
+namespace AutosarMusicPlayer::Test::Mocks {
+
+/**
+ * @brief Source whose n-th frame holds @p firstValue + n in every channel,
+ *        so silence (0) is distinguishable from audio and gaps or repeats
+ *        are visible
+ */
+class CountingPcmSource final : public Bsw::Audio::IPcmSource {
+public:
+    CountingPcmSource(std::uint16_t channels, std::uint64_t totalFrames, std::uint64_t firstValue = 1U)
+        : channels_(channels), total_(totalFrames), first_(firstValue) {}
+
+    std::size_t Read(float* samples, std::size_t frames) override {
+        if (delay != std::chrono::microseconds::zero()) {
+            std::this_thread::sleep_for(delay);
+        }
+        std::size_t count = 0U;
+        for (; count < frames && next_ < total_; ++count, ++next_) {
+            for (std::uint16_t ch = 0U; ch < channels_; ++ch) {
+                *samples++ = static_cast<float>(first_ + next_);
+            }
+        }
+        return count;
+    }
+
+    [[nodiscard]] std::uint64_t FramesRead() const noexcept {
+        return next_;
+    }
+
+    std::chrono::microseconds delay{0}; ///< Per Read(); set before Start()
+
+private:
+    std::uint16_t channels_;
+    std::uint64_t total_;
+    std::uint64_t first_;
+    std::uint64_t next_{0U};
+};
+
+/**
+ * @brief Sink keeping the first channel of everything written
+ */
+class RecordingPcmSink final : public Bsw::Audio::IPcmSink {
+public:
+    explicit RecordingPcmSink(std::uint16_t channels) : channels_(channels) {}
+
+    Common::AppError Write(const float* samples, std::size_t frames) override {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t i = 0U; i < frames; ++i) {
+            samples_.push_back(samples[i * channels_]);
+        }
+        return Common::AppError::Ok;
+    }
+
+    [[nodiscard]] std::vector<float> Samples() const {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return samples_;
+    }
+
+    [[nodiscard]] std::size_t FrameCount() const {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return samples_.size();
+    }
+
+private:
+    std::uint16_t channels_;
+    mutable std::mutex mutex_;
+    std::vector<float> samples_;
+};
+
+} // namespace AutosarMusicPlayer::Test::Mocks
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace AutosarMusicPlayer::Test::Mocks {
+
+/**
+ * @brief Builds WAV files byte by byte, including broken ones
+ */
+struct WavFileBuilder {
+    std::uint16_t formatTag{1U}; ///< WAVE_FORMAT_PCM
+    std::uint16_t channels{2U};
+    std::uint32_t sampleRate{48000U};
+    std::uint16_t bitsPerSample{16U};
+    bool extensible{false}; ///< formatTag becomes the sub-format
+    std::vector<std::uint8_t> samples;
+    std::uint32_t extraChunkBytes{0U}; ///< Size of a "LIST" chunk before the data; odd sizes get padded
+    std::size_t dataSizeSlack{0U};     ///< Declared data size beyond the samples written
+
+    static void Put16(std::vector<std::uint8_t>& out, std::uint32_t value) {
+        out.push_back(static_cast<std::uint8_t>(value));
+        out.push_back(static_cast<std::uint8_t>(value >> 8U));
+    }
+
+    static void Put32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+        Put16(out, value & 0xFFFFU);
+        Put16(out, value >> 16U);
+    }
+
+    static void PutTag(std::vector<std::uint8_t>& out, const char* tag) {
+        for (std::size_t i = 0U; i < 4U; ++i) {
+            out.push_back(static_cast<std::uint8_t>(tag[i]));
+        }
+    }
+
+    [[nodiscard]] std::vector<std::uint8_t> Build() const {
+        std::vector<std::uint8_t> out;
+        PutTag(out, "RIFF");
+        Put32(out, 0U); // patched below
+        PutTag(out, "WAVE");
+
+        const std::uint32_t blockAlign = channels * (bitsPerSample / 8U);
+        PutTag(out, "fmt ");
+        Put32(out, extensible ? 40U : 16U);
+        Put16(out, extensible ? 0xFFFEU : formatTag);
+        Put16(out, channels);
+        Put32(out, sampleRate);
+        Put32(out, sampleRate * blockAlign);
+        Put16(out, blockAlign);
+        Put16(out, bitsPerSample);
+        if (extensible) {
+            Put16(out, 22U);
+            Put16(out, bitsPerSample);
+            Put32(out, 0x3U); // front left | front right
+            Put16(out, formatTag);
+            const std::uint8_t tail[14] = {0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x80U,
+                                           0x00U, 0x00U, 0xAAU, 0x00U, 0x38U, 0x9BU, 0x71U};
+            out.insert(out.end(), tail, tail + 14);
+        }
+
+        if (extraChunkBytes != 0U) {
+            PutTag(out, "LIST");
+            Put32(out, extraChunkBytes);
+            out.insert(out.end(), extraChunkBytes + (extraChunkBytes & 1U), std::uint8_t{0xEEU});
+        }
+
+        PutTag(out, "data");
+        Put32(out, static_cast<std::uint32_t>(samples.size() + dataSizeSlack));
+        out.insert(out.end(), samples.begin(), samples.end());
+
+        const auto riffSize = static_cast<std::uint32_t>(out.size() - 8U);
+        for (std::size_t i = 0U; i < 4U; ++i) {
+            out[4U + i] = static_cast<std::uint8_t>(riffSize >> (8U * i));
+        }
+        return out;
+    }
+};
+
+inline bool WriteBinaryFile(const std::string& path, const std::vector<std::uint8_t>& bytes) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool written = std::fwrite(bytes.data(), 1U, bytes.size(), file) == bytes.size();
+    return std::fclose(file) == 0 && written;
+}
+
+} // namespace AutosarMusicPlayer::Test::Mocks
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <string>
 #include <vector>
 
 #include "Rte_MusicPlayerApp.h"
@@ -13,12 +12,14 @@ public:
         songChanged.push_back(newSongId);
     }
 
-    void NotifyPlaybackStateChanged(const char* stateName) override {
-        playbackStates.emplace_back(stateName != nullptr ? stateName : "");
+    void NotifyPlaybackStateChanged(Rte_PlaybackStateType state, Rte_SequenceCounterType sequence) override {
+        playbackStates.push_back(state);
+        sequences.push_back(sequence);
     }
 
     std::vector<Rte_SongIdType> songChanged;
-    std::vector<std::string> playbackStates;
+    std::vector<Rte_PlaybackStateType> playbackStates;
+    std::vector<Rte_SequenceCounterType> sequences;
 };
 
 } // namespace AutosarMusicPlayer::Test::Mocks
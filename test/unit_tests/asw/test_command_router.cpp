@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "asw_mocks/mock_playlist_observer.hpp"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "command_router.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Hmi::BasicCommandRouter;
+using AutosarMusicPlayer::Asw::Hmi::CommandRouter;
+using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::StaticPlaylist;
+using AutosarMusicPlayer::Common::AppError;
+
+namespace {
+
+struct RouterFixture : ::testing::Test {
+    RouterFixture() {
+        for (AutosarMusicPlayer::Common::SongId id = 1U; id <= 5U; ++id) {
+            EXPECT_EQ(playlist.AddSong({id, "Song " + std::to_string(id), 180U}), AppError::Ok);
+        }
+    }
+
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager{codec, nullptr};
+    Playlist playlist;
+    CommandRouter router{manager, playlist};
+};
+
+} // namespace
+
+TEST_F(RouterFixture, DispatchesCommandsToPlaybackAndPlaylist) {
+    EXPECT_EQ(router.Execute("play"), AppError::Ok);
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Playing);
+    EXPECT_EQ(router.Execute("  pause\t"), AppError::Ok);
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Paused);
+
+    EXPECT_EQ(router.Execute("select 4"), AppError::Ok);
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 4U);
+    EXPECT_EQ(router.Execute("next"), AppError::Ok);
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 5U);
+    EXPECT_EQ(router.Execute("previous"), AppError::Ok);
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 4U);
+
+    EXPECT_EQ(router.Execute("stop"), AppError::Ok);
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Stopped);
+}
+
+TEST_F(RouterFixture, RejectsUnknownCommandsAndBadArguments) {
+    EXPECT_EQ(router.Execute("rewind"), AppError::NotFound);
+    EXPECT_EQ(router.Execute("Play"), AppError::NotFound);
+    EXPECT_EQ(router.Execute(""), AppError::NotFound);
+    EXPECT_EQ(router.Execute("select"), AppError::InvalidArgument);
+    EXPECT_EQ(router.Execute("select 4x"), AppError::InvalidArgument);
+    EXPECT_EQ(router.Execute("select -1"), AppError::InvalidArgument);
+    EXPECT_EQ(router.Execute("select 99999999999"), AppError::InvalidArgument);
+    EXPECT_EQ(router.Execute("play 3"), AppError::InvalidArgument);
+    EXPECT_EQ(router.Execute("select 77"), AppError::NotFound) << "no such song";
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Stopped);
+}
+
+TEST_F(RouterFixture, ScriptRunsAsOnePlaylistTransaction) {
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    const auto result = router.ExecuteScript(
+        "# warm-up\n"
+        "select 2; next\n"
+        "\n"
+        "bogus\n"
+        "next;play\n");
+    EXPECT_EQ(result.executed, 5U);
+    EXPECT_EQ(result.failed, 1U);
+    EXPECT_EQ(result.firstFailedEntry, 5U);
+    EXPECT_EQ(result.firstError, AppError::NotFound);
+
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 4U);
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Playing);
+    ASSERT_EQ(observer.songChanged.size(), 1U);
+    EXPECT_EQ(observer.songChanged.back(), 4U);
+
+    playlist.UnregisterObserver(&observer);
+}
+
+TEST(CommandRouter, DrivesAStaticPlaylist) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager{codec, nullptr};
+    StaticPlaylist playlist;
+    ASSERT_EQ(playlist.AddSong({7U, "Seven", 180U}), AppError::Ok);
+    ASSERT_EQ(playlist.AddSong({8U, "Eight", 180U}), AppError::Ok);
+    BasicCommandRouter<PlaybackManager, StaticPlaylist> router{manager, playlist};
+
+    const auto result = router.ExecuteScript("select 7; next; play");
+    EXPECT_EQ(result.failed, 0U);
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 8U);
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Playing);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bsw_mocks/pcm_test_streams.hpp"
+#include "gapless_pcm_source.hpp"
+#include "gapless_sequencer.hpp"
+#include "pcm_stream_engine.hpp"
+#include "playback_manager.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Playback::GaplessSequencer;
+using AutosarMusicPlayer::Asw::Playback::ITrackOpener;
+using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Bsw::Audio::GaplessPcmSource;
+using AutosarMusicPlayer::Bsw::Audio::IPcmSource;
+using AutosarMusicPlayer::Bsw::Audio::PcmEngineConfig;
+using AutosarMusicPlayer::Bsw::Audio::PcmStreamEngine;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Test::Mocks::CountingPcmSource;
+using AutosarMusicPlayer::Test::Mocks::RecordingPcmSink;
+
+namespace {
+
+constexpr std::uint16_t kChannels = 2U;
+constexpr std::size_t kPeriod = 96U;
+
+/**
+ * @brief Song n is a track of kLengths[n - 1] frames counting up from
+ *        n * 100000, so every sample says which track and frame it is
+ */
+class FakeTrackOpener final : public ITrackOpener {
+public:
+    static constexpr std::uint64_t kLengths[] = {4801U, 3000U, 5003U};
+
+    AppError Open(SongId song, IPcmSource*& source) override {
+        if (song == 0U || song > std::size(kLengths)) {
+            return AppError::NotFound;
+        }
+        auto track = std::make_unique<CountingPcmSource>(kChannels, kLengths[song - 1U], song * 100000U);
+        source = track.get();
+        open[source] = std::move(track);
+        ++opened;
+        return AppError::Ok;
+    }
+
+    void Close(IPcmSource& source) override {
+        EXPECT_EQ(open.erase(&source), 1U) << "closed twice or never opened";
+    }
+
+    static std::vector<float> Expected() {
+        std::vector<float> samples;
+        for (std::size_t song = 1U; song <= std::size(kLengths); ++song) {
+            for (std::uint64_t frame = 0U; frame < kLengths[song - 1U]; ++frame) {
+                samples.push_back(static_cast<float>(song * 100000U + frame));
+            }
+        }
+        return samples;
+    }
+
+    std::map<IPcmSource*, std::unique_ptr<CountingPcmSource>> open;
+    std::size_t opened{0U};
+};
+
+struct GaplessFixture : ::testing::Test {
+    GaplessFixture() {
+        for (SongId id = 1U; id <= 3U; ++id) {
+            EXPECT_EQ(playlist.AddSong({id, "Track " + std::to_string(id), 60U}), AppError::Ok);
+        }
+        EXPECT_EQ(playlist.SetCurrentSong(1U), AppError::Ok);
+    }
+
+    Playlist playlist;
+    FakeTrackOpener opener;
+    GaplessPcmSource stream{kChannels};
+    GaplessSequencer sequencer{playlist, opener, stream};
+};
+
+} // namespace
+
+TEST_F(GaplessFixture, PlaysThePlaylistWithoutInsertedSilence) {
+    ASSERT_EQ(sequencer.Begin(), AppError::Ok);
+    EXPECT_EQ(sequencer.DecodingSong(), 1U);
+    EXPECT_EQ(sequencer.QueuedSong(), 2U);
+
+    // Drive the source the way the engine's decoder thread does, one
+    // period at a time, with the sequencer's cyclic runnable in between.
+    std::vector<float> left;
+    std::vector<float> period(kPeriod * kChannels);
+    std::size_t frames = 0U;
+    while ((frames = stream.Read(period.data(), kPeriod)) != 0U) {
+        for (std::size_t i = 0U; i < frames; ++i) {
+            left.push_back(period[i * kChannels]);
+        }
+        sequencer.MainFunction();
+    }
+
+    EXPECT_EQ(left, FakeTrackOpener::Expected()) << "a gap, repeat or silence at a track boundary";
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 3U);
+    EXPECT_EQ(sequencer.DecodingSong(), 3U);
+    EXPECT_EQ(sequencer.QueuedSong(), 0U) << "repeat is off: nothing after the last song";
+    EXPECT_EQ(opener.open.size(), 1U);
+
+    sequencer.End();
+    EXPECT_TRUE(opener.open.empty());
+    EXPECT_EQ(opener.opened, 3U);
+}
+
+TEST_F(GaplessFixture, EngineRunsThroughTrackChangesWithoutRestart) {
+    RecordingPcmSink sink(kChannels);
+    PcmEngineConfig config;
+    config.framesPerPeriod = kPeriod;
+    PcmStreamEngine engine(stream, sink, config);
+    PlaybackManager manager(engine, nullptr);
+
+    ASSERT_EQ(sequencer.Begin(), AppError::Ok);
+    ASSERT_EQ(manager.Play(), AppError::Ok);
+    const auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!engine.EndOfStream() && std::chrono::steady_clock::now() < giveUp) {
+        sequencer.MainFunction();
+        EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Playing);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(engine.EndOfStream());
+    ASSERT_EQ(manager.Stop(), AppError::Ok);
+
+    // All audio arrives in order; any silence in between is accounted for
+    // by underruns of the real-time sink, none comes from a track change.
+    std::vector<float> audio;
+    std::size_t silence = 0U;
+    for (const float sample : sink.Samples()) {
+        if (sample > 0.0F) {
+            audio.push_back(sample);
+        } else if (!audio.empty()) {
+            ++silence;
+        }
+    }
+    const std::vector<float> expected = FakeTrackOpener::Expected();
+    EXPECT_EQ(audio, expected);
+    const std::size_t padding = (kPeriod - expected.size() % kPeriod) % kPeriod; // end of the last period
+    EXPECT_EQ(silence, engine.Stats().underruns * kPeriod + padding);
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "hmi_view_model.hpp"
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Hmi::BasicHmiViewModel;
+using AutosarMusicPlayer::Asw::Hmi::HmiFrame;
+using AutosarMusicPlayer::Asw::Hmi::HmiViewModel;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::StaticPlaylist;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+constexpr std::size_t kRows = 10U;
+
+class CountingDisplay final : public AutosarMusicPlayer::Asw::Hmi::IHmiDisplay {
+public:
+    void OnFrame(const HmiFrame& frame) override {
+        ++frames;
+        rows += frame.rows.size();
+        lastRows.clear();
+        for (const auto& row : frame.rows) {
+            lastRows.push_back(row.position);
+        }
+        lastSize = frame.playlistSize;
+        lastState = frame.playbackState;
+        lastCurrent = frame.currentPosition;
+    }
+
+    std::size_t frames{0U};
+    std::size_t rows{0U};
+    std::vector<std::size_t> lastRows;
+    std::size_t lastSize{0U};
+    Rte_PlaybackStateType lastState{Rte_PlaybackStateType::Stopped};
+    std::optional<std::size_t> lastCurrent;
+};
+
+class DisplayedSongObserver final : public AutosarMusicPlayer::Asw::Hmi::IHmiObserver {
+public:
+    void OnDisplayedSongChanged(SongId id) override {
+        ids.push_back(id);
+    }
+
+    std::vector<SongId> ids;
+};
+
+std::vector<SongInfo> MakeSongs(SongId firstId, std::size_t count) {
+    std::vector<SongInfo> songs;
+    for (std::size_t i = 0U; i < count; ++i) {
+        songs.push_back(SongInfo{firstId + static_cast<SongId>(i), "Song " + std::to_string(i), 180U});
+    }
+    return songs;
+}
+
+} // namespace
+
+TEST(HmiViewModel, FirstTickDrawsTheWindowThenIdleTicksEmitNothing) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 100U)), AppError::Ok);
+    CountingDisplay display;
+    HmiViewModel model(playlist, display, kRows);
+
+    EXPECT_TRUE(model.Tick());
+    EXPECT_EQ(display.frames, 1U);
+    EXPECT_EQ(display.rows, kRows);
+    EXPECT_EQ(display.lastSize, 100U);
+
+    EXPECT_FALSE(model.Tick());
+    EXPECT_FALSE(model.Tick());
+    EXPECT_EQ(display.frames, 1U);
+}
+
+TEST(HmiViewModel, UpdateStormIsOneFrameWithOnlyTheChangedVisibleRows) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 500U)), AppError::Ok);
+    CountingDisplay display;
+    HmiViewModel model(playlist, display, kRows);
+    model.ScrollTo(100U);
+    (void)model.Tick();
+    const std::size_t framesBefore = display.frames;
+    const std::size_t rowsBefore = display.rows;
+
+    // 1000 updates in one tick: rows 103 and 107 of the window, the rest
+    // off-screen.
+    const std::vector<SongInfo> renamed{SongInfo{104U, "Renamed", 200U}};
+    const std::vector<SongInfo> offscreen{SongInfo{1U, "Off", 200U}};
+    for (int i = 0; i < 1000; ++i) {
+        const bool visible = i % 100 == 0;
+        ASSERT_EQ(playlist.UpdateSongs(visible ? 103U : 0U, visible ? renamed : offscreen), AppError::Ok);
+    }
+    ASSERT_EQ(playlist.UpdateSongs(107U, std::vector<SongInfo>{SongInfo{108U, "Also", 1U}}), AppError::Ok);
+
+    EXPECT_TRUE(model.Tick());
+    EXPECT_EQ(display.frames - framesBefore, 1U);
+    EXPECT_EQ(display.rows - rowsBefore, 2U);
+    EXPECT_EQ(display.lastRows, (std::vector<std::size_t>{103U, 107U}));
+    EXPECT_GE(model.EventsReceived(), 1001U);
+
+    // Off-screen only: no frame at all.
+    ASSERT_EQ(playlist.UpdateSongs(0U, offscreen), AppError::Ok);
+    EXPECT_FALSE(model.Tick());
+}
+
+TEST(HmiViewModel, InsertAboveTheWindowRedrawsItOnce) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 50U)), AppError::Ok);
+    CountingDisplay display;
+    HmiViewModel model(playlist, display, kRows);
+    model.ScrollTo(20U);
+    (void)model.Tick();
+    const std::size_t rowsBefore = display.rows;
+
+    for (SongId id = 1000U; id < 2000U; ++id) {
+        ASSERT_EQ(playlist.InsertSongs(0U, std::vector<SongInfo>{SongInfo{id, "New", 1U}}), AppError::Ok);
+    }
+
+    EXPECT_TRUE(model.Tick());
+    EXPECT_EQ(display.rows - rowsBefore, kRows);
+    EXPECT_EQ(display.lastSize, 1050U);
+}
+
+TEST(HmiViewModel, RemovalBlanksRowsPastTheEnd) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 12U)), AppError::Ok);
+    CountingDisplay display;
+    HmiViewModel model(playlist, display, kRows);
+    (void)model.Tick();
+
+    ASSERT_EQ(playlist.RemoveRange(5U, 7U), AppError::Ok);
+    EXPECT_TRUE(model.Tick());
+    EXPECT_EQ(display.lastRows, (std::vector<std::size_t>{5U, 6U, 7U, 8U, 9U}));
+    EXPECT_EQ(display.lastSize, 5U);
+}
+
+TEST(HmiViewModel, SongChangeStormIsOneDisplayedSongChange) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 100U)), AppError::Ok);
+    CountingDisplay display;
+    DisplayedSongObserver observer;
+    HmiViewModel model(playlist, display, kRows);
+    ASSERT_EQ(model.RegisterObserver(&observer), AppError::Ok);
+    (void)model.Tick();
+    ASSERT_EQ(observer.ids, (std::vector<SongId>{1U}));
+    const std::size_t framesBefore = display.frames;
+    const std::size_t rowsBefore = display.rows;
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(playlist.SetCurrentSong(static_cast<SongId>(1 + (i % 100))), AppError::Ok);
+        model.SetPlaybackState(i % 2 == 0 ? Rte_PlaybackStateType::Playing : Rte_PlaybackStateType::Paused);
+    }
+    ASSERT_EQ(playlist.SetCurrentSong(4U), AppError::Ok);
+    model.SetPlaybackState(Rte_PlaybackStateType::Playing);
+
+    EXPECT_TRUE(model.Tick());
+    EXPECT_EQ(display.frames - framesBefore, 1U);
+    // The old and the new highlighted row.
+    EXPECT_EQ(display.rows - rowsBefore, 2U);
+    EXPECT_EQ(display.lastRows, (std::vector<std::size_t>{0U, 3U}));
+    EXPECT_EQ(display.lastCurrent, std::optional<std::size_t>(3U));
+    EXPECT_EQ(display.lastState, Rte_PlaybackStateType::Playing);
+    EXPECT_EQ(observer.ids, (std::vector<SongId>{1U, 4U}));
+}
+
+TEST(HmiViewModel, DrivesAStaticPlaylist) {
+    StaticPlaylist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 50U)), AppError::Ok);
+    CountingDisplay display;
+    BasicHmiViewModel<StaticPlaylist> model(playlist, display, kRows);
+    ASSERT_TRUE(model.IsAttached());
+    (void)model.Tick();
+
+    ASSERT_EQ(playlist.RemoveRange(2U, 3U), AppError::Ok);
+    EXPECT_TRUE(model.Tick());
+    EXPECT_EQ(display.lastSize, 47U);
+    EXPECT_EQ(display.lastRows, (std::vector<std::size_t>{2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U}));
+}
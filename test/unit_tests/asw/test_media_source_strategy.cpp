@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "asw_mocks/mock_playlist_observer.hpp"
 #include "media_source_strategy.hpp"
 #include "playlist.hpp"
 #include "strategies/usb_source.hpp"
@@ -8,8 +15,10 @@
 using AutosarMusicPlayer::Asw::MediaSource::MediaSourceHandler;
 using AutosarMusicPlayer::Asw::MediaSource::UsbSource;
 using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::StaticPlaylist;
 using AutosarMusicPlayer::Bsw::Cdd::UsbMassStorage;
 using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongInfo;
 
 TEST(MediaSource, UsbStrategyLoadsPlaylist) {
     UsbMassStorage storage;
@@ -21,3 +30,229 @@ TEST(MediaSource, UsbStrategyLoadsPlaylist) {
     EXPECT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
     EXPECT_GT(playlist.Size(), 0u);
 }
+
+namespace {
+
+class LargeLibrarySource final : public AutosarMusicPlayer::Asw::MediaSource::IMediaSourceStrategy {
+public:
+    explicit LargeLibrarySource(std::uint32_t trackCount) : trackCount_(trackCount) {}
+
+    const char* Name() const override { return "Large"; }
+    AppError Activate() override { return AppError::Ok; }
+    AppError Deactivate() override { return AppError::Ok; }
+
+    AppError GetAvailableTracks(AutosarMusicPlayer::Common::TrackList& outTracks) override {
+        outTracks.Clear();
+        for (std::uint32_t id = 1U; id <= trackCount_; ++id) {
+            outTracks.Add(id, "Track", 180U);
+        }
+        return AppError::Ok;
+    }
+
+private:
+    std::uint32_t trackCount_;
+};
+
+} // namespace
+
+TEST(MediaSource, RefreshPlaylistNotifiesObserversOnce) {
+    Playlist playlist(5000U);
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    MediaSourceHandler handler;
+    handler.SetStrategy(std::make_unique<LargeLibrarySource>(3000U));
+
+    EXPECT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+    EXPECT_EQ(playlist.Size(), 3000u);
+    EXPECT_EQ(observer.playlistChangedCalls, 1u);
+    EXPECT_EQ(observer.songChanged.size(), 1u);
+}
+
+namespace {
+
+class ScriptedSource final : public AutosarMusicPlayer::Asw::MediaSource::IMediaSourceStrategy {
+public:
+    const char* Name() const override { return "Scripted"; }
+    AppError Activate() override { return AppError::Ok; }
+    AppError Deactivate() override { return AppError::Ok; }
+
+    AppError GetAvailableTracks(AutosarMusicPlayer::Common::TrackList& outTracks) override {
+        outTracks.Clear();
+        for (const auto& track : tracks) {
+            outTracks.Add(track.id, track.title, track.durationSeconds);
+        }
+        return AppError::Ok;
+    }
+
+    std::vector<SongInfo> tracks;
+};
+
+// Mirrors the playlist purely from range events, the way an incremental view would.
+class MirrorObserver final : public AutosarMusicPlayer::Asw::Playlist::IPlaylistObserver {
+public:
+    explicit MirrorObserver(const Playlist& playlist) : playlist_(playlist) {}
+
+    void OnPlaylistChanged() override {}
+    void OnSongChanged(AutosarMusicPlayer::Common::SongId) override {}
+
+    void OnSongsInserted(std::size_t first, std::size_t count) override {
+        for (std::size_t i = 0U; i < count; ++i) {
+            const auto song = playlist_.At(first + i);
+            rows.insert(rows.begin() + static_cast<std::ptrdiff_t>(first + i),
+                        SongInfo{song->id, std::string(song->title), song->durationSeconds});
+        }
+    }
+
+    void OnSongsRemoved(std::size_t first, std::size_t count) override {
+        const auto begin = rows.begin() + static_cast<std::ptrdiff_t>(first);
+        rows.erase(begin, begin + static_cast<std::ptrdiff_t>(count));
+    }
+
+    void OnSongsUpdated(std::size_t first, std::size_t count) override {
+        for (std::size_t i = first; i < first + count; ++i) {
+            rows[i].title = std::string(playlist_.At(i)->title);
+        }
+    }
+
+    std::vector<SongInfo> rows;
+
+private:
+    const Playlist& playlist_;
+};
+
+std::vector<AutosarMusicPlayer::Common::SongId> Ids(const std::vector<SongInfo>& songs) {
+    std::vector<AutosarMusicPlayer::Common::SongId> ids;
+    for (const auto& song : songs) {
+        ids.push_back(song.id);
+    }
+    return ids;
+}
+
+} // namespace
+
+namespace {
+
+template <typename PlaylistT>
+class MediaSourceRefreshTest : public ::testing::Test {};
+
+using PlaylistTypes = ::testing::Types<Playlist, StaticPlaylist>;
+TYPED_TEST_SUITE(MediaSourceRefreshTest, PlaylistTypes);
+
+} // namespace
+
+TYPED_TEST(MediaSourceRefreshTest, AppliesIncrementalDiff) {
+    TypeParam playlist;
+    auto source = std::make_unique<ScriptedSource>();
+    ScriptedSource& scripted = *source;
+    scripted.tracks = {{1U, "A", 1U}, {2U, "B", 1U}, {3U, "C", 1U}, {4U, "D", 1U}, {5U, "E", 1U}};
+
+    MediaSourceHandler handler;
+    handler.SetStrategy(std::move(source));
+    ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+    ASSERT_EQ(playlist.SetCurrentSong(4U), AppError::Ok);
+
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    // Drop 2, insert 9 after 3, retitle 5.
+    scripted.tracks = {{1U, "A", 1U}, {3U, "C", 1U}, {9U, "New", 1U}, {4U, "D", 1U}, {5U, "E2", 1U}};
+    ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+
+    ASSERT_EQ(observer.removed.size(), 1u);
+    EXPECT_EQ(observer.removed[0].first, 1u);
+    EXPECT_EQ(observer.removed[0].count, 1u);
+    ASSERT_EQ(observer.inserted.size(), 1u);
+    EXPECT_EQ(observer.inserted[0].first, 2u);
+    EXPECT_EQ(observer.inserted[0].count, 1u);
+    ASSERT_EQ(observer.updated.size(), 1u);
+    EXPECT_EQ(observer.updated[0].first, 4u);
+    EXPECT_EQ(observer.playlistChangedCalls, 1u);
+
+    // Current song still exists, so it is kept and no song change is reported.
+    EXPECT_TRUE(observer.songChanged.empty());
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 4U);
+    EXPECT_EQ(playlist.At(4U)->title, "E2");
+
+    // An unchanged rescan produces no events at all.
+    observer = AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver{};
+    ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+    EXPECT_TRUE(observer.inserted.empty());
+    EXPECT_TRUE(observer.removed.empty());
+    EXPECT_TRUE(observer.updated.empty());
+    EXPECT_EQ(observer.playlistChangedCalls, 0u);
+}
+
+TEST(MediaSource, UnchangedRescanOfTruncatedTitlesIsSilent) {
+    StaticPlaylist playlist;
+    auto source = std::make_unique<ScriptedSource>();
+    ScriptedSource& scripted = *source;
+    for (AutosarMusicPlayer::Common::SongId id = 1U; id <= 10U; ++id) {
+        scripted.tracks.push_back(SongInfo{id, std::string(100U, 'a') + std::to_string(id), 1U});
+    }
+
+    MediaSourceHandler handler;
+    handler.SetStrategy(std::move(source));
+    ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+    ASSERT_EQ(playlist.At(0U)->title.size(), AutosarMusicPlayer::Common::kMaxTitleLength);
+
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+    ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+    ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+    EXPECT_TRUE(observer.inserted.empty());
+    EXPECT_TRUE(observer.removed.empty());
+    EXPECT_TRUE(observer.updated.empty());
+    EXPECT_EQ(observer.playlistChangedCalls, 0u);
+}
+
+TEST(MediaSource, RefreshRangeEventsReproducePlaylist) {
+    Playlist playlist(500U);
+    MirrorObserver mirror(playlist);
+    ASSERT_EQ(playlist.RegisterObserver(&mirror), AppError::Ok);
+
+    auto source = std::make_unique<ScriptedSource>();
+    ScriptedSource& scripted = *source;
+    MediaSourceHandler handler;
+    handler.SetStrategy(std::move(source));
+
+    std::uint32_t rng = 12345U;
+    const auto next = [&rng](std::uint32_t bound) {
+        rng = rng * 1103515245U + 12345U;
+        return (rng >> 8U) % bound;
+    };
+
+    for (int round = 0; round < 50; ++round) {
+        // Random subset of ids 1..120 in a partially shuffled order with random titles.
+        std::vector<SongInfo> tracks;
+        for (std::uint32_t id = 1U; id <= 120U; ++id) {
+            if (next(3U) != 0U) {
+                tracks.push_back(SongInfo{id, "t" + std::to_string(next(4U)), 1U});
+            }
+        }
+        for (std::size_t swaps = next(6U); swaps > 0U && tracks.size() > 1U; --swaps) {
+            std::swap(tracks[next(static_cast<std::uint32_t>(tracks.size()))],
+                      tracks[next(static_cast<std::uint32_t>(tracks.size()))]);
+        }
+        scripted.tracks = tracks;
+
+        ASSERT_EQ(handler.RefreshPlaylist(playlist), AppError::Ok);
+        ASSERT_EQ(playlist.Size(), tracks.size());
+        ASSERT_EQ(Ids(mirror.rows), Ids(tracks));
+        for (std::size_t i = 0U; i < tracks.size(); ++i) {
+            ASSERT_EQ(playlist.At(i)->title, tracks[i].title);
+            ASSERT_EQ(mirror.rows[i].title, tracks[i].title);
+        }
+    }
+}
+
+TEST(MediaSource, RefreshRejectsDuplicateSourceIds) {
+    Playlist playlist;
+    auto source = std::make_unique<ScriptedSource>();
+    source->tracks = {{1U, "A", 1U}, {1U, "A", 1U}};
+    MediaSourceHandler handler;
+    handler.SetStrategy(std::move(source));
+
+    EXPECT_EQ(handler.RefreshPlaylist(playlist), AppError::InvalidArgument);
+    EXPECT_EQ(playlist.Size(), 0u);
+}
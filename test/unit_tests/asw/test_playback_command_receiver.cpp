@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "Com_Cfg.h"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "com_rx.hpp"
+#include "playback_command_receiver.hpp"
+
+using AutosarMusicPlayer::Asw::Playback::PlaybackCommandReceiver;
+using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
+using AutosarMusicPlayer::Bsw::Com::ComRx;
+using AutosarMusicPlayer::Bsw::Hal::CanFrame;
+namespace Com_Cfg = AutosarMusicPlayer::Com_Cfg;
+
+namespace {
+
+CanFrame Button(Com_Cfg::SteeringWheelButton button) {
+    CanFrame frame;
+    frame.id = 0x1A0U;
+    frame.dlc = 1U;
+    frame.data[0] = static_cast<std::uint8_t>(button);
+    return frame;
+}
+
+CanFrame Ignition(bool on) {
+    CanFrame frame;
+    frame.id = 0x0C0U;
+    frame.dlc = 1U;
+    frame.data[0] = on ? 1U : 0U;
+    return frame;
+}
+
+} // namespace
+
+TEST(PlaybackCommandReceiver, ButtonPressesDriveThePlaybackManager) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager(codec, nullptr);
+    PlaybackCommandReceiver receiver(manager);
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, receiver);
+
+    // Held for three frames: one command.
+    for (int i = 0; i < 3; ++i) {
+        rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::Play));
+    }
+    (void)rx.MainFunctionRx();
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Playing);
+    EXPECT_EQ(codec.startCalls, 1U);
+
+    rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::None));
+    rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::Pause));
+    (void)rx.MainFunctionRx();
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Paused);
+
+    rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::Stop));
+    (void)rx.MainFunctionRx();
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Stopped);
+
+    // Released and pressed again: a new command, which Stopped rejects.
+    rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::None));
+    rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::Pause));
+    (void)rx.MainFunctionRx();
+    EXPECT_EQ(receiver.CommandsIssued(), 4U);
+    EXPECT_EQ(receiver.CommandsRejected(), 1U);
+}
+
+TEST(PlaybackCommandReceiver, IgnitionOffStopsPlayback) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    PlaybackManager manager(codec, nullptr);
+    PlaybackCommandReceiver receiver(manager);
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, receiver);
+
+    rx.RxIndication(Ignition(false));
+    rx.RxIndication(Ignition(true));
+    rx.RxIndication(Button(Com_Cfg::SteeringWheelButton::Play));
+    (void)rx.MainFunctionRx();
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Playing);
+
+    rx.RxIndication(Ignition(true));
+    rx.RxIndication(Ignition(false));
+    (void)rx.MainFunctionRx();
+    EXPECT_EQ(manager.State(), Rte_PlaybackStateType::Stopped);
+    EXPECT_EQ(receiver.CommandsIssued(), 2U);
+}
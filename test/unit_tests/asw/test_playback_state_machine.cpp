@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "playback_manager.hpp"
 #include "bsw_mocks/mock_audio_codec.hpp"
 #include "rte_mocks/mock_rte_musicplayer.hpp"
 
+using AutosarMusicPlayer::Asw::Playback::BasicPlaybackManager;
 using AutosarMusicPlayer::Asw::Playback::PlaybackManager;
 using AutosarMusicPlayer::Common::AppError;
 
@@ -26,7 +29,8 @@ TEST(PlaybackStateMachine, StartsFromStoppedAndTransitions) {
     EXPECT_STREQ(mgr.StateName(), "Stopped");
     EXPECT_EQ(codec.stopCalls, 1u);
 
-    ASSERT_FALSE(rte.playbackStates.empty());
+    ASSERT_EQ(rte.playbackStates.size(), 4U);
+    EXPECT_EQ(rte.playbackStates.back(), Rte_PlaybackStateType::Stopped);
 }
 
 TEST(PlaybackStateMachine, PauseFromStoppedIsInvalid) {
@@ -36,3 +40,49 @@ TEST(PlaybackStateMachine, PauseFromStoppedIsInvalid) {
     EXPECT_EQ(mgr.Pause(), AppError::InvalidArgument);
     EXPECT_STREQ(mgr.StateName(), "Stopped");
 }
+
+TEST(PlaybackStateMachine, NotifiesRteOnlyOnTransitions) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    AutosarMusicPlayer::Test::Mocks::MockRteMusicPlayerApp rte;
+    PlaybackManager mgr(codec, &rte);
+
+    EXPECT_EQ(mgr.Play(), AppError::Ok);
+    EXPECT_EQ(mgr.Play(), AppError::Ok);
+    EXPECT_EQ(mgr.Pause(), AppError::Ok);
+    EXPECT_EQ(mgr.Pause(), AppError::Ok);
+
+    // A failing codec call keeps the state and sends nothing.
+    codec.stopResult = AppError::IoError;
+    EXPECT_EQ(mgr.Stop(), AppError::IoError);
+    EXPECT_EQ(mgr.State(), Rte_PlaybackStateType::Paused);
+
+    codec.stopResult = AppError::Ok;
+    EXPECT_EQ(mgr.Stop(), AppError::Ok);
+    EXPECT_EQ(mgr.Stop(), AppError::Ok);
+    EXPECT_EQ(mgr.Pause(), AppError::InvalidArgument);
+
+    const std::vector<Rte_PlaybackStateType> expectedStates{
+        Rte_PlaybackStateType::Stopped, Rte_PlaybackStateType::Playing, Rte_PlaybackStateType::Paused,
+        Rte_PlaybackStateType::Stopped};
+    EXPECT_EQ(rte.playbackStates, expectedStates);
+    EXPECT_EQ(rte.sequences, (std::vector<Rte_SequenceCounterType>{0U, 1U, 2U, 3U}));
+    EXPECT_STREQ(Rte_PlaybackStateName(rte.playbackStates.back()), "Stopped");
+}
+
+TEST(PlaybackStateMachine, StaticRteBindingSendsTheSameNotifications) {
+    using Rte = AutosarMusicPlayer::Test::Mocks::MockRteMusicPlayerApp;
+    using StaticPort = AutosarMusicPlayer::Rte::StaticRtePort<Rte>;
+
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    Rte rte;
+    BasicPlaybackManager<StaticPort> mgr(codec, StaticPort(rte));
+
+    EXPECT_EQ(mgr.Play(), AppError::Ok);
+    EXPECT_EQ(mgr.Play(), AppError::Ok);
+    EXPECT_EQ(mgr.Stop(), AppError::Ok);
+
+    const std::vector<Rte_PlaybackStateType> expectedStates{
+        Rte_PlaybackStateType::Stopped, Rte_PlaybackStateType::Playing, Rte_PlaybackStateType::Stopped};
+    EXPECT_EQ(rte.playbackStates, expectedStates);
+    EXPECT_EQ(rte.sequences, (std::vector<Rte_SequenceCounterType>{0U, 1U, 2U}));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "asw_mocks/mock_playlist_observer.hpp"
+#include "hmi_controller.hpp"
+#include "playlist.hpp"
+#include "playlist_event_dispatcher.hpp"
+#include "rte_mocks/mock_rte_musicplayer.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::IPlaylistObserver;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistEventDispatcher;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+using AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver;
+
+TEST(PlaylistEventDispatcher, CoalescesUntilPumped) {
+    Playlist playlist;
+    PlaylistEventDispatcher dispatcher;
+    MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&dispatcher), AppError::Ok);
+    ASSERT_EQ(dispatcher.RegisterObserver(&observer), AppError::Ok);
+
+    for (SongId id = 1U; id <= 100U; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, "T", 1U}), AppError::Ok);
+    }
+    ASSERT_EQ(playlist.SetCurrentSong(50U), AppError::Ok);
+    ASSERT_EQ(playlist.SetCurrentSong(70U), AppError::Ok);
+    EXPECT_EQ(observer.playlistChangedCalls, 0U);
+    EXPECT_TRUE(observer.songChanged.empty());
+
+    EXPECT_EQ(dispatcher.Pump(), 2U);
+    EXPECT_EQ(observer.playlistChangedCalls, 1U);
+    ASSERT_EQ(observer.songChanged.size(), 1U);
+    EXPECT_EQ(observer.songChanged.front(), 70U);
+    EXPECT_EQ(dispatcher.Posted(), 103U);
+    EXPECT_EQ(dispatcher.Coalesced(), 101U);
+
+    // Range events are not deferred, and nothing is left to deliver.
+    EXPECT_TRUE(observer.inserted.empty());
+    EXPECT_EQ(dispatcher.Pump(), 0U);
+
+    ASSERT_EQ(playlist.Next(), AppError::Ok);
+    EXPECT_EQ(dispatcher.Pump(), 1U);
+    EXPECT_EQ(observer.songChanged.back(), 71U);
+}
+
+TEST(PlaylistEventDispatcher, HmiControllerIsNotifiedOnPump) {
+    Playlist playlist;
+    PlaylistEventDispatcher dispatcher;
+    ASSERT_EQ(playlist.RegisterObserver(&dispatcher), AppError::Ok);
+    AutosarMusicPlayer::Test::Mocks::MockRteMusicPlayerApp rte;
+    AutosarMusicPlayer::Asw::Hmi::HmiController hmi(dispatcher, &rte);
+    ASSERT_TRUE(hmi.IsAttached());
+
+    ASSERT_EQ(playlist.AddSongs({SongInfo{1U, "A", 1U}, SongInfo{2U, "B", 1U}}), AppError::Ok);
+    ASSERT_EQ(playlist.SetCurrentSong(2U), AppError::Ok);
+    EXPECT_TRUE(rte.songChanged.empty());
+
+    (void)dispatcher.Pump();
+    ASSERT_EQ(rte.songChanged.size(), 1U);
+    EXPECT_EQ(rte.songChanged.back(), 2U);
+}
+
+namespace {
+
+class CountingObserver final : public IPlaylistObserver {
+public:
+    void OnPlaylistChanged() override {
+        ++playlistChanged;
+    }
+    void OnSongChanged(SongId newSongId) override {
+        lastSong.store(newSongId);
+    }
+
+    std::atomic<int> playlistChanged{0};
+    std::atomic<SongId> lastSong{0U};
+};
+
+} // namespace
+
+TEST(PlaylistEventDispatcher, ConsumerThreadDeliversLatestState) {
+    Playlist playlist;
+    PlaylistEventDispatcher dispatcher;
+    CountingObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&dispatcher), AppError::Ok);
+    ASSERT_EQ(dispatcher.RegisterObserver(&observer), AppError::Ok);
+    ASSERT_EQ(dispatcher.Start(), AppError::Ok);
+    EXPECT_EQ(dispatcher.Start(), AppError::Busy);
+
+    for (SongId id = 1U; id <= 1000U; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, "T", 1U}), AppError::Ok);
+        ASSERT_EQ(playlist.SetCurrentSong(id), AppError::Ok);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (observer.lastSong.load() != 1000U && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    dispatcher.Stop();
+
+    EXPECT_EQ(observer.lastSong.load(), 1000U);
+    EXPECT_GE(observer.playlistChanged.load(), 1);
+    EXPECT_LE(observer.playlistChanged.load(), 1000);
+}
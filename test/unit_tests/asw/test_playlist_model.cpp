@@ -1,20 +1,43 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "asw_mocks/mock_playlist_observer.hpp"
 #include "hmi_controller.hpp"
 #include "playlist.hpp"
+#include "song_index.hpp"
 #include "rte_mocks/mock_rte_musicplayer.hpp"
 
 using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::StaticPlaylist;
 using AutosarMusicPlayer::Common::AppError;
 using AutosarMusicPlayer::Common::SongInfo;
 
+namespace {
+
+// Both capacity variants run the shared behaviour tests; only the real
+// differences (inline storage, truncation, observer bound, arena) have
+// per-policy tests below.
+template <typename PlaylistT>
+class PlaylistModelTest : public ::testing::Test {};
+
+using PlaylistTypes = ::testing::Types<Playlist, StaticPlaylist>;
+TYPED_TEST_SUITE(PlaylistModelTest, PlaylistTypes);
+
+} // namespace
+
 TEST(PlaylistModel, AddSongSetsCurrentAndNotifiesRteViaHmi) {
     Playlist playlist;
     AutosarMusicPlayer::Test::Mocks::MockRteMusicPlayerApp rte;
     AutosarMusicPlayer::Asw::Hmi::HmiController hmi(playlist, &rte);
+    ASSERT_TRUE(hmi.IsAttached());
 
     EXPECT_EQ(playlist.AddSong(SongInfo{10U, "A", 100U}), AppError::Ok);
-    ASSERT_NE(playlist.GetCurrentSong(), nullptr);
+    ASSERT_TRUE(playlist.GetCurrentSong().has_value());
     EXPECT_EQ(playlist.GetCurrentSong()->id, 10U);
 
     // HMI should forward song change to RTE.
@@ -22,7 +45,351 @@ TEST(PlaylistModel, AddSongSetsCurrentAndNotifiesRteViaHmi) {
     EXPECT_EQ(rte.songChanged.back(), 10U);
 }
 
-TEST(PlaylistModel, SetCurrentSongNotFound) {
+TEST(PlaylistModel, HmiWithStaticRteBindingForwardsSongChanges) {
+    using Rte = AutosarMusicPlayer::Test::Mocks::MockRteMusicPlayerApp;
+    using StaticPort = AutosarMusicPlayer::Rte::StaticRtePort<Rte>;
+
+    Playlist playlist;
+    Rte rte;
+    AutosarMusicPlayer::Asw::Hmi::BasicHmiController<StaticPort> hmi(playlist, StaticPort(rte));
+    ASSERT_TRUE(hmi.IsAttached());
+
+    EXPECT_EQ(playlist.AddSong(SongInfo{10U, "A", 100U}), AppError::Ok);
+    EXPECT_EQ(playlist.AddSong(SongInfo{11U, "B", 100U}), AppError::Ok);
+    EXPECT_EQ(playlist.SetCurrentSong(11U), AppError::Ok);
+    EXPECT_EQ(rte.songChanged, (std::vector<Rte_SongIdType>{10U, 11U}));
+}
+
+TEST(PlaylistModel, HmiReportsFullObserverTable) {
     Playlist playlist;
+    std::vector<AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver> observers(
+        Playlist::StoragePolicy::kMaxObservers);
+    for (auto& observer : observers) {
+        ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+    }
+
+    AutosarMusicPlayer::Test::Mocks::MockRteMusicPlayerApp rte;
+    const AutosarMusicPlayer::Asw::Hmi::HmiController hmi(playlist, &rte);
+    EXPECT_FALSE(hmi.IsAttached());
+}
+
+TYPED_TEST(PlaylistModelTest, SetCurrentSongNotFound) {
+    TypeParam playlist;
     EXPECT_EQ(playlist.SetCurrentSong(123U), AppError::NotFound);
 }
+
+TYPED_TEST(PlaylistModelTest, DuplicateAndZeroIdsAreRejected) {
+    TypeParam playlist;
+    EXPECT_EQ(playlist.AddSong(SongInfo{1U, "A", 1U}), AppError::Ok);
+    EXPECT_EQ(playlist.AddSong(SongInfo{1U, "A again", 1U}), AppError::InvalidArgument);
+    EXPECT_EQ(playlist.AddSong(SongInfo{0U, "Zero", 1U}), AppError::InvalidArgument);
+    EXPECT_EQ(playlist.Size(), 1u);
+}
+
+TYPED_TEST(PlaylistModelTest, CapacityIsEnforced) {
+    TypeParam playlist(2U);
+    EXPECT_EQ(playlist.AddSong(SongInfo{1U, "A", 1U}), AppError::Ok);
+    EXPECT_EQ(playlist.AddSong(SongInfo{2U, "B", 1U}), AppError::Ok);
+    EXPECT_EQ(playlist.AddSong(SongInfo{3U, "C", 1U}), AppError::Busy);
+}
+
+TYPED_TEST(PlaylistModelTest, IndexStaysInSyncAfterRemovals) {
+    TypeParam playlist;
+    for (AutosarMusicPlayer::Common::SongId id = 1U; id <= 50U; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id * 7U, "T", id}), AppError::Ok);
+    }
+
+    ASSERT_EQ(playlist.SetCurrentSong(40U * 7U), AppError::Ok);
+    EXPECT_EQ(playlist.RemoveSong(3U * 7U), AppError::Ok);
+    EXPECT_EQ(playlist.RemoveSong(3U * 7U), AppError::NotFound);
+
+    // Current song survives removal of an earlier entry.
+    ASSERT_TRUE(playlist.GetCurrentSong().has_value());
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 40U * 7U);
+    EXPECT_EQ(playlist.GetCurrentSong()->durationSeconds, 40U);
+
+    EXPECT_FALSE(playlist.Contains(3U * 7U));
+    for (AutosarMusicPlayer::Common::SongId id = 4U; id <= 50U; ++id) {
+        ASSERT_EQ(playlist.SetCurrentSong(id * 7U), AppError::Ok);
+        EXPECT_EQ(playlist.GetCurrentSong()->durationSeconds, id);
+    }
+}
+
+TYPED_TEST(PlaylistModelTest, RemovingCurrentFallsBackToFirstSong) {
+    TypeParam playlist;
+    EXPECT_EQ(playlist.AddSong(SongInfo{1U, "A", 1U}), AppError::Ok);
+    EXPECT_EQ(playlist.AddSong(SongInfo{2U, "B", 1U}), AppError::Ok);
+    ASSERT_EQ(playlist.SetCurrentSong(2U), AppError::Ok);
+
+    EXPECT_EQ(playlist.RemoveSong(2U), AppError::Ok);
+    ASSERT_TRUE(playlist.GetCurrentSong().has_value());
+    EXPECT_EQ(playlist.GetCurrentSong()->id, 1U);
+
+    EXPECT_EQ(playlist.RemoveSong(1U), AppError::Ok);
+    EXPECT_FALSE(playlist.GetCurrentSong().has_value());
+}
+
+TYPED_TEST(PlaylistModelTest, PositionsStayConsistentAcrossRemovals) {
+    using AutosarMusicPlayer::Common::SongId;
+    TypeParam playlist;
+    std::vector<SongId> expected;
+    for (SongId id = 1U; id <= 150U; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, "T", id}), AppError::Ok);
+        expected.push_back(id);
+    }
+
+    std::uint32_t rng = 777U;
+    const auto next = [&rng](std::size_t bound) {
+        rng = rng * 1103515245U + 12345U;
+        return (rng >> 8U) % bound;
+    };
+
+    // Removals leave tombstones (ranges leave runs of them); inserts in the
+    // middle and the compaction threshold clear them again.
+    playlist.SetRepeatMode(AutosarMusicPlayer::Asw::Playlist::RepeatMode::All);
+    SongId nextId = 1000U;
+    for (int round = 0; round < 400; ++round) {
+        const std::size_t op = next(6U);
+        if (op == 0U || expected.empty()) {
+            const std::size_t pos = next(expected.size() + 1U);
+            ASSERT_EQ(playlist.InsertSongs(pos, {SongInfo{nextId, "N", 1U}}), AppError::Ok);
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(pos), nextId++);
+        } else if (op == 1U) {
+            const std::size_t pos = next(expected.size());
+            const std::size_t count = std::min<std::size_t>(1U + next(4U), expected.size() - pos);
+            ASSERT_EQ(playlist.RemoveRange(pos, count), AppError::Ok);
+            const auto first = expected.begin() + static_cast<std::ptrdiff_t>(pos);
+            expected.erase(first, first + static_cast<std::ptrdiff_t>(count));
+        } else {
+            const std::size_t pos = next(expected.size());
+            ASSERT_EQ(playlist.RemoveSong(expected[pos]), AppError::Ok);
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+
+        ASSERT_EQ(playlist.Size(), expected.size());
+        if (!expected.empty()) {
+            const std::size_t probe = next(expected.size());
+            ASSERT_EQ(playlist.At(probe)->id, expected[probe]);
+            ASSERT_EQ(playlist.SetCurrentSong(expected[probe]), AppError::Ok);
+            ASSERT_EQ(playlist.CurrentPosition(), probe);
+
+            // Stepping skips the tombstones in O(1) and wraps at both ends.
+            ASSERT_EQ(playlist.Next(), AppError::Ok);
+            ASSERT_EQ(playlist.GetCurrentSong()->id, expected[(probe + 1U) % expected.size()]);
+            ASSERT_EQ(playlist.Previous(), AppError::Ok);
+            ASSERT_EQ(playlist.Previous(), AppError::Ok);
+            ASSERT_EQ(playlist.GetCurrentSong()->id, expected[(probe + expected.size() - 1U) % expected.size()]);
+        }
+    }
+
+    std::vector<SongId> visited;
+    playlist.ForEachSong([&](const auto& song) { visited.push_back(song.id); });
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(SongIndex, InsertFindEraseAcrossRehash) {
+    AutosarMusicPlayer::Asw::Playlist::SongIndex index;
+    for (std::uint32_t i = 1U; i <= 1000U; ++i) {
+        index.Insert(i, i - 1U);
+    }
+    EXPECT_EQ(index.Size(), 1000u);
+
+    for (std::uint32_t i = 1U; i <= 1000U; i += 2U) {
+        EXPECT_TRUE(index.Erase(i));
+    }
+    EXPECT_FALSE(index.Erase(1U));
+
+    for (std::uint32_t i = 1U; i <= 1000U; ++i) {
+        const bool odd = (i % 2U) == 1U;
+        EXPECT_EQ(index.Find(i), odd ? AutosarMusicPlayer::Asw::Playlist::SongIndex::kInvalidSlot : i - 1U);
+    }
+}
+
+TYPED_TEST(PlaylistModelTest, HandlesSurviveUnrelatedMutations) {
+    using AutosarMusicPlayer::Asw::Playlist::SongHandle;
+    TypeParam playlist;
+    SongHandle a;
+    SongHandle b;
+    ASSERT_EQ(playlist.AddSong(SongInfo{1U, "A", 10U}, a), AppError::Ok);
+    ASSERT_EQ(playlist.AddSong(SongInfo{2U, "B", 20U}, b), AppError::Ok);
+    for (AutosarMusicPlayer::Common::SongId id = 3U; id < 40U; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, "X", 1U}), AppError::Ok);
+    }
+
+    EXPECT_EQ(playlist.RemoveSong(1U), AppError::Ok);
+    EXPECT_FALSE(playlist.Get(a).has_value());
+
+    // The freed slot is reused, but the stale handle must not resolve to the new song.
+    SongHandle c;
+    ASSERT_EQ(playlist.AddSong(SongInfo{100U, "C", 30U}, c), AppError::Ok);
+    EXPECT_EQ(c.slot, a.slot);
+    EXPECT_NE(c, a);
+    EXPECT_FALSE(playlist.Get(a).has_value());
+
+    const auto songB = playlist.Get(b);
+    ASSERT_TRUE(songB.has_value());
+    EXPECT_EQ(songB->id, 2U);
+    EXPECT_EQ(songB->title, "B");
+    EXPECT_EQ(playlist.Find(2U), b);
+    EXPECT_TRUE(playlist.Find(1U).IsNull());
+
+    // Order is preserved: the re-added song goes to the end.
+    ASSERT_TRUE(playlist.At(0U).has_value());
+    EXPECT_EQ(playlist.At(0U)->id, 2U);
+    EXPECT_EQ(playlist.At(playlist.Size() - 1U)->id, 100U);
+    EXPECT_EQ(playlist.TotalDurationSeconds(), 20U + 37U + 30U);
+
+    EXPECT_EQ(playlist.Clear(), AppError::Ok);
+    EXPECT_FALSE(playlist.Get(b).has_value());
+}
+
+TYPED_TEST(PlaylistModelTest, AddSongsNotifiesOnce) {
+    TypeParam playlist;
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    std::vector<SongInfo> songs;
+    for (AutosarMusicPlayer::Common::SongId id = 1U; id <= 150U; ++id) {
+        songs.push_back(SongInfo{id, "T", 1U});
+    }
+
+    EXPECT_EQ(playlist.AddSongs(std::move(songs)), AppError::Ok);
+    EXPECT_EQ(playlist.Size(), 150u);
+    EXPECT_EQ(observer.playlistChangedCalls, 1u);
+    ASSERT_EQ(observer.songChanged.size(), 1u);
+    EXPECT_EQ(observer.songChanged.front(), 1U);
+}
+
+TYPED_TEST(PlaylistModelTest, AddSongsIsAllOrNothing) {
+    TypeParam playlist(10U);
+    ASSERT_EQ(playlist.AddSong(SongInfo{5U, "Existing", 1U}), AppError::Ok);
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    // Duplicate of an existing song.
+    EXPECT_EQ(playlist.AddSongs({{1U, "A", 1U}, {2U, "B", 1U}, {5U, "Dup", 1U}}),
+              AppError::InvalidArgument);
+    // Duplicate within the range itself.
+    EXPECT_EQ(playlist.AddSongs({{1U, "A", 1U}, {1U, "A", 1U}}), AppError::InvalidArgument);
+    EXPECT_EQ(playlist.AddSongs({{1U, "A", 1U}, {0U, "Zero", 1U}}), AppError::InvalidArgument);
+    EXPECT_EQ(playlist.AddSongs(std::vector<SongInfo>(10U, SongInfo{7U, "X", 1U})), AppError::Busy);
+
+    EXPECT_EQ(playlist.Size(), 1u);
+    EXPECT_FALSE(playlist.Contains(1U));
+    EXPECT_FALSE(playlist.Contains(2U));
+    EXPECT_EQ(observer.playlistChangedCalls, 0u);
+
+    EXPECT_EQ(playlist.AddSongs({{1U, "A", 1U}, {2U, "B", 1U}}), AppError::Ok);
+    EXPECT_EQ(playlist.Size(), 3u);
+}
+
+TYPED_TEST(PlaylistModelTest, UpdateScopeCoalescesMixedMutations) {
+    TypeParam playlist;
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    {
+        const typename TypeParam::UpdateScope outer(playlist);
+        ASSERT_EQ(playlist.AddSong(SongInfo{1U, "A", 1U}), AppError::Ok);
+        ASSERT_EQ(playlist.AddSong(SongInfo{2U, "B", 1U}), AppError::Ok);
+        {
+            const typename TypeParam::UpdateScope inner(playlist);
+            ASSERT_EQ(playlist.AddSong(SongInfo{3U, "C", 1U}), AppError::Ok);
+            ASSERT_EQ(playlist.SetCurrentSong(3U), AppError::Ok);
+        }
+        ASSERT_EQ(playlist.RemoveSong(1U), AppError::Ok);
+        ASSERT_EQ(playlist.SetCurrentSong(2U), AppError::Ok);
+        EXPECT_EQ(observer.playlistChangedCalls, 0u);
+        EXPECT_TRUE(observer.songChanged.empty());
+    }
+
+    EXPECT_EQ(observer.playlistChangedCalls, 1u);
+    ASSERT_EQ(observer.songChanged.size(), 1u);
+    EXPECT_EQ(observer.songChanged.front(), 2U);
+}
+
+TYPED_TEST(PlaylistModelTest, RangeMutationsEmitRangeEvents) {
+    TypeParam playlist;
+    ASSERT_EQ(playlist.AddSongs({{1U, "A", 1U}, {2U, "B", 1U}, {3U, "C", 1U}}), AppError::Ok);
+    AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver observer;
+    ASSERT_EQ(playlist.RegisterObserver(&observer), AppError::Ok);
+
+    ASSERT_EQ(playlist.InsertSongs(1U, {{10U, "X", 1U}, {11U, "Y", 1U}}), AppError::Ok);
+    EXPECT_EQ(playlist.At(1U)->id, 10U);
+    EXPECT_EQ(playlist.At(2U)->id, 11U);
+    EXPECT_EQ(playlist.At(3U)->id, 2U);
+
+    EXPECT_EQ(playlist.UpdateSongs(0U, {{2U, "wrong id", 1U}}), AppError::InvalidArgument);
+    ASSERT_EQ(playlist.UpdateSongs(3U, {{2U, "B2", 9U}}), AppError::Ok);
+    EXPECT_EQ(playlist.At(3U)->title, "B2");
+
+    ASSERT_EQ(playlist.RemoveRange(0U, 2U), AppError::Ok);
+    EXPECT_EQ(playlist.RemoveRange(2U, 5U), AppError::InvalidArgument);
+    ASSERT_EQ(playlist.Clear(), AppError::Ok);
+
+    ASSERT_EQ(observer.inserted.size(), 1u);
+    EXPECT_EQ(observer.inserted[0].first, 1u);
+    EXPECT_EQ(observer.inserted[0].count, 2u);
+    ASSERT_EQ(observer.updated.size(), 1u);
+    EXPECT_EQ(observer.updated[0].first, 3u);
+    ASSERT_EQ(observer.removed.size(), 2u);
+    EXPECT_EQ(observer.removed[0].count, 2u);
+    EXPECT_EQ(observer.removed[1].first, 0u);
+    EXPECT_EQ(observer.removed[1].count, 3u);
+}
+
+TEST(StaticPlaylist, StoresSongsInline) {
+    StaticPlaylist playlist;
+    EXPECT_EQ(playlist.MaxSize(), AutosarMusicPlayer::Common::kMaxPlaylistSize);
+
+    for (AutosarMusicPlayer::Common::SongId id = 1U; id <= playlist.MaxSize(); ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, "T", id}), AppError::Ok);
+    }
+    EXPECT_EQ(playlist.AddSong(SongInfo{9999U, "Full", 1U}), AppError::Busy);
+
+    EXPECT_EQ(playlist.RemoveSong(5U), AppError::Ok);
+    EXPECT_EQ(playlist.AddSong(SongInfo{9999U, "Reused", 1U}), AppError::Ok);
+    EXPECT_TRUE(playlist.Contains(9999U));
+    EXPECT_FALSE(playlist.Contains(5U));
+    EXPECT_EQ(playlist.At(playlist.Size() - 1U)->title, "Reused");
+}
+
+TEST(StaticPlaylist, LongTitlesAreTruncated) {
+    StaticPlaylist playlist;
+    const std::string longTitle(AutosarMusicPlayer::Common::kMaxTitleLength + 10U, 'x');
+    ASSERT_EQ(playlist.AddSong(SongInfo{1U, longTitle, 1U}), AppError::Ok);
+    EXPECT_EQ(playlist.At(0U)->title.size(), AutosarMusicPlayer::Common::kMaxTitleLength);
+}
+
+TEST(StaticPlaylist, ObserverTableIsBounded) {
+    StaticPlaylist playlist;
+    std::vector<AutosarMusicPlayer::Test::Mocks::MockPlaylistObserver> observers(
+        StaticPlaylist::StoragePolicy::kMaxObservers + 1U);
+
+    EXPECT_EQ(playlist.RegisterObserver(nullptr), AppError::InvalidArgument);
+    for (std::size_t i = 0U; i < StaticPlaylist::StoragePolicy::kMaxObservers; ++i) {
+        EXPECT_EQ(playlist.RegisterObserver(&observers[i]), AppError::Ok);
+    }
+    EXPECT_EQ(playlist.RegisterObserver(&observers.back()), AppError::Busy);
+}
+
+TEST(PlaylistModel, TitlesSurviveArenaCompaction) {
+    Playlist playlist;
+    const auto titleOf = [](AutosarMusicPlayer::Common::SongId id) {
+        return "A fairly long title for song number " + std::to_string(id);
+    };
+    for (AutosarMusicPlayer::Common::SongId id = 1U; id <= 4000U; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, titleOf(id), id}), AppError::Ok);
+    }
+
+    // Dropping three quarters of the titles leaves enough dead bytes to
+    // force the title arena to repack.
+    ASSERT_EQ(playlist.RemoveRange(0U, 3000U), AppError::Ok);
+    ASSERT_EQ(playlist.UpdateSongs(0U, {SongInfo{3001U, "Renamed", 1U}}), AppError::Ok);
+
+    EXPECT_EQ(playlist.At(0U)->title, "Renamed");
+    for (std::size_t pos = 1U; pos < playlist.Size(); ++pos) {
+        const auto song = playlist.At(pos);
+        ASSERT_EQ(song->title, titleOf(song->id));
+    }
+}
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "playlist.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::PlaybackOrder;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::RepeatMode;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Asw::Playlist::StaticPlaylist;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+using Ids = std::vector<SongId>;
+
+template <typename PlaylistT>
+void AddIds(PlaylistT& playlist, SongId first, SongId last) {
+    for (SongId id = first; id <= last; ++id) {
+        ASSERT_EQ(playlist.AddSong(SongInfo{id, "T", id}), AppError::Ok);
+    }
+}
+
+template <typename PlaylistT>
+SongId CurrentId(const PlaylistT& playlist) {
+    const auto song = playlist.GetCurrentSong();
+    return song.has_value() ? song->id : 0U;
+}
+
+// Current song followed by every song Next reaches before the order ends.
+template <typename PlaylistT>
+Ids WalkForward(PlaylistT& playlist) {
+    Ids walk{CurrentId(playlist)};
+    while (playlist.Next() == AppError::Ok) {
+        walk.push_back(CurrentId(playlist));
+    }
+    return walk;
+}
+
+// Shuffle order of the whole playlist, starting at its first song.
+Ids ShuffleOrder(Playlist& playlist) {
+    playlist.SetRepeatMode(RepeatMode::Off);
+    while (playlist.Previous() == AppError::Ok) {
+    }
+    return WalkForward(playlist);
+}
+
+} // namespace
+
+TEST(PlaylistNavigation, SequentialNextPreviousAndRepeat) {
+    Playlist playlist;
+    EXPECT_EQ(playlist.Next(), AppError::NotFound);
+    AddIds(playlist, 1U, 4U);
+    EXPECT_EQ(CurrentId(playlist), 1U);
+    EXPECT_EQ(playlist.Previous(), AppError::NotFound);
+
+    EXPECT_EQ(WalkForward(playlist), (Ids{1U, 2U, 3U, 4U}));
+    EXPECT_EQ(playlist.CurrentPosition(), 3U);
+    EXPECT_FALSE(playlist.PeekNext().has_value());
+
+    playlist.SetRepeatMode(RepeatMode::All);
+    EXPECT_EQ(playlist.PeekNext()->id, 1U);
+    ASSERT_EQ(playlist.Next(), AppError::Ok);
+    EXPECT_EQ(CurrentId(playlist), 1U);
+    ASSERT_EQ(playlist.Previous(), AppError::Ok);
+    EXPECT_EQ(CurrentId(playlist), 4U);
+
+    // Position follows inserts and removals in front of the current song.
+    ASSERT_EQ(playlist.SetCurrentSong(3U), AppError::Ok);
+    ASSERT_EQ(playlist.InsertSongs(0U, {SongInfo{10U, "T", 1U}, SongInfo{11U, "T", 1U}}), AppError::Ok);
+    EXPECT_EQ(playlist.CurrentPosition(), 4U);
+    ASSERT_EQ(playlist.RemoveSong(1U), AppError::Ok);
+    EXPECT_EQ(playlist.CurrentPosition(), 3U);
+    ASSERT_EQ(playlist.Next(), AppError::Ok);
+    EXPECT_EQ(CurrentId(playlist), 4U);
+}
+
+TEST(PlaylistNavigation, RemovingCurrentSelectsItsSuccessor) {
+    Playlist playlist;
+    AddIds(playlist, 1U, 5U);
+    ASSERT_EQ(playlist.SetCurrentSong(2U), AppError::Ok);
+
+    ASSERT_EQ(playlist.RemoveRange(1U, 2U), AppError::Ok);
+    EXPECT_EQ(CurrentId(playlist), 4U);
+    EXPECT_EQ(playlist.CurrentPosition(), 1U);
+}
+
+TEST(PlaylistNavigation, ShuffleIsSeededPermutation) {
+    Playlist first;
+    Playlist second;
+    AddIds(first, 1U, 50U);
+    AddIds(second, 1U, 50U);
+    for (auto* playlist : {&first, &second}) {
+        playlist->SetShuffleSeed(1234U);
+        playlist->SetPlaybackOrder(PlaybackOrder::Shuffle);
+    }
+
+    const Ids order = ShuffleOrder(first);
+    EXPECT_EQ(ShuffleOrder(second), order);
+
+    Ids sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    Ids all(50U);
+    std::iota(all.begin(), all.end(), 1U);
+    EXPECT_EQ(sorted, all);
+    EXPECT_NE(order, all);
+
+    second.SetShuffleSeed(1235U);
+    EXPECT_NE(ShuffleOrder(second), order);
+
+    // Further edits keep both orders in step.
+    for (auto* playlist : {&first, &second}) {
+        playlist->SetShuffleSeed(99U);
+        ASSERT_EQ(playlist->RemoveSong(7U), AppError::Ok);
+        ASSERT_EQ(playlist->AddSong(SongInfo{77U, "T", 1U}), AppError::Ok);
+    }
+    EXPECT_EQ(ShuffleOrder(first), ShuffleOrder(second));
+}
+
+// Every one of the 6 orders of 3 songs should come up about equally often.
+TEST(PlaylistNavigation, ShuffleIsUniform) {
+    std::map<Ids, int> counts;
+    constexpr int kTrials = 6000;
+    for (int seed = 0; seed < kTrials; ++seed) {
+        Playlist playlist;
+        playlist.SetShuffleSeed(static_cast<std::uint64_t>(seed));
+        playlist.SetPlaybackOrder(PlaybackOrder::Shuffle);
+        AddIds(playlist, 1U, 3U);
+        ++counts[ShuffleOrder(playlist)];
+    }
+
+    ASSERT_EQ(counts.size(), 6U);
+    for (const auto& [order, count] : counts) {
+        EXPECT_GT(count, 850);
+        EXPECT_LT(count, 1150);
+    }
+}
+
+TEST(PlaylistNavigation, RemovalsDuringShuffleKeepTheWalkGoing) {
+    Playlist playlist;
+    AddIds(playlist, 1U, 20U);
+    playlist.SetShuffleSeed(7U);
+    playlist.SetPlaybackOrder(PlaybackOrder::Shuffle);
+    const Ids order = ShuffleOrder(playlist);
+    ASSERT_EQ(playlist.SetCurrentSong(order[0]), AppError::Ok);
+
+    // Current song removed: the next one in shuffle order takes over.
+    ASSERT_EQ(playlist.RemoveSong(order[0]), AppError::Ok);
+    EXPECT_EQ(CurrentId(playlist), order[1]);
+
+    // Upcoming songs removed (one of them together with the current song):
+    // the walk skips them and nothing else changes.
+    ASSERT_EQ(playlist.RemoveSong(order[3]), AppError::Ok);
+    {
+        const Playlist::UpdateScope scope(playlist);
+        ASSERT_EQ(playlist.RemoveSong(order[2]), AppError::Ok);
+        ASSERT_EQ(playlist.RemoveSong(order[1]), AppError::Ok);
+    }
+    EXPECT_EQ(CurrentId(playlist), order[4]);
+
+    Ids expected(order.begin() + 4, order.end());
+    expected.erase(std::remove(expected.begin(), expected.end(), order[10]), expected.end());
+    ASSERT_EQ(playlist.RemoveSong(order[10]), AppError::Ok);
+    EXPECT_EQ(WalkForward(playlist), expected);
+
+    // Removing the last song of the order wraps to the first.
+    ASSERT_EQ(playlist.RemoveSong(expected.back()), AppError::Ok);
+    EXPECT_EQ(CurrentId(playlist), expected.front());
+}
+
+// Random edits mixed with navigation, checked against a linear scan.
+TEST(PlaylistNavigation, StaysConsistentUnderRandomEdits) {
+    Playlist playlist;
+    playlist.SetShuffleSeed(5U);
+    std::mt19937 rng(5U);
+    SongId nextId = 1U;
+
+    for (int step = 0; step < 3000; ++step) {
+        const std::uint32_t action = static_cast<std::uint32_t>(rng() % 8U);
+        const std::size_t size = playlist.Size();
+        const std::size_t position = size == 0U ? 0U : rng() % size;
+        if (action == 0U || size < 5U) {
+            ASSERT_EQ(playlist.InsertSongs(position, {SongInfo{nextId++, "T", 1U}, SongInfo{nextId++, "T", 1U}}),
+                      AppError::Ok);
+        } else if (action == 1U) {
+            ASSERT_EQ(playlist.RemoveRange(position, std::min<std::size_t>(3U, size - position)), AppError::Ok);
+        } else if (action == 2U) {
+            ASSERT_EQ(playlist.SetCurrentSong(playlist.At(position)->id), AppError::Ok);
+        } else if (action == 3U) {
+            playlist.SetPlaybackOrder(rng() % 2U == 0U ? PlaybackOrder::Sequential : PlaybackOrder::Shuffle);
+            playlist.SetRepeatMode(rng() % 2U == 0U ? RepeatMode::Off : RepeatMode::All);
+        } else {
+            const auto peeked = playlist.PeekNext();
+            const AppError res = action % 2U == 0U ? playlist.Next() : playlist.Previous();
+            if (action % 2U == 0U) {
+                ASSERT_EQ(res == AppError::Ok, peeked.has_value());
+                if (peeked.has_value()) {
+                    ASSERT_EQ(CurrentId(playlist), peeked->id);
+                }
+            }
+        }
+
+        ASSERT_EQ(playlist.GetCurrentSong().has_value(), playlist.Size() != 0U);
+        if (playlist.Size() == 0U) {
+            continue;
+        }
+        const auto current = playlist.CurrentPosition();
+        ASSERT_TRUE(current.has_value());
+        ASSERT_EQ(playlist.At(*current)->id, CurrentId(playlist));
+    }
+
+    // The shuffle order still covers every song exactly once.
+    playlist.SetPlaybackOrder(PlaybackOrder::Shuffle);
+    Ids order = ShuffleOrder(playlist);
+    std::sort(order.begin(), order.end());
+    Ids all;
+    playlist.ForEachSong([&all](const SongView& song) { all.push_back(song.id); });
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(order, all);
+}
+
+TEST(StaticPlaylist, ShufflesWithoutHeap) {
+    StaticPlaylist playlist;
+    AddIds(playlist, 1U, 10U);
+    playlist.SetShuffleSeed(3U);
+    playlist.SetPlaybackOrder(PlaybackOrder::Shuffle);
+    playlist.SetRepeatMode(RepeatMode::All);
+
+    std::set<SongId> seen{CurrentId(playlist)};
+    for (int i = 0; i < 9; ++i) {
+        ASSERT_EQ(playlist.Next(), AppError::Ok);
+        seen.insert(CurrentId(playlist));
+    }
+    EXPECT_EQ(seen.size(), 10U);
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "playlist.hpp"
+#include "playlist_snapshot.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistSnapshot;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistSnapshotPublisher;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+std::vector<SongInfo> MakeSongs(SongId first, SongId last, const std::string& suffix = "") {
+    std::vector<SongInfo> songs;
+    for (SongId id = first; id <= last; ++id) {
+        songs.push_back(SongInfo{id, "Song " + std::to_string(id) + suffix, id});
+    }
+    return songs;
+}
+
+void ExpectMatches(const PlaylistSnapshot& snapshot, const Playlist& playlist) {
+    ASSERT_EQ(snapshot.Size(), playlist.Size());
+    for (std::size_t i = 0U; i < playlist.Size(); ++i) {
+        const auto expected = playlist.At(i);
+        const auto actual = snapshot.At(i);
+        ASSERT_TRUE(actual.has_value());
+        ASSERT_EQ(actual->id, expected->id);
+        ASSERT_EQ(actual->title, expected->title);
+        ASSERT_EQ(actual->durationSeconds, expected->durationSeconds);
+    }
+    ASSERT_FALSE(snapshot.At(playlist.Size()).has_value());
+    ASSERT_EQ(snapshot.CurrentPosition(), playlist.CurrentPosition());
+}
+
+} // namespace
+
+TEST(PlaylistSnapshot, SnapshotsAreImmutable) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 3U)), AppError::Ok);
+    PlaylistSnapshotPublisher publisher(playlist);
+    ASSERT_TRUE(publisher.IsAttached());
+
+    const auto before = publisher.Acquire();
+    ExpectMatches(*before, playlist);
+
+    ASSERT_EQ(playlist.RemoveSong(1U), AppError::Ok);
+    ASSERT_EQ(playlist.UpdateSongs(0U, {SongInfo{2U, "Renamed", 9U}}), AppError::Ok);
+
+    EXPECT_EQ(before->Size(), 3U);
+    EXPECT_EQ(before->At(1U)->title, "Song 2");
+    EXPECT_EQ(before->GetCurrentSong()->id, 1U);
+
+    const auto after = publisher.Acquire();
+    ExpectMatches(*after, playlist);
+    EXPECT_EQ(after->GetCurrentSong()->id, 2U);
+    EXPECT_GT(after->Version(), before->Version());
+}
+
+TEST(PlaylistSnapshot, UpdateScopePublishesWholeBatch) {
+    Playlist playlist;
+    PlaylistSnapshotPublisher publisher(playlist);
+    const std::uint64_t initial = publisher.Acquire()->Version();
+
+    {
+        const Playlist::UpdateScope scope(playlist);
+        ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 100U)), AppError::Ok);
+        ASSERT_EQ(playlist.RemoveRange(10U, 20U), AppError::Ok);
+        EXPECT_EQ(publisher.Acquire()->Size(), 0U);
+    }
+
+    // One snapshot for the batch, one for the new current song.
+    const auto snapshot = publisher.Acquire();
+    EXPECT_EQ(snapshot->Version(), initial + 2U);
+    ExpectMatches(*snapshot, playlist);
+}
+
+TEST(PlaylistSnapshot, UnchangedChunksAreShared) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 5000U)), AppError::Ok);
+    PlaylistSnapshotPublisher publisher(playlist);
+
+    const auto before = publisher.Acquire();
+    ASSERT_GT(before->ChunkCount(), 5U);
+
+    ASSERT_EQ(playlist.UpdateSongs(2000U, {SongInfo{2001U, "Edited", 1U}}), AppError::Ok);
+    const auto after = publisher.Acquire();
+    ExpectMatches(*after, playlist);
+
+    ASSERT_EQ(after->ChunkCount(), before->ChunkCount());
+    std::size_t rebuilt = 0U;
+    for (std::size_t i = 0U; i < after->ChunkCount(); ++i) {
+        rebuilt += after->ChunkAt(i) != before->ChunkAt(i) ? 1U : 0U;
+    }
+    EXPECT_EQ(rebuilt, 1U);
+}
+
+TEST(PlaylistSnapshot, FollowsRandomEdits) {
+    Playlist playlist;
+    PlaylistSnapshotPublisher publisher(playlist);
+    std::mt19937 rng(11U);
+    SongId nextId = 1U;
+
+    for (int step = 0; step < 300; ++step) {
+        const std::size_t size = playlist.Size();
+        const std::size_t position = size == 0U ? 0U : rng() % size;
+        const std::uint32_t action = static_cast<std::uint32_t>(rng() % 10U);
+        if (action < 4U || size == 0U) {
+            const SongId count = 1U + static_cast<SongId>(rng() % 700U);
+            ASSERT_EQ(playlist.InsertSongs(rng() % (size + 1U), MakeSongs(nextId, nextId + count - 1U)),
+                      AppError::Ok);
+            nextId += count;
+        } else if (action < 7U) {
+            const std::size_t count = 1U + rng() % std::min<std::size_t>(size - position, 600U);
+            ASSERT_EQ(playlist.RemoveRange(position, count), AppError::Ok);
+        } else if (action < 9U) {
+            const auto song = playlist.At(position);
+            ASSERT_EQ(playlist.UpdateSongs(position, {SongInfo{song->id, "Step " + std::to_string(step), 1U}}),
+                      AppError::Ok);
+        } else {
+            ASSERT_EQ(playlist.Clear(), AppError::Ok);
+        }
+        ExpectMatches(*publisher.Acquire(), playlist);
+    }
+}
+
+// A writer rescans (renames every title to a new generation and churns the
+// library inside one UpdateScope) while readers check each snapshot is
+// one consistent generation.
+TEST(PlaylistSnapshot, ConcurrentReadersNeverSeeHalfAppliedRescans) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs(MakeSongs(1U, 2000U, " g0")), AppError::Ok);
+    PlaylistSnapshotPublisher publisher(playlist);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::atomic<int> reads{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            std::uint64_t lastVersion = 0U;
+            while (!done.load()) {
+                const auto snapshot = publisher.Acquire();
+                bool ok = snapshot->Version() >= lastVersion;
+                lastVersion = snapshot->Version();
+
+                std::string generation;
+                std::size_t count = 0U;
+                snapshot->ForEachSong([&](const SongView& song) {
+                    const std::string title(song.title);
+                    const std::string prefix = "Song " + std::to_string(song.id) + " ";
+                    const std::string suffix = title.substr(std::min(prefix.size(), title.size()));
+                    ok = ok && title.compare(0U, prefix.size(), prefix) == 0;
+                    ok = ok && (generation.empty() || generation == suffix);
+                    generation = suffix;
+                    ++count;
+                });
+                ok = ok && count == snapshot->Size();
+                const auto current = snapshot->GetCurrentSong();
+                ok = ok && (count == 0U || current.has_value());
+
+                failures += ok ? 0 : 1;
+                ++reads;
+            }
+        });
+    }
+
+    std::mt19937 rng(3U);
+    SongId nextId = 2001U;
+    for (int generation = 1; generation <= 200; ++generation) {
+        const Playlist::UpdateScope scope(playlist);
+        const std::string suffix = " g" + std::to_string(generation);
+
+        const std::size_t removeAt = rng() % playlist.Size();
+        ASSERT_EQ(playlist.RemoveRange(removeAt, std::min<std::size_t>(50U, playlist.Size() - removeAt)),
+                  AppError::Ok);
+        std::vector<SongInfo> renamed;
+        playlist.ForEachSong([&](const SongView& song) {
+            renamed.push_back(SongInfo{song.id, "Song " + std::to_string(song.id) + suffix, song.durationSeconds});
+        });
+        ASSERT_EQ(playlist.UpdateSongs(0U, renamed), AppError::Ok);
+        ASSERT_EQ(playlist.InsertSongs(rng() % playlist.Size(), MakeSongs(nextId, nextId + 49U, suffix)),
+                  AppError::Ok);
+        nextId += 50U;
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_GT(reads.load(), 0);
+    ExpectMatches(*publisher.Acquire(), playlist);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "playlist.hpp"
+#include "playlist_view.hpp"
+#include "title_folding.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::AppendFolded;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::PlaylistView;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+std::string Folded(const std::string& title) {
+    std::string out;
+    AppendFolded(title, out);
+    return out;
+}
+
+std::vector<SongId> ViewIds(PlaylistView& view) {
+    std::vector<SongView> rows;
+    view.Window(0U, view.Size(), rows);
+    std::vector<SongId> ids;
+    for (const auto& row : rows) {
+        ids.push_back(row.id);
+    }
+    return ids;
+}
+
+} // namespace
+
+TEST(TitleFolding, FoldsCaseAndLatinDiacritics) {
+    EXPECT_EQ(Folded("\xC3\x80\xC3\x89\xC3\x8E\xC3\xB5\xC3\xBC Stra\xC3\x9F" "e"), "aeiou strasse");
+    EXPECT_EQ(Folded("\xC5\x81\xC3\xB3\x64\xC5\xBA"), "lodz");
+    // Outside the folded ranges bytes pass through unchanged.
+    EXPECT_EQ(Folded("\xE6\x97\xA5\xE6\x9C\xAC"), "\xE6\x97\xA5\xE6\x9C\xAC");
+}
+
+TEST(PlaylistView, SortsByFoldedTitle) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSong(SongInfo{1U, "banana", 10U}), AppError::Ok);
+    ASSERT_EQ(playlist.AddSong(SongInfo{2U, "\xC3\x89" "clair", 20U}), AppError::Ok);
+    ASSERT_EQ(playlist.AddSong(SongInfo{3U, "Apple", 30U}), AppError::Ok);
+    ASSERT_EQ(playlist.AddSong(SongInfo{4U, "apple", 5U}), AppError::Ok);
+
+    PlaylistView byTitle(playlist, PlaylistView::Order::Title);
+    ASSERT_TRUE(byTitle.IsAttached());
+    EXPECT_EQ(ViewIds(byTitle), (std::vector<SongId>{3U, 4U, 1U, 2U}));
+
+    PlaylistView byDuration(playlist, PlaylistView::Order::Duration);
+    EXPECT_EQ(ViewIds(byDuration), (std::vector<SongId>{4U, 1U, 2U, 3U}));
+
+    EXPECT_EQ(byTitle.RowOf(2U), 3U);
+    EXPECT_FALSE(byTitle.RowOf(99U).has_value());
+}
+
+TEST(PlaylistView, AddedOrderIgnoresPlaylistPosition) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSong(SongInfo{1U, "A", 1U}), AppError::Ok);
+    PlaylistView view(playlist, PlaylistView::Order::Added);
+    ASSERT_EQ(playlist.InsertSongs(0U, {SongInfo{2U, "B", 1U}}), AppError::Ok);
+    ASSERT_EQ(playlist.AddSong(SongInfo{3U, "C", 1U}), AppError::Ok);
+    EXPECT_EQ(ViewIds(view), (std::vector<SongId>{1U, 2U, 3U}));
+}
+
+TEST(PlaylistView, FilterFollowsUpdates) {
+    Playlist playlist;
+    PlaylistView longSongs(playlist, PlaylistView::Order::Duration,
+                           [](const SongView& song) { return song.durationSeconds >= 100U; });
+    ASSERT_EQ(playlist.AddSongs({SongInfo{1U, "A", 50U}, SongInfo{2U, "B", 150U}, SongInfo{3U, "C", 120U}}),
+              AppError::Ok);
+    EXPECT_EQ(ViewIds(longSongs), (std::vector<SongId>{3U, 2U}));
+
+    ASSERT_EQ(playlist.UpdateSongs(0U, {SongInfo{1U, "A", 200U}, SongInfo{2U, "B", 10U}}), AppError::Ok);
+    EXPECT_EQ(ViewIds(longSongs), (std::vector<SongId>{3U, 1U}));
+}
+
+// Random mutations against a brute-force sort of the playlist.
+TEST(PlaylistView, MatchesFullSortAcrossRandomMutations) {
+    Playlist playlist;
+    const auto filter = [](const SongView& song) { return song.id % 5U != 0U; };
+    PlaylistView byTitle(playlist, PlaylistView::Order::Title, filter);
+    PlaylistView byDuration(playlist, PlaylistView::Order::Duration);
+
+    std::mt19937 rng(1234U);
+    SongId nextId = 1U;
+    const auto randomTitle = [&rng]() {
+        static const char* const kWords[] = {"alpha", "Beta", "\xC3\xA9t\xC3\xA9", "Gamma", "delta", "Zulu"};
+        return std::string(kWords[rng() % 6U]) + " " + std::to_string(rng() % 50U);
+    };
+
+    for (int round = 0; round < 40; ++round) {
+        std::vector<SongInfo> batch;
+        const std::size_t adds = rng() % (round == 0 ? 3000U : 60U);
+        for (std::size_t i = 0U; i < adds; ++i) {
+            batch.push_back(SongInfo{nextId++, randomTitle(), static_cast<std::uint32_t>(rng() % 400U)});
+        }
+        ASSERT_EQ(playlist.InsertSongs(rng() % (playlist.Size() + 1U), batch), AppError::Ok);
+
+        if (playlist.Size() > 10U) {
+            const std::size_t pos = rng() % (playlist.Size() - 5U);
+            ASSERT_EQ(playlist.RemoveRange(pos, rng() % 5U), AppError::Ok);
+            const std::size_t updated = rng() % playlist.Size();
+            const SongId id = playlist.At(updated)->id;
+            ASSERT_EQ(playlist.UpdateSongs(updated, {SongInfo{id, randomTitle(), static_cast<std::uint32_t>(rng() % 400U)}}), AppError::Ok);
+        }
+
+        std::vector<std::tuple<std::string, SongId>> titleRef;
+        std::vector<std::tuple<std::uint32_t, SongId>> durationRef;
+        playlist.ForEachSong([&](const SongView& song) {
+            if (filter(song)) {
+                titleRef.emplace_back(Folded(std::string(song.title)), song.id);
+            }
+            durationRef.emplace_back(song.durationSeconds, song.id);
+        });
+        std::sort(titleRef.begin(), titleRef.end());
+        std::sort(durationRef.begin(), durationRef.end());
+
+        std::vector<SongId> expectedTitle;
+        for (const auto& entry : titleRef) {
+            expectedTitle.push_back(std::get<1>(entry));
+        }
+        std::vector<SongId> expectedDuration;
+        for (const auto& entry : durationRef) {
+            expectedDuration.push_back(std::get<1>(entry));
+        }
+        ASSERT_EQ(ViewIds(byTitle), expectedTitle) << "round " << round;
+        ASSERT_EQ(ViewIds(byDuration), expectedDuration) << "round " << round;
+    }
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "playlist.hpp"
+#include "title_folding.hpp"
+#include "title_search_index.hpp"
+
+using AutosarMusicPlayer::Asw::Playlist::AppendFolded;
+using AutosarMusicPlayer::Asw::Playlist::Playlist;
+using AutosarMusicPlayer::Asw::Playlist::SongView;
+using AutosarMusicPlayer::Asw::Playlist::TitleSearchIndex;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::SongId;
+using AutosarMusicPlayer::Common::SongInfo;
+
+namespace {
+
+using Ids = std::vector<SongId>;
+
+Ids Prefix(TitleSearchIndex& index, const std::string& query, std::size_t maxResults = 100U) {
+    Ids out;
+    index.FindPrefix(query, maxResults, out);
+    return out;
+}
+
+Ids Substring(TitleSearchIndex& index, const std::string& query, std::size_t maxResults = 100U) {
+    Ids out;
+    index.FindSubstring(query, maxResults, out);
+    return out;
+}
+
+} // namespace
+
+TEST(TitleSearchIndex, PrefixMatchesWordStartsWithFolding) {
+    Playlist playlist;
+    ASSERT_EQ(playlist.AddSongs({SongInfo{1U, "Caf\xC3\xA9 del Mar", 1U}, SongInfo{2U, "Cafeteria Blues", 1U},
+                                 SongInfo{3U, "The CAFE", 1U}, SongInfo{4U, "Decaf", 1U}}),
+              AppError::Ok);
+    TitleSearchIndex index(playlist);
+    ASSERT_TRUE(index.IsAttached());
+
+    EXPECT_EQ(Prefix(index, "cafe"), (Ids{1U, 2U, 3U}));
+    EXPECT_EQ(Prefix(index, "CAF\xC3\x89"), (Ids{1U, 2U, 3U}));
+    EXPECT_EQ(Substring(index, "caf"), (Ids{1U, 2U, 4U, 3U}));
+    EXPECT_EQ(Prefix(index, "b"), (Ids{2U}));
+    EXPECT_EQ(Substring(index, "ue"), (Ids{2U}));
+    EXPECT_EQ(Prefix(index, "cafe", 2U), (Ids{1U, 2U}));
+    EXPECT_TRUE(Prefix(index, "xyz").empty());
+    EXPECT_TRUE(Prefix(index, "").empty());
+}
+
+TEST(TitleSearchIndex, FollowsPlaylistMutations) {
+    Playlist playlist;
+    TitleSearchIndex index(playlist);
+    ASSERT_EQ(playlist.AddSongs({SongInfo{1U, "Yellow Submarine", 1U}, SongInfo{2U, "Yesterday", 1U}}),
+              AppError::Ok);
+    EXPECT_EQ(Prefix(index, "ye"), (Ids{1U, 2U}));
+
+    ASSERT_EQ(playlist.RemoveSong(1U), AppError::Ok);
+    EXPECT_EQ(Prefix(index, "ye"), (Ids{2U}));
+
+    ASSERT_EQ(playlist.UpdateSongs(0U, {SongInfo{2U, "Let It Be", 1U}}), AppError::Ok);
+    EXPECT_TRUE(Prefix(index, "yes").empty());
+    EXPECT_EQ(Prefix(index, "be"), (Ids{2U}));
+
+    ASSERT_EQ(playlist.AddSong(SongInfo{3U, "Yes It Is", 1U}), AppError::Ok);
+    EXPECT_EQ(Prefix(index, "yes"), (Ids{3U}));
+    EXPECT_EQ(index.Size(), 2U);
+}
+
+// Random library and queries against a brute-force scan, across enough
+// churn to rebuild the posting lists.
+TEST(TitleSearchIndex, MatchesLinearScan) {
+    Playlist playlist;
+    TitleSearchIndex index(playlist);
+
+    std::mt19937 rng(99U);
+    static const char* const kWords[] = {"love", "Lov\xC3\xA9", "night", "Knight", "blue", "moon", "Mo", "river"};
+    const auto randomTitle = [&rng]() {
+        std::string title;
+        const std::size_t words = 1U + rng() % 4U;
+        for (std::size_t w = 0U; w < words; ++w) {
+            title += std::string(w == 0U ? "" : " ") + kWords[rng() % 8U];
+        }
+        return title;
+    };
+
+    SongId nextId = 1U;
+    const auto check = [&](const std::string& query, bool wordPrefix) {
+        std::string foldedQuery;
+        AppendFolded(query, foldedQuery);
+        std::vector<std::tuple<std::size_t, std::string, SongId>> expected;
+        playlist.ForEachSong([&](const SongView& song) {
+            std::string title;
+            AppendFolded(song.title, title);
+            for (auto pos = title.find(foldedQuery); pos != std::string::npos; pos = title.find(foldedQuery, pos + 1U)) {
+                if (!wordPrefix || pos == 0U || title[pos - 1U] == ' ') {
+                    expected.emplace_back(pos, title, song.id);
+                    break;
+                }
+            }
+        });
+        std::sort(expected.begin(), expected.end());
+        Ids expectedIds;
+        for (const auto& entry : expected) {
+            expectedIds.push_back(std::get<2>(entry));
+        }
+        Ids actual;
+        if (wordPrefix) {
+            index.FindPrefix(query, expected.size() + 1U, actual);
+        } else {
+            index.FindSubstring(query, expected.size() + 1U, actual);
+        }
+        ASSERT_EQ(actual, expectedIds) << query;
+    };
+
+    for (int round = 0; round < 6; ++round) {
+        std::vector<SongInfo> batch;
+        for (int i = 0; i < 1500; ++i) {
+            batch.push_back(SongInfo{nextId++, randomTitle(), 1U});
+        }
+        ASSERT_EQ(playlist.AddSongs(batch), AppError::Ok);
+        ASSERT_EQ(playlist.RemoveRange(0U, playlist.Size() / 2U), AppError::Ok);
+
+        for (const char* query : {"l", "lo", "love", "LOVE", "ight", "mo", "moon r", "e b", "knig"}) {
+            check(query, true);
+            check(query, false);
+        }
+    }
+}
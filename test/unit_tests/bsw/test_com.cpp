@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+
+#include "Com_Cfg.h"
+#include "bsw_mocks/loopback_can_if.hpp"
+#include "com.hpp"
+#include "socket_can_if.hpp"
+
+using AutosarMusicPlayer::Bsw::Com::Com;
+using AutosarMusicPlayer::Bsw::Com::PduConfig;
+using AutosarMusicPlayer::Bsw::Com::SignalConfig;
+using AutosarMusicPlayer::Bsw::Com::TransmitMode;
+using AutosarMusicPlayer::Bsw::Hal::CanFrame;
+using AutosarMusicPlayer::Bsw::Hal::SocketCanIf;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Test::Mocks::LoopbackCanIf;
+namespace Com_Cfg = AutosarMusicPlayer::Com_Cfg;
+
+namespace {
+
+Com::Clock::time_point At(int ms) {
+    return Com::Clock::time_point{} + std::chrono::milliseconds(ms);
+}
+
+constexpr std::array<PduConfig, 1U> kOnChangePdu{{{"State", 0x100U, 1U, TransmitMode::OnChange, 0U, 20000U}}};
+constexpr std::array<SignalConfig, 2U> kOnChangeSignals{{
+    {"State", 0U, 0U, 4U, true},
+    {"Quality", 0U, 4U, 4U, false},
+}};
+
+} // namespace
+
+TEST(Com, GeneratedConfigurationPacksSignalsLittleEndian) {
+    LoopbackCanIf bus;
+    Com com(bus, Com_Cfg::kTxPdus, Com_Cfg::kTxSignals, Com_Cfg::kCanBitrate);
+    EXPECT_EQ(com.PduCount(), 2U);
+
+    EXPECT_EQ(com.SendSignal(Com_Cfg::kSigCurrentSongId, 0x12345678U, At(0)), AppError::Ok);
+    EXPECT_EQ(com.SendSignal(Com_Cfg::kSigPlaybackState, 1U, At(0)), AppError::Ok);
+    EXPECT_EQ(com.SendSignal(Com_Cfg::kSigElapsedTimeMs, 0xA0B0C0D0U, At(0)), AppError::Ok);
+    EXPECT_EQ(com.SendSignal(Com_Cfg::kSigPlaybackState, 256U, At(0)), AppError::InvalidArgument);
+    EXPECT_EQ(com.SendSignal(99U, 0U, At(0)), AppError::InvalidArgument);
+
+    com.MainFunctionTx(At(0));
+    ASSERT_EQ(bus.frames.size(), 2U);
+
+    const CanFrame& status = bus.frames[0];
+    EXPECT_EQ(status.id, 0x3A0U);
+    ASSERT_EQ(status.dlc, 5U);
+    const std::array<std::uint8_t, 5U> expectedStatus{0x78U, 0x56U, 0x34U, 0x12U, 0x01U};
+    for (std::size_t i = 0U; i < expectedStatus.size(); ++i) {
+        EXPECT_EQ(status.data[i], expectedStatus[i]) << "byte " << i;
+    }
+
+    const CanFrame& position = bus.frames[1];
+    EXPECT_EQ(position.id, 0x3A1U);
+    ASSERT_EQ(position.dlc, 4U);
+    EXPECT_EQ(position.data[0], 0xD0U);
+    EXPECT_EQ(position.data[3], 0xA0U);
+}
+
+TEST(Com, CyclicAndMixedPdusFollowTheirCycles) {
+    LoopbackCanIf bus;
+    Com com(bus, Com_Cfg::kTxPdus, Com_Cfg::kTxSignals, Com_Cfg::kCanBitrate);
+
+    for (int ms = 0; ms < 1000; ++ms) {
+        // The elapsed time changes every tick but is not a triggering signal.
+        (void)com.SendSignal(Com_Cfg::kSigElapsedTimeMs, static_cast<std::uint32_t>(ms), At(ms));
+        com.MainFunctionTx(At(ms));
+    }
+
+    EXPECT_EQ(bus.CountOf(0x3A1U), 10U);
+    EXPECT_EQ(bus.CountOf(0x3A0U), 2U);
+
+    // A change goes out at once, between cycles.
+    (void)com.SendSignal(Com_Cfg::kSigPlaybackState, 2U, At(1000));
+    com.MainFunctionTx(At(1001));
+    EXPECT_EQ(bus.CountOf(0x3A0U), 3U);
+    EXPECT_EQ(com.Stats(Com_Cfg::kPduMusicPlayerStatus).maxLatencyUs, 1000U);
+}
+
+TEST(Com, MinimumDelayCoalescesBursts) {
+    LoopbackCanIf bus;
+    Com com(bus, kOnChangePdu, kOnChangeSignals, Com_Cfg::kCanBitrate);
+
+    com.MainFunctionTx(At(0));
+    EXPECT_TRUE(bus.frames.empty()) << "an OnChange PDU has no cycle";
+
+    // Ten state changes within 10 ms, a main function every millisecond.
+    for (int ms = 1; ms <= 10; ++ms) {
+        ASSERT_EQ(com.SendSignal(0U, static_cast<std::uint32_t>(ms), At(ms)), AppError::Ok);
+        com.MainFunctionTx(At(ms));
+    }
+    ASSERT_EQ(bus.frames.size(), 1U);
+    EXPECT_EQ(bus.frames[0].data[0], 1U);
+
+    for (int ms = 11; ms <= 40; ++ms) {
+        com.MainFunctionTx(At(ms));
+    }
+    ASSERT_EQ(bus.frames.size(), 2U);
+    EXPECT_EQ(bus.frames[1].data[0], 10U) << "the delayed frame carries the latest value";
+
+    const auto stats = com.Stats(0U);
+    EXPECT_EQ(stats.transmitted, 2U);
+    EXPECT_EQ(stats.coalesced, 8U);
+    EXPECT_EQ(stats.maxLatencyUs, 19000U); // Changed at 2 ms, sent at 21 ms
+
+    // Rewriting the same value, or changing a non-triggering signal, sends nothing.
+    (void)com.SendSignal(0U, 10U, At(50));
+    (void)com.SendSignal(1U, 3U, At(50));
+    com.MainFunctionTx(At(50));
+    EXPECT_EQ(bus.frames.size(), 2U);
+}
+
+TEST(Com, RefusedFramesAreRetriedAndBusLoadIsReported) {
+    LoopbackCanIf bus;
+    constexpr std::array<PduConfig, 1U> pdus{{{"Fast", 0x200U, 8U, TransmitMode::Cyclic, 1000U, 0U}}};
+    constexpr std::array<SignalConfig, 1U> signals{{{"Counter", 0U, 0U, 16U, false}}};
+    Com com(bus, pdus, signals, 500000U);
+
+    bus.freeMailboxes = 0;
+    com.MainFunctionTx(At(0));
+    EXPECT_EQ(com.Stats(0U).transmitErrors, 1U);
+    EXPECT_TRUE(bus.frames.empty());
+
+    bus.freeMailboxes = -1;
+    for (int ms = 1; ms <= 1000; ++ms) {
+        com.MainFunctionTx(At(ms));
+    }
+    EXPECT_EQ(bus.frames.size(), 1000U);
+
+    // 1000 frames of 135 bits in one second at 500 kbit/s.
+    const auto report = com.BusLoad();
+    EXPECT_EQ(report.elapsedUs, 1000000U);
+    EXPECT_EQ(report.frames, 1000U);
+    EXPECT_EQ(report.bits, 135000U);
+    EXPECT_NEAR(report.load, 0.27, 1e-9);
+}
+
+TEST(SocketCanIf, LoopsFramesBackOnVirtualCan) {
+    SocketCanIf closed;
+    EXPECT_EQ(closed.Open("mp_no_such_can"), AppError::NotFound);
+    EXPECT_EQ(closed.Transmit(CanFrame{}), AppError::NotReady);
+
+    SocketCanIf sender;
+    SocketCanIf receiver;
+    if (sender.Open("vcan0") != AppError::Ok || receiver.Open("vcan0") != AppError::Ok) {
+        GTEST_SKIP() << "vcan0 is not available";
+    }
+
+    Com com(sender, Com_Cfg::kTxPdus, Com_Cfg::kTxSignals, Com_Cfg::kCanBitrate);
+    (void)com.SendSignal(Com_Cfg::kSigCurrentSongId, 42U);
+    com.MainFunctionTx();
+
+    CanFrame frame;
+    ASSERT_EQ(receiver.Receive(frame), AppError::Ok);
+    EXPECT_EQ(frame.id, 0x3A0U);
+    EXPECT_EQ(frame.dlc, 5U);
+    EXPECT_EQ(frame.data[0], 42U);
+}
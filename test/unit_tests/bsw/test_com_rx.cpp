@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Com_Cfg.h"
+#include "can_id_table.hpp"
+#include "com_rx.hpp"
+
+using AutosarMusicPlayer::Bsw::Com::CanIdTable;
+using AutosarMusicPlayer::Bsw::Com::ComRx;
+using AutosarMusicPlayer::Bsw::Com::IComRxListener;
+using AutosarMusicPlayer::Bsw::Com::PduId;
+using AutosarMusicPlayer::Bsw::Com::RxPduConfig;
+using AutosarMusicPlayer::Bsw::Com::SignalConfig;
+using AutosarMusicPlayer::Bsw::Com::SignalId;
+using AutosarMusicPlayer::Bsw::Hal::CanFrame;
+namespace Com_Cfg = AutosarMusicPlayer::Com_Cfg;
+
+namespace {
+
+class RecordingListener final : public IComRxListener {
+public:
+    void OnSignalReceived(SignalId signal, std::uint32_t value) override {
+        signals.emplace_back(signal, value);
+    }
+
+    std::vector<std::pair<SignalId, std::uint32_t>> signals;
+};
+
+CanFrame Frame(std::uint32_t id, std::uint8_t dlc, std::uint8_t byte0 = 0U, std::uint8_t byte1 = 0U) {
+    CanFrame frame;
+    frame.id = id;
+    frame.dlc = dlc;
+    frame.data[0] = byte0;
+    frame.data[1] = byte1;
+    return frame;
+}
+
+// Sixteen ids, many of which share a home slot.
+constexpr std::array<RxPduConfig, 16U> kCrowdedPdus{{
+    {"P0", 0x000U, 1U}, {"P1", 0x020U, 1U}, {"P2", 0x040U, 1U}, {"P3", 0x060U, 1U},
+    {"P4", 0x100U, 1U}, {"P5", 0x120U, 1U}, {"P6", 0x140U, 1U}, {"P7", 0x160U, 1U},
+    {"P8", 0x7FFU, 1U}, {"P9", 0x7FEU, 1U}, {"PA", 0x001U, 1U}, {"PB", 0x002U, 1U},
+    {"PC", 0x1FFFFFFFU, 1U}, {"PD", 0x18FF0001U, 1U}, {"PE", 0x3A0U, 1U}, {"PF", 0x3A1U, 1U},
+}};
+constexpr CanIdTable kCrowdedTable = CanIdTable::Build(kCrowdedPdus);
+
+} // namespace
+
+TEST(CanIdTable, FindsEveryConfiguredIdAndNothingElse) {
+    static_assert(kCrowdedTable.Size() == kCrowdedPdus.size());
+
+    PduId pdu = 0U;
+    for (std::size_t i = 0U; i < kCrowdedPdus.size(); ++i) {
+        ASSERT_TRUE(kCrowdedTable.Find(kCrowdedPdus[i].canId, pdu)) << kCrowdedPdus[i].name;
+        EXPECT_EQ(pdu, i);
+    }
+    for (std::uint32_t id = 0x200U; id < 0x300U; ++id) {
+        EXPECT_FALSE(kCrowdedTable.Find(id, pdu)) << id;
+    }
+
+    ASSERT_TRUE(Com_Cfg::kRxIdTable.Find(0x0C0U, pdu));
+    EXPECT_EQ(pdu, Com_Cfg::kRxPduIgnitionStatus);
+}
+
+TEST(ComRx, DecodesConfiguredFramesAndDropsTheRest) {
+    RecordingListener listener;
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, listener);
+
+    rx.RxIndication(Frame(0x1A0U, 1U, 0xF2U)); // Upper nibble is not part of MediaButton
+    rx.RxIndication(Frame(0x123U, 8U));        // Not ours
+    rx.RxIndication(Frame(0x0C0U, 0U));        // Too short
+    rx.RxIndication(Frame(0x0C0U, 1U, 0x01U));
+    EXPECT_TRUE(listener.signals.empty()) << "nothing is dispatched from the interrupt";
+
+    EXPECT_EQ(rx.MainFunctionRx(), 4U);
+    ASSERT_EQ(listener.signals.size(), 2U);
+    EXPECT_EQ(listener.signals[0], std::make_pair(Com_Cfg::kSigMediaButton, 2U));
+    EXPECT_EQ(listener.signals[1], std::make_pair(Com_Cfg::kSigIgnitionOn, 1U));
+
+    const auto stats = rx.Stats();
+    EXPECT_EQ(stats.received, 2U);
+    EXPECT_EQ(stats.filtered, 1U);
+    EXPECT_EQ(stats.dlcErrors, 1U);
+    EXPECT_EQ(stats.overruns, 0U);
+}
+
+TEST(ComRx, FullRingCountsOverruns) {
+    RecordingListener listener;
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, listener);
+
+    for (std::size_t i = 0U; i < ComRx::kRingLength + 3U; ++i) {
+        rx.RxIndication(Frame(0x0C0U, 1U, static_cast<std::uint8_t>(i & 1U)));
+    }
+    EXPECT_EQ(rx.Stats().overruns, 3U);
+    EXPECT_EQ(rx.MainFunctionRx(), ComRx::kRingLength);
+    EXPECT_EQ(listener.signals.size(), ComRx::kRingLength);
+}
+
+TEST(ComRx, InterruptThreadAndTaskRunConcurrently) {
+    constexpr std::uint32_t kFrames = 50000U;
+    RecordingListener listener;
+    listener.signals.reserve(kFrames);
+    ComRx rx(Com_Cfg::kRxIdTable, Com_Cfg::kRxPdus, Com_Cfg::kRxSignals, listener);
+
+    std::atomic<bool> finished{false};
+    std::thread isr([&]() {
+        for (std::uint32_t i = 0U; i < kFrames; ++i) {
+            rx.RxIndication(Frame(0x1A0U, 1U, static_cast<std::uint8_t>(i % 16U)));
+            if ((i % 32U) == 0U) {
+                std::this_thread::yield();
+            }
+        }
+        finished.store(true);
+    });
+
+    while (!finished.load()) {
+        (void)rx.MainFunctionRx();
+        std::this_thread::yield();
+    }
+    (void)rx.MainFunctionRx();
+    isr.join();
+
+    // Frames are either delivered, in order, or counted as overruns.
+    const auto stats = rx.Stats();
+    EXPECT_EQ(stats.received + stats.overruns, kFrames);
+    ASSERT_EQ(listener.signals.size(), stats.received);
+    if (stats.overruns == 0U) {
+        for (std::size_t i = 0U; i < listener.signals.size(); ++i) {
+            ASSERT_EQ(listener.signals[i].second, i % 16U);
+        }
+    }
+}
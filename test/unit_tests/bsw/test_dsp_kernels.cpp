@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dsp_kernels.hpp"
+
+using AutosarMusicPlayer::Bsw::Dsp::DspIsa;
+using AutosarMusicPlayer::Bsw::Dsp::DspKernels;
+using AutosarMusicPlayer::Bsw::Dsp::KernelsFor;
+
+namespace {
+
+const DspKernels& Scalar() {
+    return *KernelsFor(DspIsa::Scalar);
+}
+
+/**
+ * @brief Full-scale noise with the awkward values sprinkled in
+ */
+std::vector<float> TestSignal(std::size_t samples, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> noise(-1.2F, 1.2F);
+    const float specials[] = {0.0F, -0.0F, 1.0F, -1.0F, 0.5F / 32768.0F, 1.5F / 32768.0F,
+                              std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                              std::numeric_limits<float>::quiet_NaN(), 1e30F};
+    std::vector<float> signal(samples);
+    for (std::size_t i = 0U; i < samples; ++i) {
+        signal[i] = (i % 7U == 3U) ? specials[(i / 7U) % std::size(specials)] : noise(rng);
+    }
+    return signal;
+}
+
+template <typename T>
+bool BitEqual(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+// Lengths around every vector width, to exercise the tail loops
+constexpr std::size_t kLengths[] = {0U, 1U, 3U, 7U, 8U, 15U, 16U, 17U, 33U, 64U, 1023U};
+
+} // namespace
+
+TEST(DspKernelsTest, ScalarReferenceRoundsAndSaturates) {
+    const std::vector<float> in = {1.0F, -1.0F, 0.5F, 0.5F / 32768.0F, 1.5F / 32768.0F, 2.0F,
+                                   std::numeric_limits<float>::quiet_NaN()};
+    std::vector<std::int16_t> out(in.size());
+    Scalar().floatToInt16(in.data(), out.data(), in.size());
+    EXPECT_EQ(out, (std::vector<std::int16_t>{32767, -32768, 16384, 0, 2, 32767, -32768}));
+
+    std::vector<float> back(2U);
+    const std::int16_t extremes[] = {-32768, 16384};
+    Scalar().int16ToFloat(extremes, back.data(), 2U);
+    EXPECT_FLOAT_EQ(back[0], -1.0F);
+    EXPECT_FLOAT_EQ(back[1], 0.5F);
+
+    // Every 24-bit value survives the round trip through float
+    std::vector<std::uint8_t> packed;
+    for (std::int32_t v : {-8388608, -1, 0, 1, 4660, 8388607}) {
+        const auto word = static_cast<std::uint32_t>(v);
+        packed.insert(packed.end(), {static_cast<std::uint8_t>(word), static_cast<std::uint8_t>(word >> 8U),
+                                     static_cast<std::uint8_t>(word >> 16U)});
+    }
+    std::vector<float> floats(packed.size() / 3U);
+    std::vector<std::uint8_t> repacked(packed.size());
+    Scalar().int24ToFloat(packed.data(), floats.data(), floats.size());
+    Scalar().floatToInt24(floats.data(), repacked.data(), floats.size());
+    EXPECT_EQ(repacked, packed);
+    EXPECT_FLOAT_EQ(floats[0], -1.0F);
+}
+
+TEST(DspKernelsTest, GainRampsPerFrameAndClips) {
+    std::vector<float> stereo = {1.0F, -1.0F, 1.0F, -1.0F, 1.0F, -1.0F, 1.0F, -1.0F};
+    Scalar().gainRamp(stereo.data(), 4U, 2U, 0.0F, 1.0F);
+    EXPECT_EQ(stereo, (std::vector<float>{0.0F, -0.0F, 0.25F, -0.25F, 0.5F, -0.5F, 0.75F, -0.75F}));
+
+    std::vector<float> loud = {0.5F, -0.9F};
+    Scalar().gainRamp(loud.data(), 2U, 1U, 4.0F, 4.0F);
+    EXPECT_EQ(loud, (std::vector<float>{1.0F, -1.0F}));
+}
+
+TEST(DspKernelsTest, DotSumsProducts) {
+    std::vector<float> ones(19U, 1.0F);
+    std::vector<float> ramp(19U);
+    for (std::size_t i = 0U; i < ramp.size(); ++i) {
+        ramp[i] = static_cast<float>(i);
+    }
+    EXPECT_FLOAT_EQ(Scalar().dot(ones.data(), ramp.data(), 19U), 171.0F);
+    EXPECT_FLOAT_EQ(Scalar().dot(ones.data(), ramp.data(), 8U), 28.0F);
+    EXPECT_FLOAT_EQ(Scalar().dot(ones.data(), ramp.data(), 0U), 0.0F);
+}
+
+TEST(DspKernelsTest, DispatchPicksASupportedIsa) {
+    const DspKernels& kernels = AutosarMusicPlayer::Bsw::Dsp::Kernels();
+    EXPECT_EQ(kernels.isa, AutosarMusicPlayer::Bsw::Dsp::DetectIsa());
+    EXPECT_EQ(KernelsFor(kernels.isa), &kernels);
+}
+
+class DspKernelsIsaTest : public ::testing::TestWithParam<DspIsa> {
+protected:
+    void SetUp() override {
+        kernels_ = KernelsFor(GetParam());
+        if (kernels_ == nullptr) {
+            GTEST_SKIP() << "not supported by this build or CPU";
+        }
+    }
+
+    const DspKernels* kernels_{nullptr};
+};
+
+TEST_P(DspKernelsIsaTest, ConversionsMatchScalarBitForBit) {
+    for (const std::size_t n : kLengths) {
+        const std::vector<float> signal = TestSignal(n, static_cast<std::uint32_t>(n));
+
+        std::vector<std::int16_t> ref16(n);
+        std::vector<std::int16_t> got16(n);
+        Scalar().floatToInt16(signal.data(), ref16.data(), n);
+        kernels_->floatToInt16(signal.data(), got16.data(), n);
+        EXPECT_TRUE(BitEqual(ref16, got16)) << "floatToInt16, n=" << n;
+
+        std::vector<float> refFloat(n);
+        std::vector<float> gotFloat(n);
+        Scalar().int16ToFloat(ref16.data(), refFloat.data(), n);
+        kernels_->int16ToFloat(ref16.data(), gotFloat.data(), n);
+        EXPECT_TRUE(BitEqual(refFloat, gotFloat)) << "int16ToFloat, n=" << n;
+
+        std::vector<std::uint8_t> ref24(3U * n);
+        std::vector<std::uint8_t> got24(3U * n);
+        Scalar().floatToInt24(signal.data(), ref24.data(), n);
+        kernels_->floatToInt24(signal.data(), got24.data(), n);
+        EXPECT_TRUE(BitEqual(ref24, got24)) << "floatToInt24, n=" << n;
+
+        Scalar().int24ToFloat(ref24.data(), refFloat.data(), n);
+        kernels_->int24ToFloat(ref24.data(), gotFloat.data(), n);
+        EXPECT_TRUE(BitEqual(refFloat, gotFloat)) << "int24ToFloat, n=" << n;
+    }
+}
+
+TEST_P(DspKernelsIsaTest, InterleavingAndGainMatchScalarBitForBit) {
+    for (const std::size_t frames : kLengths) {
+        const std::vector<float> stereo = TestSignal(2U * frames, 7U);
+
+        std::vector<float> refL(frames), refR(frames), gotL(frames), gotR(frames);
+        Scalar().deinterleave2(stereo.data(), refL.data(), refR.data(), frames);
+        kernels_->deinterleave2(stereo.data(), gotL.data(), gotR.data(), frames);
+        EXPECT_TRUE(BitEqual(refL, gotL) && BitEqual(refR, gotR)) << "deinterleave2, frames=" << frames;
+
+        std::vector<float> interleaved(2U * frames);
+        kernels_->interleave2(gotL.data(), gotR.data(), interleaved.data(), frames);
+        EXPECT_TRUE(BitEqual(interleaved, stereo)) << "interleave2, frames=" << frames;
+
+        for (const std::uint16_t channels : std::initializer_list<std::uint16_t>{1U, 2U, 3U, 4U, 8U, 16U}) {
+            std::vector<float> ref = TestSignal(frames * channels, channels);
+            std::vector<float> got = ref;
+            Scalar().gainRamp(ref.data(), frames, channels, 0.1F, 2.5F);
+            kernels_->gainRamp(got.data(), frames, channels, 0.1F, 2.5F);
+            EXPECT_TRUE(BitEqual(ref, got)) << "gainRamp, frames=" << frames << " channels=" << channels;
+        }
+    }
+}
+
+TEST_P(DspKernelsIsaTest, DotMatchesScalarBitForBit) {
+    // Finite values only: which NaN payload survives a sum is up to the compiler.
+    std::mt19937 rng(11U);
+    std::uniform_real_distribution<float> noise(-1.0F, 1.0F);
+    std::vector<float> a(1024U + 1U);
+    std::vector<float> b(a.size());
+    for (std::size_t i = 0U; i < a.size(); ++i) {
+        a[i] = noise(rng);
+        b[i] = noise(rng);
+    }
+    for (const std::size_t n : kLengths) {
+        // Unaligned too, as filter taps slide along the history
+        for (const float* x : {a.data(), a.data() + 1}) {
+            const float ref = Scalar().dot(x, b.data(), n);
+            const float got = kernels_->dot(x, b.data(), n);
+            EXPECT_EQ(std::memcmp(&ref, &got, sizeof(float)), 0) << "dot, n=" << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllIsas, DspKernelsIsaTest, ::testing::Values(DspIsa::Sse2, DspIsa::Avx2),
+                         [](const ::testing::TestParamInfo<DspIsa>& param) {
+                             return std::string(AutosarMusicPlayer::Bsw::Dsp::ToString(param.param));
+                         });
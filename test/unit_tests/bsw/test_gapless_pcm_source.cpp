@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "bsw_mocks/pcm_test_streams.hpp"
+#include "gapless_pcm_source.hpp"
+
+using AutosarMusicPlayer::Bsw::Audio::GaplessPcmSource;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Test::Mocks::CountingPcmSource;
+
+namespace {
+
+std::vector<float> Left(const std::vector<float>& stereo, std::size_t frames) {
+    std::vector<float> left;
+    for (std::size_t i = 0U; i < frames; ++i) {
+        left.push_back(stereo[2U * i]);
+    }
+    return left;
+}
+
+} // namespace
+
+TEST(GaplessPcmSourceTest, SplicesTheNextTrackInsideOneRead) {
+    CountingPcmSource first(2U, 10U, 1U);
+    CountingPcmSource second(2U, 7U, 1001U);
+    GaplessPcmSource stream(2U, 4U);
+    stream.Begin(first);
+    ASSERT_EQ(stream.QueueNext(second), AppError::Ok);
+    EXPECT_EQ(stream.QueueNext(second), AppError::Busy);
+
+    std::vector<float> out(16U);
+    ASSERT_EQ(stream.Read(out.data(), 8U), 8U);
+    EXPECT_EQ(second.FramesRead(), 4U) << "the queued track is pre-rolled before the boundary";
+    EXPECT_EQ(stream.Transitions(), 0U);
+
+    ASSERT_EQ(stream.Read(out.data(), 8U), 8U);
+    EXPECT_EQ(Left(out, 8U), (std::vector<float>{9.0F, 10.0F, 1001.0F, 1002.0F, 1003.0F, 1004.0F, 1005.0F, 1006.0F}));
+    EXPECT_EQ(out[5], out[4]) << "channels stay paired across the splice";
+    EXPECT_EQ(stream.Transitions(), 1U);
+    EXPECT_FALSE(stream.HasQueued());
+
+    ASSERT_EQ(stream.Read(out.data(), 8U), 1U);
+    EXPECT_EQ(out[0], 1007.0F);
+    EXPECT_EQ(stream.Read(out.data(), 8U), 0U) << "nothing queued: the stream ends";
+}
+
+TEST(GaplessPcmSourceTest, QueuingLateStillSplicesWithoutAGap) {
+    CountingPcmSource first(1U, 3U, 1U);
+    CountingPcmSource second(1U, 3U, 11U);
+    CountingPcmSource third(1U, 3U, 21U);
+    GaplessPcmSource stream(1U, 2U);
+    stream.Begin(first);
+
+    std::vector<float> out(4U);
+    ASSERT_EQ(stream.Read(out.data(), 2U), 2U);
+    ASSERT_EQ(stream.QueueNext(second), AppError::Ok); // after decoding started
+    ASSERT_EQ(stream.Read(out.data(), 4U), 4U);
+    EXPECT_EQ(out, (std::vector<float>{3.0F, 11.0F, 12.0F, 13.0F}));
+
+    // Queued while the pre-rolled head of the current track was being read
+    ASSERT_EQ(stream.QueueNext(third), AppError::Ok);
+    ASSERT_EQ(stream.Read(out.data(), 4U), 3U);
+    EXPECT_EQ(out[0], 21.0F);
+    EXPECT_EQ(stream.Transitions(), 2U);
+}
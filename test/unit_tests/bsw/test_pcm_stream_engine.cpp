@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pcm_period_ring.hpp"
+#include "pcm_sinks.hpp"
+#include "pcm_stream_engine.hpp"
+#include "bsw_mocks/pcm_test_streams.hpp"
+
+using AutosarMusicPlayer::Bsw::Audio::FilePcmSink;
+using AutosarMusicPlayer::Bsw::Audio::NullPcmSink;
+using AutosarMusicPlayer::Bsw::Audio::PcmEngineConfig;
+using AutosarMusicPlayer::Bsw::Audio::PcmPeriodRing;
+using AutosarMusicPlayer::Bsw::Audio::PcmStreamEngine;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Test::Mocks::CountingPcmSource;
+using AutosarMusicPlayer::Test::Mocks::RecordingPcmSink;
+
+namespace {
+
+constexpr std::uint16_t kChannels = 2U;
+constexpr std::uint32_t kFramesPerPeriod = 96U; // 2 ms at 48 kHz
+
+PcmEngineConfig TestConfig() {
+    PcmEngineConfig config;
+    config.format.sampleRate = 48000U;
+    config.format.channels = kChannels;
+    config.framesPerPeriod = kFramesPerPeriod;
+    config.periods = 4U;
+    return config;
+}
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::milliseconds(5000)) {
+    const auto giveUp = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > giveUp) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/**
+ * @brief The audio in @p samples, i.e. without underrun silence, must be
+ *        exactly 1, 2, ..., @p frames
+ */
+void ExpectContiguous(const std::vector<float>& samples, std::uint64_t frames) {
+    std::uint64_t expected = 1U;
+    for (const float sample : samples) {
+        if (sample <= 0.0F) {
+            continue;
+        }
+        ASSERT_EQ(sample, static_cast<float>(expected)) << "gap or repeat";
+        ++expected;
+    }
+    EXPECT_EQ(expected - 1U, frames);
+}
+
+} // namespace
+
+TEST(PcmPeriodRingTest, HandsOutPeriodsInPlaceAndInOrder) {
+    PcmPeriodRing ring(2U, 4U);
+    ASSERT_EQ(ring.ReadSlot(), nullptr);
+
+    for (float value = 1.0F; value <= 2.0F; value += 1.0F) {
+        float* slot = ring.WriteSlot();
+        ASSERT_NE(slot, nullptr);
+        slot[0] = value;
+        ring.CommitWrite();
+    }
+    EXPECT_EQ(ring.WriteSlot(), nullptr);
+    EXPECT_EQ(ring.Fill(), 2U);
+
+    ASSERT_NE(ring.ReadSlot(), nullptr);
+    EXPECT_EQ(ring.ReadSlot()[0], 1.0F);
+    ring.ReleaseRead();
+    EXPECT_NE(ring.WriteSlot(), nullptr);
+    EXPECT_EQ(ring.ReadSlot()[0], 2.0F);
+    ring.ReleaseRead();
+    EXPECT_EQ(ring.Fill(), 0U);
+}
+
+TEST(PcmStreamEngineTest, PlaysTheWholeStreamInOrder) {
+    constexpr std::uint64_t kFrames = 40U * kFramesPerPeriod + 10U; // ends mid-period
+    CountingPcmSource source(kChannels, kFrames);
+    RecordingPcmSink sink(kChannels);
+    PcmStreamEngine engine(source, sink, TestConfig());
+
+    ASSERT_EQ(engine.Start(), AppError::Ok);
+    EXPECT_TRUE(engine.IsStarted());
+    ASSERT_TRUE(WaitFor([&] { return engine.EndOfStream(); }));
+    ASSERT_EQ(engine.Stop(), AppError::Ok);
+    EXPECT_FALSE(engine.IsStarted());
+
+    ExpectContiguous(sink.Samples(), kFrames);
+    const auto stats = engine.Stats();
+    EXPECT_EQ(stats.periodsPlayed, 41U);
+    EXPECT_EQ(stats.writeErrors, 0U);
+    EXPECT_EQ(stats.fillPeriods, 0U);
+}
+
+TEST(PcmStreamEngineTest, PauseAndStopTakeEffectWithinOnePeriod) {
+    CountingPcmSource source(kChannels, ~std::uint64_t{0U});
+    RecordingPcmSink sink(kChannels);
+    PcmStreamEngine engine(source, sink, TestConfig());
+
+    EXPECT_EQ(engine.Pause(), AppError::NotReady);
+    ASSERT_EQ(engine.Start(), AppError::Ok);
+    ASSERT_TRUE(WaitFor([&] { return sink.FrameCount() >= 5U * kFramesPerPeriod; }));
+
+    // The sink checks the state before every period, so at most the one
+    // already being written lands after Pause() returns.
+    ASSERT_EQ(engine.Pause(), AppError::Ok);
+    const std::size_t atPause = sink.FrameCount();
+    std::this_thread::sleep_for(10 * engine.Period());
+    EXPECT_LE(sink.FrameCount(), atPause + kFramesPerPeriod);
+    EXPECT_TRUE(engine.IsStarted());
+    EXPECT_TRUE(engine.IsPaused());
+    EXPECT_EQ(engine.Stats().fillPeriods, 4U);
+
+    ASSERT_EQ(engine.Start(), AppError::Ok);
+    const std::size_t atResume = sink.FrameCount();
+    ASSERT_TRUE(WaitFor([&] { return sink.FrameCount() > atResume; }));
+
+    ASSERT_EQ(engine.Stop(), AppError::Ok);
+    const std::size_t atStop = sink.FrameCount();
+    std::this_thread::sleep_for(5 * engine.Period());
+    EXPECT_EQ(sink.FrameCount(), atStop);
+    EXPECT_EQ(engine.Stats().fillPeriods, 0U);
+    ExpectContiguous(sink.Samples(), engine.Stats().periodsPlayed * kFramesPerPeriod);
+}
+
+TEST(PcmStreamEngineTest, SlowSourceUnderrunsWithSilence) {
+    CountingPcmSource source(kChannels, ~std::uint64_t{0U});
+    NullPcmSink sink;
+    PcmStreamEngine engine(source, sink, TestConfig());
+
+    source.delay = std::chrono::microseconds(6000); // three periods to decode one
+    EXPECT_EQ(engine.Start(), AppError::Ok);
+    ASSERT_TRUE(WaitFor([&] { return engine.Stats().underruns >= 3U; }));
+    EXPECT_EQ(engine.Stop(), AppError::Ok);
+
+    const auto stats = engine.Stats();
+    EXPECT_EQ(sink.FramesWritten(), (stats.periodsPlayed + stats.underruns) * kFramesPerPeriod);
+}
+
+TEST(PcmStreamEngineTest, RejectsAnEmptyConfig) {
+    CountingPcmSource source(kChannels, 10U);
+    NullPcmSink sink;
+    PcmEngineConfig config = TestConfig();
+    config.periods = 1U;
+    PcmStreamEngine engine(source, sink, config);
+
+    EXPECT_EQ(engine.Start(), AppError::InvalidArgument);
+    EXPECT_FALSE(engine.IsStarted());
+}
+
+TEST(PcmStreamEngineTest, FileSinkRecordsRawFloats) {
+    const std::string path = ::testing::TempDir() + "pcm_stream_engine_test.f32";
+    constexpr std::uint64_t kFrames = 8U * kFramesPerPeriod;
+    CountingPcmSource source(kChannels, kFrames);
+    FilePcmSink sink(kChannels);
+    ASSERT_EQ(sink.Open(path.c_str()), AppError::Ok);
+    PcmStreamEngine engine(source, sink, TestConfig());
+
+    ASSERT_EQ(engine.Start(), AppError::Ok);
+    ASSERT_TRUE(WaitFor([&] { return engine.EndOfStream(); }));
+    ASSERT_EQ(engine.Stop(), AppError::Ok);
+    sink.Close();
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    std::vector<float> left;
+    float frame[kChannels];
+    while (std::fread(frame, sizeof(float), kChannels, file) == kChannels) {
+        EXPECT_EQ(frame[0], frame[1]);
+        left.push_back(frame[0]);
+    }
+    (void)std::fclose(file);
+    (void)std::remove(path.c_str());
+
+    EXPECT_EQ(left.size(), sink.FramesWritten());
+    ExpectContiguous(left, kFrames);
+}
@@ -0,0 +1,290 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "resampler.hpp"
+
+using AutosarMusicPlayer::Bsw::Dsp::DspIsa;
+using AutosarMusicPlayer::Bsw::Dsp::KernelsFor;
+using AutosarMusicPlayer::Bsw::Dsp::Resampler;
+using AutosarMusicPlayer::Bsw::Dsp::ResamplerConfig;
+using AutosarMusicPlayer::Bsw::Dsp::ResamplerMode;
+using AutosarMusicPlayer::Bsw::Dsp::ResamplerQuality;
+using AutosarMusicPlayer::Common::AppError;
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+std::vector<float> Tone(double frequency, double rate, std::size_t frames, std::uint16_t channels) {
+    std::vector<float> samples(frames * channels);
+    for (std::size_t i = 0U; i < frames; ++i) {
+        for (std::uint16_t ch = 0U; ch < channels; ++ch) {
+            // Channels a quarter turn apart, so a swap would show
+            const double phase = 2.0 * kPi * frequency * static_cast<double>(i) / rate + kPi / 2.0 * ch;
+            samples[i * channels + ch] = static_cast<float>(0.5 * std::sin(phase));
+        }
+    }
+    return samples;
+}
+
+/**
+ * @brief Everything @p input makes, in one Process() and the Flush()
+ */
+std::vector<float> ResampleAll(Resampler& resampler, const std::vector<float>& input) {
+    const std::uint16_t channels = resampler.Config().channels;
+    const std::size_t inputFrames = input.size() / channels;
+    std::vector<float> output(resampler.OutputFramesFor(inputFrames) * channels);
+    const auto result = resampler.Process(input.data(), inputFrames, output.data(), output.size() / channels);
+    EXPECT_EQ(result.inputFrames, inputFrames);
+    const std::size_t flushed =
+        resampler.Flush(output.data() + result.outputFrames * channels, output.size() / channels - result.outputFrames);
+    EXPECT_EQ(result.outputFrames + flushed, output.size() / channels);
+    EXPECT_EQ(resampler.Flush(output.data(), 1U), 0U);
+    return output;
+}
+
+/**
+ * @brief THD+N of one channel, in dB: the residual after a least-squares
+ *        fit of a sine at @p frequency (plus DC), against the fitted sine
+ *
+ * The first and last @p margin frames, where the filter runs over the
+ * zeros around the stream, are left out.
+ */
+double ThdPlusNoiseDb(const std::vector<float>& samples, std::uint16_t channels, std::uint16_t channel,
+                      double frequency, double rate, std::size_t margin) {
+    const std::size_t frames = samples.size() / channels;
+    // Normal equations for a * sin + b * cos + c
+    double m[3][4] = {};
+    for (std::size_t i = margin; i + margin < frames; ++i) {
+        const double w = 2.0 * kPi * frequency * static_cast<double>(i) / rate;
+        const double basis[3] = {std::sin(w), std::cos(w), 1.0};
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                m[r][c] += basis[r] * basis[c];
+            }
+            m[r][3] += basis[r] * static_cast<double>(samples[i * channels + channel]);
+        }
+    }
+    for (int pivot = 0; pivot < 3; ++pivot) {
+        for (int r = 0; r < 3; ++r) {
+            if (r != pivot) {
+                const double factor = m[r][pivot] / m[pivot][pivot];
+                for (int c = 0; c < 4; ++c) {
+                    m[r][c] -= factor * m[pivot][c];
+                }
+            }
+        }
+    }
+    const double a = m[0][3] / m[0][0];
+    const double b = m[1][3] / m[1][1];
+    const double dc = m[2][3] / m[2][2];
+
+    double signal = 0.0;
+    double residual = 0.0;
+    for (std::size_t i = margin; i + margin < frames; ++i) {
+        const double w = 2.0 * kPi * frequency * static_cast<double>(i) / rate;
+        const double fit = a * std::sin(w) + b * std::cos(w);
+        const double error = static_cast<double>(samples[i * channels + channel]) - fit - dc;
+        signal += fit * fit;
+        residual += error * error;
+    }
+    return 10.0 * std::log10(residual / signal);
+}
+
+/**
+ * @brief Level of one channel against a full 0.5-amplitude sine, in dB
+ */
+double LevelDb(const std::vector<float>& samples, std::uint16_t channels, std::uint16_t channel, std::size_t margin) {
+    const std::size_t frames = samples.size() / channels;
+    double energy = 0.0;
+    for (std::size_t i = margin; i + margin < frames; ++i) {
+        const auto sample = static_cast<double>(samples[i * channels + channel]);
+        energy += sample * sample;
+    }
+    return 10.0 * std::log10(energy / static_cast<double>(frames - 2U * margin) / 0.125);
+}
+
+/**
+ * @brief Ceiling on THD+N of in-band tones, per tier, a few dB above what
+ *        the filters reach (about -82, -114 and -130 dB at worst; float
+ *        rounding alone sits near -140 dB)
+ */
+constexpr double kMaxThdPlusNoiseDb[] = {-80.0, -110.0, -125.0};
+
+/**
+ * @brief Ceiling on what is left of a tone above the output Nyquist
+ *        frequency, per tier; the filters reach about -71, -107 and -131 dB
+ */
+constexpr double kMaxAliasDb[] = {-68.0, -104.0, -128.0};
+
+constexpr const char* kTierNames[] = {"Low", "Medium", "High"};
+
+} // namespace
+
+TEST(ResamplerTest, RejectsRatesItCannotConvert) {
+    Resampler resampler;
+    EXPECT_EQ(resampler.Configure(ResamplerConfig{44100U, 48000U, 0U}), AppError::InvalidArgument);
+    EXPECT_EQ(resampler.Configure(ResamplerConfig{4000U, 48000U, 2U}), AppError::InvalidArgument);
+    EXPECT_EQ(resampler.Configure(ResamplerConfig{44100U, 768000U, 2U}), AppError::InvalidArgument);
+    EXPECT_EQ(resampler.Configure(ResamplerConfig{384000U, 8000U, 2U}), AppError::InvalidArgument);
+    EXPECT_FALSE(resampler.IsConfigured());
+
+    // Unconfigured, nothing moves
+    float sample = 1.0F;
+    const auto result = resampler.Process(&sample, 1U, &sample, 1U);
+    EXPECT_EQ(result.inputFrames, 0U);
+    EXPECT_EQ(result.outputFrames, 0U);
+}
+
+TEST(ResamplerTest, PicksModeAndLengthFromTheRatio) {
+    Resampler resampler;
+    ASSERT_EQ(resampler.Configure(ResamplerConfig{44100U, 48000U, 2U}), AppError::Ok);
+    EXPECT_EQ(resampler.Mode(), ResamplerMode::Polyphase);
+    EXPECT_EQ(resampler.Taps(), 160U);
+    EXPECT_EQ(resampler.OutputFramesFor(44100U), 48000U);
+    EXPECT_EQ(resampler.OutputFramesFor(1U), 2U);
+    EXPECT_EQ(resampler.OutputFramesFor(148U), 162U);
+
+    // Downsampling stretches the filter by the ratio
+    ASSERT_EQ(resampler.Configure(ResamplerConfig{48000U, 44100U, 2U}), AppError::Ok);
+    EXPECT_EQ(resampler.Mode(), ResamplerMode::Polyphase);
+    EXPECT_EQ(resampler.Taps(), 176U);
+    ASSERT_EQ(resampler.Configure(ResamplerConfig{96000U, 48000U, 2U, ResamplerQuality::Low}), AppError::Ok);
+    EXPECT_EQ(resampler.Taps(), 48U);
+
+    ASSERT_EQ(resampler.Configure(ResamplerConfig{44100U, 47999U, 2U}), AppError::Ok);
+    EXPECT_EQ(resampler.Mode(), ResamplerMode::Interpolated);
+
+    ASSERT_EQ(resampler.Configure(ResamplerConfig{48000U, 48000U, 2U}), AppError::Ok);
+    EXPECT_EQ(resampler.Mode(), ResamplerMode::Passthrough);
+    const std::vector<float> tone = Tone(1000.0, 48000.0, 100U, 2U);
+    EXPECT_EQ(ResampleAll(resampler, tone), tone);
+}
+
+TEST(ResamplerTest, KeepsUnityGainAcrossThePassband) {
+    Resampler resampler;
+    ASSERT_EQ(resampler.Configure(ResamplerConfig{44100U, 48000U, 1U}), AppError::Ok);
+    const std::vector<float> steady = ResampleAll(resampler, std::vector<float>(4410U, 0.25F));
+    for (std::size_t i = 100U; i + 100U < steady.size(); ++i) {
+        ASSERT_NEAR(steady[i], 0.25F, 1e-6F) << "frame " << i;
+    }
+
+    // 19 kHz is still inside the High tier's passband
+    resampler.Reset();
+    const std::vector<float> high = ResampleAll(resampler, Tone(19000.0, 44100.0, 22050U, 1U));
+    EXPECT_NEAR(LevelDb(high, 1U, 0U, 200U), 0.0, 0.01);
+}
+
+TEST(ResamplerTest, SplittingTheInputDoesNotChangeTheOutput) {
+    for (const std::uint32_t outputRate : {48000U, 47999U, 32000U}) {
+        for (const std::uint16_t channels : {std::uint16_t{2U}, std::uint16_t{3U}}) {
+            const ResamplerConfig config{44100U, outputRate, channels, ResamplerQuality::Medium};
+            Resampler oneShot;
+            ASSERT_EQ(oneShot.Configure(config), AppError::Ok);
+            const std::vector<float> input = Tone(3000.0, 44100.0, 5000U, channels);
+            const std::vector<float> reference = ResampleAll(oneShot, input);
+
+            Resampler streaming;
+            ASSERT_EQ(streaming.Configure(config), AppError::Ok);
+            std::mt19937 rng(outputRate + channels);
+            std::uniform_int_distribution<std::size_t> blockSize(0U, 700U);
+            std::vector<float> output(reference.size());
+            std::size_t consumed = 0U;
+            std::size_t produced = 0U;
+            const std::size_t inputFrames = input.size() / channels;
+            while (consumed < inputFrames) {
+                const std::size_t in = std::min(blockSize(rng), inputFrames - consumed);
+                const std::size_t out = std::min(blockSize(rng), output.size() / channels - produced);
+                const auto result =
+                    streaming.Process(input.data() + consumed * channels, in, output.data() + produced * channels, out);
+                consumed += result.inputFrames;
+                produced += result.outputFrames;
+            }
+            while (true) {
+                const std::size_t out = std::min<std::size_t>(blockSize(rng) + 1U, output.size() / channels - produced);
+                const std::size_t flushed = streaming.Flush(output.data() + produced * channels, out);
+                if (flushed == 0U) {
+                    break;
+                }
+                produced += flushed;
+            }
+            EXPECT_EQ(produced * channels, reference.size());
+            EXPECT_EQ(std::memcmp(output.data(), reference.data(), reference.size() * sizeof(float)), 0)
+                << "to " << outputRate << " Hz, " << channels << " channels";
+        }
+    }
+}
+
+TEST(ResamplerTest, EveryIsaComputesTheScalarResult) {
+    const std::vector<float> input = Tone(5000.0, 48000.0, 4800U, 2U);
+    for (const std::uint32_t outputRate : {44100U, 44101U}) {
+        const ResamplerConfig config{48000U, outputRate, 2U};
+        Resampler scalar;
+        ASSERT_EQ(scalar.Configure(config, *KernelsFor(DspIsa::Scalar)), AppError::Ok);
+        const std::vector<float> reference = ResampleAll(scalar, input);
+
+        for (const DspIsa isa : {DspIsa::Sse2, DspIsa::Avx2}) {
+            if (KernelsFor(isa) == nullptr) {
+                continue;
+            }
+            Resampler vector;
+            ASSERT_EQ(vector.Configure(config, *KernelsFor(isa)), AppError::Ok);
+            const std::vector<float> output = ResampleAll(vector, input);
+            ASSERT_EQ(output.size(), reference.size());
+            EXPECT_EQ(std::memcmp(output.data(), reference.data(), reference.size() * sizeof(float)), 0)
+                << AutosarMusicPlayer::Bsw::Dsp::ToString(isa) << " to " << outputRate << " Hz";
+        }
+    }
+}
+
+class ResamplerQualityTest : public ::testing::TestWithParam<ResamplerQuality> {
+protected:
+    [[nodiscard]] std::size_t Tier() const {
+        return static_cast<std::size_t>(GetParam());
+    }
+};
+
+TEST_P(ResamplerQualityTest, TonesStayClean) {
+    struct Case {
+        std::uint32_t from;
+        std::uint32_t to;
+        double frequency;
+    };
+    // Both directions between the two rates, plus an awkward ratio for the
+    // interpolated mode; 10 kHz is inside every tier's passband.
+    const Case cases[] = {{44100U, 48000U, 1000.0}, {44100U, 48000U, 10000.0}, {48000U, 44100U, 1000.0},
+                          {48000U, 44100U, 10000.0}, {44100U, 47999U, 1000.0}, {44100U, 47999U, 10000.0}};
+    for (const Case& c : cases) {
+        Resampler resampler;
+        ASSERT_EQ(resampler.Configure(ResamplerConfig{c.from, c.to, 2U, GetParam()}), AppError::Ok);
+        const std::vector<float> out = ResampleAll(resampler, Tone(c.frequency, c.from, c.from / 2U, 2U));
+        for (std::uint16_t ch = 0U; ch < 2U; ++ch) {
+            const double thdN = ThdPlusNoiseDb(out, 2U, ch, c.frequency, c.to, resampler.Taps());
+            EXPECT_LT(thdN, kMaxThdPlusNoiseDb[Tier()])
+                << c.frequency << " Hz, " << c.from << " -> " << c.to << " Hz, channel " << ch;
+        }
+    }
+}
+
+TEST_P(ResamplerQualityTest, RemovesWhatWouldAlias) {
+    // Above 22.05 kHz, a 48 kHz tone has no place at 44.1 kHz: whatever
+    // is left folds back into the audio band.
+    for (const double frequency : {22600.0, 23500.0}) {
+        Resampler resampler;
+        ASSERT_EQ(resampler.Configure(ResamplerConfig{48000U, 44100U, 1U, GetParam()}), AppError::Ok);
+        const std::vector<float> out = ResampleAll(resampler, Tone(frequency, 48000.0, 24000U, 1U));
+        EXPECT_LT(LevelDb(out, 1U, 0U, resampler.Taps()), kMaxAliasDb[Tier()]) << frequency << " Hz";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllTiers, ResamplerQualityTest,
+                         ::testing::Values(ResamplerQuality::Low, ResamplerQuality::Medium, ResamplerQuality::High),
+                         [](const ::testing::TestParamInfo<ResamplerQuality>& param) {
+                             return std::string(kTierNames[static_cast<std::size_t>(param.param)]);
+                         });
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "bsw_mocks/pcm_test_streams.hpp"
+#include "resampling_pcm_source.hpp"
+
+using AutosarMusicPlayer::Bsw::Audio::PcmFormat;
+using AutosarMusicPlayer::Bsw::Audio::ResamplingPcmSource;
+using AutosarMusicPlayer::Bsw::Dsp::ResamplerMode;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Test::Mocks::CountingPcmSource;
+
+namespace {
+
+/**
+ * @brief Drain @p source in reads of awkward sizes
+ */
+std::vector<float> ReadAll(ResamplingPcmSource& source, std::uint16_t channels) {
+    std::vector<float> all;
+    std::vector<float> buffer(97U * channels);
+    for (std::size_t read = source.Read(buffer.data(), 97U); read != 0U; read = source.Read(buffer.data(), 97U)) {
+        all.insert(all.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(read * channels));
+    }
+    return all;
+}
+
+} // namespace
+
+TEST(ResamplingPcmSourceTest, ConvertsATrackToExactlyItsLengthAtTheOutputRate) {
+    CountingPcmSource track(2U, 1000U);
+    ResamplingPcmSource source;
+    ASSERT_EQ(source.Begin(track, PcmFormat{44100U, 2U}), AppError::Ok);
+    EXPECT_EQ(source.Converter().Mode(), ResamplerMode::Polyphase);
+    EXPECT_EQ(source.OutputFormat().sampleRate, 48000U);
+
+    const std::vector<float> out = ReadAll(source, 2U);
+    EXPECT_EQ(track.FramesRead(), 1000U);
+    EXPECT_EQ(out.size(), 2U * source.Converter().OutputFramesFor(1000U));
+    EXPECT_EQ(out.size(), 2U * 1089U);
+    // Output 0 sits on input 0; the ramp rises about 147/160 per frame.
+    EXPECT_NEAR(out[2U * 544U], 1.0F + 544.0F * 147.0F / 160.0F, 0.01F);
+    EXPECT_EQ(source.Read(std::vector<float>(2U).data(), 1U), 0U);
+}
+
+TEST(ResamplingPcmSourceTest, CopiesTracksAlreadyAtTheOutputRate) {
+    CountingPcmSource track(1U, 300U);
+    ResamplingPcmSource source;
+    ASSERT_EQ(source.Begin(track, PcmFormat{48000U, 1U}), AppError::Ok);
+    EXPECT_EQ(source.Converter().Mode(), ResamplerMode::Passthrough);
+
+    const std::vector<float> out = ReadAll(source, 1U);
+    ASSERT_EQ(out.size(), 300U);
+    for (std::size_t i = 0U; i < out.size(); ++i) {
+        EXPECT_EQ(out[i], static_cast<float>(i + 1U));
+    }
+
+    CountingPcmSource silent(0U, 10U);
+    EXPECT_EQ(source.Begin(silent, PcmFormat{44100U, 0U}), AppError::InvalidArgument);
+    EXPECT_EQ(source.Read(std::vector<float>(2U).data(), 1U), 0U);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "Os_Cfg.h"
+#include "scheduler.hpp"
+
+using AutosarMusicPlayer::Bsw::Os::Scheduler;
+using AutosarMusicPlayer::Bsw::Os::TaskConfig;
+using AutosarMusicPlayer::Bsw::Os::TaskId;
+using AutosarMusicPlayer::Bsw::Os::TaskStats;
+using AutosarMusicPlayer::Common::AppError;
+
+namespace {
+
+bool WaitFor(const std::atomic<int>& counter, int target) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (counter.load() < target) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(Scheduler, GeneratedConfigurationIsLoaded) {
+    Scheduler scheduler(AutosarMusicPlayer::Os_Cfg::kTasks);
+    EXPECT_EQ(scheduler.TaskCount(), 4U);
+
+    TaskId id = 0U;
+    ASSERT_EQ(scheduler.FindTask("Task_10ms", id), AppError::Ok);
+    EXPECT_EQ(id, AutosarMusicPlayer::Os_Cfg::kTask10ms);
+    EXPECT_EQ(scheduler.FindTask("Task_5ms", id), AppError::NotFound);
+
+    EXPECT_EQ(scheduler.AddRunnable(99U, []() {}), AppError::InvalidArgument);
+    EXPECT_EQ(scheduler.AddRunnable(id, Scheduler::Runnable{}), AppError::InvalidArgument);
+    EXPECT_EQ(scheduler.ActivateTask(id), AppError::InvalidArgument);
+
+    ASSERT_EQ(scheduler.Start(), AppError::Ok);
+    EXPECT_EQ(scheduler.Start(), AppError::Busy);
+    EXPECT_EQ(scheduler.AddRunnable(id, []() {}), AppError::Busy);
+    scheduler.Stop();
+}
+
+TEST(Scheduler, PeriodicTasksRunAtTheirRates) {
+    const std::array<TaskConfig, 2U> tasks{{
+        {"Fast", 2000U, 0U, 0U},
+        {"Slow", 20000U, 0U, 1U},
+    }};
+    Scheduler scheduler(tasks);
+
+    std::atomic<int> fast{0};
+    std::atomic<int> slow{0};
+    ASSERT_EQ(scheduler.AddRunnable(0U, [&]() { ++fast; }), AppError::Ok);
+    ASSERT_EQ(scheduler.AddRunnable(1U, [&]() { ++slow; }), AppError::Ok);
+
+    ASSERT_EQ(scheduler.Start(), AppError::Ok);
+    ASSERT_TRUE(WaitFor(slow, 6));
+    scheduler.Stop();
+
+    // Five slow periods cover fifty fast releases. A release the worker wakes
+    // too late for is skipped and counted as a deadline miss instead of run,
+    // so only the sum keeps the ratio on a loaded host.
+    const TaskStats fastStats = scheduler.Stats(0U);
+    EXPECT_GE(fastStats.activations + fastStats.deadlineMisses, 5U * 8U);
+    EXPECT_EQ(scheduler.Stats(0U).activations, static_cast<std::uint64_t>(fast.load()));
+    EXPECT_EQ(scheduler.Stats(1U).activations, static_cast<std::uint64_t>(slow.load()));
+    EXPECT_GT(scheduler.Stats(0U).totalJitterNs, 0U);
+}
+
+TEST(Scheduler, EventTaskRunsOnceForMergedActivations) {
+    const std::array<TaskConfig, 2U> tasks{{
+        {"Cyclic", 100000U, 0U, 0U},
+        {"Event", 0U, 5000U, 0U},
+    }};
+    Scheduler scheduler(tasks);
+
+    std::atomic<int> runs{0};
+    ASSERT_EQ(scheduler.AddRunnable(1U, [&]() { ++runs; }), AppError::Ok);
+
+    // Before Start the worker is not running: both merge into one run.
+    EXPECT_EQ(scheduler.ActivateTask(1U), AppError::Ok);
+    EXPECT_EQ(scheduler.ActivateTask(1U), AppError::Ok);
+    ASSERT_EQ(scheduler.Start(), AppError::Ok);
+    ASSERT_TRUE(WaitFor(runs, 1));
+
+    EXPECT_EQ(scheduler.ActivateTask(1U), AppError::Ok);
+    ASSERT_TRUE(WaitFor(runs, 2));
+    scheduler.Stop();
+
+    EXPECT_EQ(runs.load(), 2);
+    EXPECT_EQ(scheduler.Stats(1U).activations, 2U);
+}
+
+TEST(Scheduler, OverrunsAreCountedAsDeadlineMisses) {
+    const std::array<TaskConfig, 1U> tasks{{
+        {"Overrun", 2000U, 0U, 0U},
+    }};
+    Scheduler scheduler(tasks);
+
+    std::atomic<int> runs{0};
+    ASSERT_EQ(scheduler.AddRunnable(0U,
+                                    [&]() {
+                                        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                                        ++runs;
+                                    }),
+              AppError::Ok);
+
+    ASSERT_EQ(scheduler.Start(), AppError::Ok);
+    ASSERT_TRUE(WaitFor(runs, 3));
+    scheduler.Stop();
+
+    const auto stats = scheduler.Stats(0U);
+    // Each run misses its own deadline and skips at least one release.
+    EXPECT_GE(stats.deadlineMisses, 2U * stats.activations);
+    EXPECT_GE(stats.maxExecutionNs, 5000000U);
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bsw_mocks/wav_test_files.hpp"
+#include "mapped_file.hpp"
+#include "wav_reader.hpp"
+
+using AutosarMusicPlayer::Bsw::Audio::ParseWavHeader;
+using AutosarMusicPlayer::Bsw::Audio::PcmBlock;
+using AutosarMusicPlayer::Bsw::Audio::WavInfo;
+using AutosarMusicPlayer::Bsw::Audio::WavReader;
+using AutosarMusicPlayer::Bsw::Audio::WavSampleFormat;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Test::Mocks::WavFileBuilder;
+using AutosarMusicPlayer::Test::Mocks::WriteBinaryFile;
+
+namespace {
+
+constexpr std::uint16_t kFormatIeeeFloat = 3U;
+
+class WavReaderTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        reader.Close();
+        (void)std::remove(path.c_str());
+    }
+
+    void OpenBuilt(const WavFileBuilder& builder) {
+        ASSERT_TRUE(WriteBinaryFile(path, builder.Build()));
+        ASSERT_EQ(reader.Open(path.c_str()), AppError::Ok);
+    }
+
+    std::vector<float> ReadAll(std::size_t chunk = 3U) {
+        std::vector<float> out;
+        const std::size_t channels = reader.Info().format.channels;
+        std::vector<float> buffer(chunk * channels);
+        std::size_t frames = 0U;
+        while ((frames = reader.Read(buffer.data(), chunk)) != 0U) {
+            out.insert(out.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(frames * channels));
+        }
+        return out;
+    }
+
+    std::string path{::testing::TempDir() + "wav_reader_test.wav"};
+    WavReader reader;
+};
+
+std::vector<std::uint8_t> Pcm16(const std::vector<std::int16_t>& samples) {
+    std::vector<std::uint8_t> bytes;
+    for (const std::int16_t sample : samples) {
+        WavFileBuilder::Put16(bytes, static_cast<std::uint16_t>(sample));
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST_F(WavReaderTest, HandsOutBlocksAsViewsIntoTheMapping) {
+    WavFileBuilder builder;
+    builder.samples = Pcm16({1, -1, 2, -2, 3, -3, 4, -4, 5, -5});
+    builder.extraChunkBytes = 7U; // odd: padded to 8
+    OpenBuilt(builder);
+
+    const WavInfo& info = reader.Info();
+    EXPECT_EQ(info.sampleFormat, WavSampleFormat::Pcm16);
+    EXPECT_EQ(info.format.channels, 2U);
+    EXPECT_EQ(info.format.sampleRate, 48000U);
+    EXPECT_EQ(info.frames, 5U);
+
+    const PcmBlock first = reader.NextBlock(2U);
+    ASSERT_EQ(first.frames, 2U);
+    const PcmBlock second = reader.NextBlock(100U);
+    ASSERT_EQ(second.frames, 3U);
+    EXPECT_EQ(second.data, first.data + 2U * info.bytesPerFrame) << "blocks must be consecutive views, not copies";
+    EXPECT_EQ(std::memcmp(first.data, builder.samples.data(), builder.samples.size()), 0);
+    EXPECT_EQ(reader.NextBlock(100U).frames, 0U);
+    EXPECT_GE(reader.ReadAheadCalls(), 2U); // sequential hint plus the first window
+
+    ASSERT_EQ(reader.Seek(4U), AppError::Ok);
+    EXPECT_EQ(reader.NextBlock(100U).frames, 1U);
+    EXPECT_EQ(reader.Seek(6U), AppError::InvalidArgument);
+}
+
+TEST_F(WavReaderTest, ConvertsEveryEncodingToFloat) {
+    WavFileBuilder pcm16;
+    pcm16.channels = 1U;
+    pcm16.samples = Pcm16({-32768, 16384, 0});
+    OpenBuilt(pcm16);
+    std::vector<float> out = ReadAll(2U);
+    ASSERT_EQ(out.size(), 3U);
+    EXPECT_FLOAT_EQ(out[0], -1.0F);
+    EXPECT_FLOAT_EQ(out[1], 0.5F);
+    EXPECT_FLOAT_EQ(out[2], 0.0F);
+    reader.Close();
+
+    WavFileBuilder pcm24;
+    pcm24.channels = 1U;
+    pcm24.bitsPerSample = 24U;
+    pcm24.samples = {0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x40U, 0xFFU, 0xFFU, 0xFFU};
+    OpenBuilt(pcm24);
+    EXPECT_EQ(reader.Info().sampleFormat, WavSampleFormat::Pcm24);
+    out = ReadAll();
+    ASSERT_EQ(out.size(), 3U);
+    EXPECT_FLOAT_EQ(out[0], -1.0F);
+    EXPECT_FLOAT_EQ(out[1], 0.5F);
+    EXPECT_FLOAT_EQ(out[2], -1.0F / 8388608.0F);
+    reader.Close();
+
+    // 24 valid bits in 32-bit containers, as most interfaces record them
+    WavFileBuilder pcm32;
+    pcm32.channels = 1U;
+    pcm32.bitsPerSample = 32U;
+    pcm32.extensible = true;
+    WavFileBuilder::Put32(pcm32.samples, 0x80000000U);
+    WavFileBuilder::Put32(pcm32.samples, 0x40000000U);
+    OpenBuilt(pcm32);
+    EXPECT_EQ(reader.Info().sampleFormat, WavSampleFormat::Pcm32);
+    out = ReadAll();
+    ASSERT_EQ(out.size(), 2U);
+    EXPECT_FLOAT_EQ(out[0], -1.0F);
+    EXPECT_FLOAT_EQ(out[1], 0.5F);
+    reader.Close();
+
+    for (const bool extensible : {false, true}) {
+        WavFileBuilder float32;
+        float32.formatTag = kFormatIeeeFloat;
+        float32.bitsPerSample = 32U;
+        float32.extensible = extensible;
+        for (const float sample : {0.25F, -0.75F}) {
+            std::uint32_t bits = 0U;
+            std::memcpy(&bits, &sample, sizeof(bits));
+            WavFileBuilder::Put32(float32.samples, bits);
+        }
+        OpenBuilt(float32);
+        EXPECT_EQ(reader.Info().sampleFormat, WavSampleFormat::Float32);
+        out = ReadAll();
+        ASSERT_EQ(out.size(), 2U);
+        EXPECT_FLOAT_EQ(out[0], 0.25F);
+        EXPECT_FLOAT_EQ(out[1], -0.75F);
+        reader.Close();
+    }
+}
+
+TEST(WavHeaderTest, RejectsMalformedAndUnsupportedFiles) {
+    WavInfo info;
+    WavFileBuilder good;
+    good.samples = Pcm16({1, 2, 3, 4});
+    std::vector<std::uint8_t> bytes = good.Build();
+    ASSERT_EQ(ParseWavHeader(bytes.data(), bytes.size(), info), AppError::Ok);
+
+    std::vector<std::uint8_t> notRiff = bytes;
+    notRiff[0] = 'X';
+    EXPECT_EQ(ParseWavHeader(notRiff.data(), notRiff.size(), info), AppError::InvalidArgument);
+
+    // The header alone, without a data chunk
+    EXPECT_EQ(ParseWavHeader(bytes.data(), 36U, info), AppError::InvalidArgument);
+
+    WavFileBuilder adpcm = good;
+    adpcm.formatTag = 2U;
+    bytes = adpcm.Build();
+    EXPECT_EQ(ParseWavHeader(bytes.data(), bytes.size(), info), AppError::Unsupported);
+
+    WavFileBuilder pcm8 = good;
+    pcm8.bitsPerSample = 8U;
+    bytes = pcm8.Build();
+    EXPECT_EQ(ParseWavHeader(bytes.data(), bytes.size(), info), AppError::Unsupported);
+
+    WavFileBuilder badGuid = good;
+    badGuid.extensible = true;
+    bytes = badGuid.Build();
+    bytes[12U + 8U + 26U] ^= 0xFFU; // first byte of the GUID tail
+    EXPECT_EQ(ParseWavHeader(bytes.data(), bytes.size(), info), AppError::InvalidArgument);
+
+    // A recording cut short: the declared size runs past the end of the file
+    WavFileBuilder truncated = good;
+    truncated.samples.push_back(0x01U); // half a frame
+    truncated.dataSizeSlack = 1000U;
+    bytes = truncated.Build();
+    ASSERT_EQ(ParseWavHeader(bytes.data(), bytes.size(), info), AppError::Ok);
+    EXPECT_EQ(info.frames, 2U);
+}
+
+TEST(WavReaderOpenTest, ReportsMissingFiles) {
+    WavReader reader;
+    EXPECT_EQ(reader.Open("/nonexistent/track_001.wav"), AppError::NotFound);
+    EXPECT_FALSE(reader.IsOpen());
+    EXPECT_EQ(reader.NextBlock(16U).frames, 0U);
+    float sample = 1.0F;
+    EXPECT_EQ(reader.Read(&sample, 1U), 0U);
+    EXPECT_FLOAT_EQ(sample, 1.0F);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "app_events.hpp"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "event_bus.hpp"
+#include "playback_manager.hpp"
+
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Common::EventBus;
+using AutosarMusicPlayer::Common::SongChangedEvent;
+using AutosarMusicPlayer::Common::TypeList;
+
+namespace {
+
+struct Large {
+    std::array<std::uint32_t, 64> samples;
+};
+
+using TestBus = EventBus<TypeList<SongChangedEvent, Large>, 2U>;
+
+struct Recorder {
+    void OnSong(SongChangedEvent event) {
+        ids.push_back(event.id);
+    }
+
+    void OnLarge(const Large& event) {
+        seen = &event;
+    }
+
+    std::vector<AutosarMusicPlayer::Common::SongId> ids;
+    const Large* seen{nullptr};
+};
+
+void CountSong(void* context, SongChangedEvent /*event*/) {
+    ++*static_cast<int*>(context);
+}
+
+} // namespace
+
+TEST(EventBus, PublishesToTheTopicsSubscribersInOrder) {
+    TestBus bus;
+    Recorder recorder;
+    int count = 0;
+
+    ASSERT_EQ((bus.Subscribe<SongChangedEvent, &Recorder::OnSong>(recorder)), AppError::Ok);
+    ASSERT_EQ(bus.Subscribe<SongChangedEvent>(&CountSong, &count), AppError::Ok);
+
+    bus.Publish(SongChangedEvent{7U});
+    bus.Publish(SongChangedEvent{9U});
+    bus.Publish(Large{});
+
+    EXPECT_EQ(recorder.ids, (std::vector<AutosarMusicPlayer::Common::SongId>{7U, 9U}));
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(bus.SubscriberCount<Large>(), 0U);
+}
+
+TEST(EventBus, CapacityDuplicatesAndUnsubscribe) {
+    TestBus bus;
+    Recorder a;
+    Recorder b;
+    int count = 0;
+
+    ASSERT_EQ((bus.Subscribe<SongChangedEvent, &Recorder::OnSong>(a)), AppError::Ok);
+    ASSERT_EQ((bus.Subscribe<SongChangedEvent, &Recorder::OnSong>(a)), AppError::Ok);
+    ASSERT_EQ((bus.Subscribe<SongChangedEvent, &Recorder::OnSong>(b)), AppError::Ok);
+    EXPECT_EQ(bus.SubscriberCount<SongChangedEvent>(), 2U);
+    EXPECT_EQ(bus.Subscribe<SongChangedEvent>(&CountSong, &count), AppError::Busy);
+    EXPECT_EQ(bus.Subscribe<SongChangedEvent>(nullptr, &count), AppError::InvalidArgument);
+
+    bus.Unsubscribe<SongChangedEvent, &Recorder::OnSong>(a);
+    bus.Publish(SongChangedEvent{3U});
+    EXPECT_TRUE(a.ids.empty());
+    EXPECT_EQ(b.ids.size(), 1U);
+}
+
+TEST(EventBus, LargeEventsArePassedByReference) {
+    TestBus bus;
+    Recorder recorder;
+    ASSERT_EQ((bus.Subscribe<Large, &Recorder::OnLarge>(recorder)), AppError::Ok);
+
+    const Large event{};
+    bus.Publish(event);
+    EXPECT_EQ(recorder.seen, &event);
+}
+
+TEST(EventBus, PlaybackManagerPublishesThroughTheBusPort) {
+    using AutosarMusicPlayer::Common::AppEventBus;
+    using AutosarMusicPlayer::Common::AppEventBusPort;
+    using AutosarMusicPlayer::Common::PlaybackStateChangedEvent;
+
+    struct StateRecorder {
+        void OnState(PlaybackStateChangedEvent event) {
+            states.push_back(event.state);
+        }
+        std::vector<Rte_PlaybackStateType> states;
+    };
+
+    AppEventBus bus;
+    StateRecorder recorder;
+    ASSERT_EQ((bus.Subscribe<PlaybackStateChangedEvent, &StateRecorder::OnState>(recorder)), AppError::Ok);
+
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    AutosarMusicPlayer::Asw::Playback::BasicPlaybackManager<AppEventBusPort> mgr(codec, AppEventBusPort(bus));
+    EXPECT_EQ(mgr.Play(), AppError::Ok);
+
+    EXPECT_EQ(recorder.states,
+              (std::vector<Rte_PlaybackStateType>{Rte_PlaybackStateType::Stopped, Rte_PlaybackStateType::Playing}));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "mpsc_queue.hpp"
+
+using AutosarMusicPlayer::Common::MpscQueue;
+
+TEST(MpscQueue, FifoAndBounded) {
+    MpscQueue<int, 4U> queue;
+    int out = 0;
+    EXPECT_FALSE(queue.TryPop(out));
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(queue.TryPush(round * 10 + i));
+        }
+        EXPECT_FALSE(queue.TryPush(99));
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.TryPop(out));
+            EXPECT_EQ(out, round * 10 + i);
+        }
+        EXPECT_FALSE(queue.TryPop(out));
+    }
+}
+
+TEST(MpscQueue, ConcurrentProducersDeliverEveryItemOnce) {
+    constexpr std::uint32_t kProducers = 4U;
+    constexpr std::uint32_t kPerProducer = 20000U;
+    MpscQueue<std::uint32_t, 64U> queue;
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0U; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (std::uint32_t i = 0U; i < kPerProducer; ++i) {
+                while (!queue.TryPush(p * kPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Items of one producer must come out in the order it pushed them.
+    std::vector<std::uint32_t> nextOf(kProducers, 0U);
+    std::uint32_t received = 0U;
+    std::uint32_t value = 0U;
+    while (received < kProducers * kPerProducer) {
+        if (!queue.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const std::uint32_t producer = value / kPerProducer;
+        ASSERT_EQ(value % kPerProducer, nextOf[producer]);
+        ++nextOf[producer];
+        ++received;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string_view>
+
+#include "perfect_hash.hpp"
+
+using AutosarMusicPlayer::Common::HashFnv1a;
+using AutosarMusicPlayer::Common::PerfectHash;
+
+TEST(PerfectHash, FindsEveryKeyAndRejectsOthers) {
+    constexpr PerfectHash<5U> hash{{"alpha", "beta", "gamma", "delta", "epsilon"}};
+    static_assert(hash.IsPerfect());
+    static_assert(hash.Find("gamma") == 2U);
+    static_assert(PerfectHash<5U>::SlotCount() == 16U);
+
+    EXPECT_EQ(hash.Find("alpha"), 0U);
+    EXPECT_EQ(hash.Find("epsilon"), 4U);
+    EXPECT_EQ(hash.Find("zeta"), hash.kNotFound);
+    EXPECT_EQ(hash.Find(""), hash.kNotFound);
+    EXPECT_EQ(hash.Find(std::string_view("alphabet").substr(0U, 5U)), 0U);
+}
+
+TEST(PerfectHash, DuplicateKeysAreNeverPerfect) {
+    constexpr PerfectHash<3U> hash{{"play", "stop", "play"}};
+    static_assert(!hash.IsPerfect());
+}
+
+TEST(PerfectHash, StringViewHashMatchesTheLiteralHash) {
+    static_assert(HashFnv1a(std::string_view("select")) == HashFnv1a("select"));
+    static_assert(HashFnv1a(std::string_view("")) == HashFnv1a(""));
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "seqlock.hpp"
+
+using AutosarMusicPlayer::Common::Seqlock;
+
+namespace {
+
+// Wider than one word, so a torn read would show as unequal fields.
+struct Wide {
+    std::uint64_t a;
+    std::uint64_t b;
+    std::uint64_t c;
+    std::uint32_t d;
+};
+
+} // namespace
+
+TEST(Seqlock, LoadFailsUntilFirstStore) {
+    Seqlock<Wide> cell;
+    Wide out{7U, 7U, 7U, 7U};
+    EXPECT_FALSE(cell.Load(out));
+    EXPECT_EQ(out.a, 7U);
+    EXPECT_EQ(cell.Version(), 0U);
+
+    cell.Store(Wide{1U, 2U, 3U, 4U});
+    cell.Store(Wide{5U, 6U, 7U, 8U});
+    ASSERT_TRUE(cell.Load(out));
+    EXPECT_EQ(out.a, 5U);
+    EXPECT_EQ(out.d, 8U);
+    EXPECT_EQ(cell.Version(), 2U);
+}
+
+TEST(Seqlock, ConcurrentReadersNeverSeeTornValues) {
+    constexpr std::uint64_t kWrites = 100000U;
+    Seqlock<Wide> cell;
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            std::uint64_t last = 0U;
+            Wide out{};
+            while (!done.load()) {
+                if (!cell.Load(out)) {
+                    continue;
+                }
+                const bool consistent =
+                    out.b == out.a && out.c == out.a && out.d == static_cast<std::uint32_t>(out.a);
+                if (!consistent || out.a < last) {
+                    ++failures;
+                }
+                last = out.a;
+            }
+        });
+    }
+
+    for (std::uint64_t i = 1U; i <= kWrites; ++i) {
+        cell.Store(Wide{i, i, i, static_cast<std::uint32_t>(i)});
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(cell.Version(), kWrites);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "snapshot_cell.hpp"
+
+using AutosarMusicPlayer::Common::SnapshotCell;
+
+namespace {
+
+// Counts live instances, so the test can tell every snapshot was freed.
+struct Tracked {
+    static std::atomic<int> live;
+
+    explicit Tracked(int v) : value(v) {
+        ++live;
+    }
+    ~Tracked() {
+        --live;
+    }
+    Tracked(const Tracked&) = delete;
+    Tracked& operator=(const Tracked&) = delete;
+    Tracked(Tracked&&) = delete;
+    Tracked& operator=(Tracked&&) = delete;
+
+    int value;
+};
+
+std::atomic<int> Tracked::live{0};
+
+} // namespace
+
+TEST(SnapshotCell, ReadersKeepReplacedSnapshots) {
+    {
+        SnapshotCell<Tracked> cell;
+        EXPECT_EQ(cell.Load(), nullptr);
+
+        cell.Store(std::make_shared<const Tracked>(1));
+        const auto first = cell.Load();
+        cell.Store(std::make_shared<const Tracked>(2));
+
+        EXPECT_EQ(first->value, 1);
+        EXPECT_EQ(cell.Load()->value, 2);
+        EXPECT_EQ(cell.PendingReclaim(), 0U);
+        EXPECT_EQ(Tracked::live.load(), 2);
+    }
+    EXPECT_EQ(Tracked::live.load(), 0);
+}
+
+TEST(SnapshotCell, ConcurrentLoadsSeeIncreasingValues) {
+    {
+        SnapshotCell<Tracked> cell(std::make_shared<const Tracked>(0));
+        std::atomic<bool> done{false};
+        std::atomic<int> failures{0};
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 4; ++r) {
+            readers.emplace_back([&]() {
+                int last = 0;
+                while (!done.load()) {
+                    const auto snapshot = cell.Load();
+                    if (snapshot == nullptr || snapshot->value < last) {
+                        ++failures;
+                    } else {
+                        last = snapshot->value;
+                    }
+                }
+            });
+        }
+
+        for (int value = 1; value <= 20000; ++value) {
+            cell.Store(std::make_shared<const Tracked>(value));
+        }
+        done.store(true);
+        for (auto& reader : readers) {
+            reader.join();
+        }
+
+        EXPECT_EQ(failures.load(), 0);
+        EXPECT_EQ(cell.Load()->value, 20000);
+    }
+    EXPECT_EQ(Tracked::live.load(), 0);
+}
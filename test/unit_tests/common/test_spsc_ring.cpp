@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "spsc_ring.hpp"
+
+using AutosarMusicPlayer::Common::SpscRing;
+
+TEST(SpscRing, FifoAndBounded) {
+    SpscRing<int, 4U> ring;
+    int out = 0;
+    EXPECT_FALSE(ring.TryPop(out));
+
+    // Several rounds so the indices wrap past the capacity.
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.TryPush(round * 10 + i));
+        }
+        EXPECT_FALSE(ring.TryPush(99));
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(ring.TryPop(out));
+            EXPECT_EQ(out, round * 10 + i);
+        }
+        EXPECT_FALSE(ring.TryPop(out));
+    }
+}
+
+TEST(SpscRing, ConcurrentProducerDeliversEveryItemInOrder) {
+    constexpr std::uint32_t kItems = 100000U;
+    SpscRing<std::uint32_t, 16U> ring;
+
+    std::thread producer([&ring]() {
+        for (std::uint32_t i = 0U; i < kItems; ++i) {
+            while (!ring.TryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint32_t expected = 0U;
+    std::uint32_t value = 0U;
+    while (expected < kItems) {
+        if (!ring.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(value, expected);
+        ++expected;
+    }
+    producer.join();
+    EXPECT_FALSE(ring.TryPop(value));
+}
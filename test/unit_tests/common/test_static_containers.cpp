@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+#include "fixed_string.hpp"
+#include "static_vector.hpp"
+
+using AutosarMusicPlayer::Common::FixedString;
+using AutosarMusicPlayer::Common::StaticVector;
+
+TEST(StaticVector, PushEraseAndResize) {
+    StaticVector<int, 8U> values;
+    EXPECT_TRUE(values.empty());
+    for (int i = 0; i < 8; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_TRUE(values.full());
+
+    values.erase(values.begin() + 2, values.begin() + 5);
+    ASSERT_EQ(values.size(), 5U);
+    EXPECT_EQ(values[2], 5);
+    EXPECT_EQ(values.back(), 7);
+
+    values.resize(2U);
+    EXPECT_EQ(values.size(), 2U);
+    values.resize(4U, 9);
+    EXPECT_EQ(values[3], 9);
+}
+
+TEST(FixedString, TruncatesWithoutSplittingUtf8) {
+    // "aé" is 3 bytes; a 2-byte limit must drop the whole 2-byte sequence.
+    const std::string_view text = "a\xC3\xA9";
+    FixedString<2U> title(text);
+    EXPECT_EQ(title.View(), "a");
+
+    FixedString<3U> fits(text);
+    EXPECT_EQ(fits.View(), text);
+
+    fits.clear();
+    EXPECT_TRUE(fits.empty());
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "string_arena.hpp"
+#include "track_list.hpp"
+
+using AutosarMusicPlayer::Common::StringArena;
+using AutosarMusicPlayer::Common::TrackList;
+
+TEST(StringArena, ViewsStayValidAsBlocksAreAdded) {
+    StringArena arena(64U);
+    std::vector<std::string_view> views;
+    for (int i = 0; i < 100; ++i) {
+        views.push_back(arena.Store("title_" + std::to_string(i)));
+    }
+    // Larger than a quarter block: gets a block of its own.
+    const std::string big(40U, 'b');
+    const std::string_view bigView = arena.Store(big);
+
+    StringArena moved = std::move(arena);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(views[static_cast<std::size_t>(i)], "title_" + std::to_string(i));
+    }
+    EXPECT_EQ(bigView, big);
+    EXPECT_GT(moved.BlockCount(), 1U);
+    EXPECT_GE(moved.BytesReserved(), moved.BytesStored());
+}
+
+TEST(StringArena, EmptyStringsTakeNoSpace) {
+    StringArena arena;
+    EXPECT_TRUE(arena.Store("").empty());
+    EXPECT_EQ(arena.BlockCount(), 0U);
+}
+
+TEST(StringArena, ResetRefillsTheSameBlocks) {
+    StringArena arena(64U);
+    for (int i = 0; i < 20; ++i) {
+        (void)arena.Store("title_" + std::to_string(i));
+    }
+    const std::size_t blocks = arena.BlockCount();
+    const std::size_t reserved = arena.BytesReserved();
+
+    arena.Reset();
+    EXPECT_EQ(arena.BytesStored(), 0U);
+    std::vector<std::string_view> views;
+    for (int i = 0; i < 20; ++i) {
+        views.push_back(arena.Store("again_" + std::to_string(i)));
+    }
+    EXPECT_EQ(arena.BlockCount(), blocks);
+    EXPECT_EQ(arena.BytesReserved(), reserved);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(views[static_cast<std::size_t>(i)], "again_" + std::to_string(i));
+    }
+
+    // Storing more than before grows the arena as usual.
+    (void)arena.Store(std::string(10U, 'x'));
+    (void)arena.Store(std::string(10U, 'y'));
+    EXPECT_GE(arena.BlockCount(), blocks);
+}
+
+TEST(TrackList, OwnsTitlesOfAddedTracks) {
+    TrackList tracks;
+    {
+        const std::string temporary = "Only copy";
+        tracks.Add(7U, temporary, 120U);
+    }
+    ASSERT_EQ(tracks.Size(), 1U);
+    EXPECT_EQ(tracks[0U].id, 7U);
+    EXPECT_EQ(tracks[0U].title, "Only copy");
+    EXPECT_EQ(tracks.TitleBytes(), 9U);
+
+    tracks.Clear();
+    EXPECT_TRUE(tracks.Empty());
+    EXPECT_EQ(tracks.TitleBytes(), 0U);
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Rte_MusicPlayerApp_Ports.h"
+#include "bsw_mocks/mock_audio_codec.hpp"
+#include "playback_manager.hpp"
+
+using AutosarMusicPlayer::Asw::Playback::BasicPlaybackManager;
+using AutosarMusicPlayer::Common::AppError;
+using AutosarMusicPlayer::Rte::MusicPlayerAppRte;
+using AutosarMusicPlayer::Rte::StaticRtePort;
+
+namespace {
+
+using Port = StaticRtePort<MusicPlayerAppRte>;
+
+} // namespace
+
+TEST(RtePorts, ReadReturnsInitValueUntilWritten) {
+    MusicPlayerAppRte rte;
+
+    Rte_SongIdType song = 99U;
+    EXPECT_EQ(rte.Read_PpCurrentSong_SongId(&song), RTE_E_NEVER_RECEIVED);
+    EXPECT_EQ(song, 0U);
+
+    EXPECT_EQ(rte.Write_PpCurrentSong_SongId(42U), RTE_E_OK);
+    EXPECT_EQ(rte.Read_PpCurrentSong_SongId(&song), RTE_E_OK);
+    EXPECT_EQ(song, 42U);
+
+    Rte_PlaybackStatusType status{Rte_PlaybackStateType::Paused, 5U};
+    EXPECT_EQ(rte.Read_PpPlaybackStatus_Status(&status), RTE_E_NEVER_RECEIVED);
+    EXPECT_EQ(status.state, Rte_PlaybackStateType::Stopped);
+    EXPECT_EQ(status.sequence, 0U);
+}
+
+TEST(RtePorts, QueuedPortReportsLimitAndNoData) {
+    MusicPlayerAppRte rte;
+    Rte_PlaybackStatusType status{};
+    EXPECT_EQ(rte.Receive_PpPlaybackEvents_Status(&status), RTE_E_NO_DATA);
+
+    for (Rte_SequenceCounterType i = 0U; i < MusicPlayerAppRte::kPlaybackEventsQueueLength; ++i) {
+        EXPECT_EQ(rte.Send_PpPlaybackEvents_Status(Rte_PlaybackStatusType{Rte_PlaybackStateType::Playing, i}),
+                  RTE_E_OK);
+    }
+    EXPECT_EQ(rte.Send_PpPlaybackEvents_Status(Rte_PlaybackStatusType{Rte_PlaybackStateType::Playing, 99U}),
+              RTE_E_LIMIT);
+
+    ASSERT_EQ(rte.Receive_PpPlaybackEvents_Status(&status), RTE_E_OK);
+    EXPECT_EQ(status.sequence, 0U);
+}
+
+TEST(RtePorts, PlaybackManagerWritesStatusAndQueuesEvents) {
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    MusicPlayerAppRte rte;
+    BasicPlaybackManager<Port> mgr(codec, Port(rte));
+
+    EXPECT_EQ(mgr.Play(), AppError::Ok);
+    EXPECT_EQ(mgr.Pause(), AppError::Ok);
+
+    Rte_PlaybackStatusType status{};
+    ASSERT_EQ(rte.Read_PpPlaybackStatus_Status(&status), RTE_E_OK);
+    EXPECT_EQ(status.state, Rte_PlaybackStateType::Paused);
+    EXPECT_EQ(status.sequence, 2U);
+    EXPECT_EQ(mgr.Sequence(), status.sequence);
+
+    std::vector<Rte_PlaybackStateType> events;
+    while (rte.Receive_PpPlaybackEvents_Status(&status) == RTE_E_OK) {
+        events.push_back(status.state);
+    }
+    EXPECT_EQ(events, (std::vector<Rte_PlaybackStateType>{Rte_PlaybackStateType::Stopped,
+                                                          Rte_PlaybackStateType::Playing,
+                                                          Rte_PlaybackStateType::Paused}));
+}
+
+// Runnables on other cores read while the playback manager toggles
+// Play/Pause: every status read must be a consistent (state, sequence) pair
+// and the events must arrive in order.
+TEST(RtePorts, ConcurrentReadersSeeConsistentStatus) {
+    constexpr Rte_SequenceCounterType kTransitions = 50000U;
+    AutosarMusicPlayer::Test::Mocks::MockAudioCodec codec;
+    MusicPlayerAppRte rte;
+    BasicPlaybackManager<Port> mgr(codec, Port(rte));
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&]() {
+            Rte_SequenceCounterType last = 0U;
+            Rte_PlaybackStatusType status{};
+            while (!done.load()) {
+                (void)rte.Read_PpPlaybackStatus_Status(&status);
+                const auto expected = status.sequence == 0U          ? Rte_PlaybackStateType::Stopped
+                                      : (status.sequence % 2U) != 0U ? Rte_PlaybackStateType::Playing
+                                                                     : Rte_PlaybackStateType::Paused;
+                if (status.state != expected || status.sequence < last) {
+                    ++failures;
+                }
+                last = status.sequence;
+            }
+        });
+    }
+
+    std::thread receiver([&]() {
+        Rte_SequenceCounterType next = 0U;
+        Rte_PlaybackStatusType status{};
+        for (;;) {
+            const bool finished = done.load();
+            while (rte.Receive_PpPlaybackEvents_Status(&status) == RTE_E_OK) {
+                // Overflow drops events, never reorders them.
+                if (status.sequence < next) {
+                    ++failures;
+                }
+                next = status.sequence + 1U;
+            }
+            if (finished) {
+                break;
+            }
+        }
+    });
+
+    for (Rte_SequenceCounterType i = 0U; i < kTransitions; ++i) {
+        const auto res = (i % 2U) == 0U ? mgr.Play() : mgr.Pause();
+        if (res != AppError::Ok) {
+            ++failures;
+        }
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    receiver.join();
+
+    EXPECT_EQ(failures.load(), 0);
+    Rte_PlaybackStatusType status{};
+    ASSERT_EQ(rte.Read_PpPlaybackStatus_Status(&status), RTE_E_OK);
+    EXPECT_EQ(status.sequence, kTransitions);
+}